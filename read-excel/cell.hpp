@@ -1,142 +1,306 @@
-
-/*
-	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
-	SPDX-License-Identifier: MIT
-*/
-
-#ifndef EXCEL__CELL_HPP__INCLUDED
-#define EXCEL__CELL_HPP__INCLUDED
-
-// Excel include.
-#include "formula.hpp"
-
-// C++ include
-#include <string>
-#include <sstream>
-
-
-namespace Excel {
-
-//
-// Cell
-//
-
-//! Excel's cell.
-class Cell {
-public:
-	//! Type of the data.
-	enum class DataType {
-		//! Unknown.
-		Unknown,
-		//! String.
-		String,
-		//! Double.
-		Double,
-		//! Formula.
-		Formula
-	}; // enum class DataType
-
-	Cell();
-
-	//! \return Data type.
-	DataType dataType() const;
-
-	//! \return String data in the cell.
-	const std::wstring & getString() const;
-
-	//! \return Double data in the cell.
-	const double & getDouble() const;
-
-	//! \return Formula.
-	const Formula & getFormula() const;
-
-	//! Set data.
-	void setData( const std::wstring & d );
-
-	//! Set data.
-	void setData( const double & d );
-
-	//! Set data.
-	void setData( const Formula & f );
-
-	//! \return true if there is no data.
-	bool isNull() const;
-
-private:
-	//! Cell's string data.
-	std::wstring m_stringData;
-	//! Cell's double data.
-	double m_doubleData;
-	//! Cell's formula.
-	Formula m_formula;
-	//! Is data set.
-	bool m_isNull;
-	//! Type of the data.
-	DataType m_type;
-}; // class Cell
-
-inline
-Cell::Cell()
-	:	m_doubleData( 0.0 )
-	,	m_isNull( true )
-	,	m_type( DataType::Unknown )
-{
-}
-
-inline Cell::DataType
-Cell::dataType() const
-{
-	return m_type;
-}
-
-inline const std::wstring &
-Cell::getString() const
-{
-	return m_stringData;
-}
-
-inline const double &
-Cell::getDouble() const
-{
-	return m_doubleData;
-}
-
-inline const Formula &
-Cell::getFormula() const
-{
-	return m_formula;
-}
-
-inline void
-Cell::setData( const std::wstring & d )
-{
-	m_stringData = d;
-	m_isNull = false;
-	m_type = DataType::String;
-}
-
-inline void
-Cell::setData( const double & d )
-{
-	m_doubleData = d;
-	m_isNull = false;
-	m_type = DataType::Double;
-}
-
-inline void
-Cell::setData( const Formula & f )
-{
-	m_formula = f;
-	m_isNull = false;
-	m_type = DataType::Formula;
-}
-
-inline bool
-Cell::isNull() const
-{
-	return m_isNull;
-}
-
-} /* namespace Excel */
-
-#endif // EXCEL__CELL_HPP__INCLUDED
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef EXCEL__CELL_HPP__INCLUDED
+#define EXCEL__CELL_HPP__INCLUDED
+
+// Excel include.
+#include "formula.hpp"
+
+// C++ include
+#include <string>
+#include <sstream>
+#include <cstdint>
+
+
+namespace Excel {
+
+//
+// Cell
+//
+
+//! Excel's cell.
+class Cell {
+public:
+	//! Type of the data.
+	enum class DataType {
+		//! Unknown.
+		Unknown,
+		//! String.
+		String,
+		//! Double.
+		Double,
+		//! Formula.
+		Formula
+	}; // enum class DataType
+
+	Cell();
+
+	//! \return Data type.
+	DataType dataType() const;
+
+	//! \return String data in the cell.
+	const std::wstring & getString() const;
+
+	//! \return Double data in the cell.
+	const double & getDouble() const;
+
+	//! \return Formula.
+	const Formula & getFormula() const;
+
+	//! Set data.
+	void setData( const std::wstring & d );
+
+	//! Set data.
+	void setData( const double & d );
+
+	//! Set data.
+	void setData( const Formula & f );
+
+	/*!
+		Set data with the string from the shared string table. The string
+		isn't copied, the cell refers to it, so the string should outlive
+		the cell.
+	*/
+	void setSharedString( const std::wstring & s );
+
+	//! \return true if there is no data.
+	bool isNull() const;
+
+private:
+	//! Cell's string data.
+	std::wstring m_stringData;
+	//! Shared string of the cell, nullptr if the cell has its own string.
+	const std::wstring * m_sharedString;
+	//! Cell's double data.
+	double m_doubleData;
+	//! Cell's formula.
+	Formula m_formula;
+	//! Is data set.
+	bool m_isNull;
+	//! Type of the data.
+	DataType m_type;
+}; // class Cell
+
+inline
+Cell::Cell()
+	:	m_sharedString( nullptr )
+	,	m_doubleData( 0.0 )
+	,	m_isNull( true )
+	,	m_type( DataType::Unknown )
+{
+}
+
+inline Cell::DataType
+Cell::dataType() const
+{
+	return m_type;
+}
+
+inline const std::wstring &
+Cell::getString() const
+{
+	return ( m_sharedString ? *m_sharedString : m_stringData );
+}
+
+inline const double &
+Cell::getDouble() const
+{
+	return m_doubleData;
+}
+
+inline const Formula &
+Cell::getFormula() const
+{
+	return m_formula;
+}
+
+inline void
+Cell::setData( const std::wstring & d )
+{
+	m_stringData = d;
+	m_sharedString = nullptr;
+	m_isNull = false;
+	m_type = DataType::String;
+}
+
+inline void
+Cell::setData( const double & d )
+{
+	m_doubleData = d;
+	m_isNull = false;
+	m_type = DataType::Double;
+}
+
+inline void
+Cell::setData( const Formula & f )
+{
+	m_formula = f;
+	m_isNull = false;
+	m_type = DataType::Formula;
+}
+
+inline void
+Cell::setSharedString( const std::wstring & s )
+{
+	m_stringData.clear();
+	m_sharedString = &s;
+	m_isNull = false;
+	m_type = DataType::String;
+}
+
+inline bool
+Cell::isNull() const
+{
+	return m_isNull;
+}
+
+
+//
+// CellValue
+//
+
+/*!
+	Compact value of the cell, 16 bytes: the double, or the pointer to
+	the string or to the formula, and the type of the data. The value
+	doesn't own strings and formulas, they are owned by the sheet (or by
+	the book for shared strings).
+*/
+class CellValue {
+public:
+	CellValue();
+	explicit CellValue( double d );
+	explicit CellValue( const std::wstring * s );
+	explicit CellValue( const Formula * f );
+
+	//! \return Data type.
+	Cell::DataType dataType() const;
+
+	//! \return String data, empty string if it's not a string.
+	const std::wstring & getString() const;
+
+	//! \return Double data, 0.0 if it's not a double.
+	double getDouble() const;
+
+	//! \return Formula, empty formula if it's not a formula.
+	const Formula & getFormula() const;
+
+	//! \return true if there is no data.
+	bool isNull() const;
+
+	/*!
+		\return Cell with the data. The string isn't copied, the cell
+		refers to it as to the shared string.
+	*/
+	Cell toCell() const;
+
+private:
+	//! Data.
+	union {
+		//! Double data.
+		double m_double;
+		//! String data.
+		const std::wstring * m_string;
+		//! Formula.
+		const Formula * m_formula;
+	};
+	//! Type of the data.
+	Cell::DataType m_type;
+}; // class CellValue
+
+static_assert( sizeof( CellValue ) == 16, "CellValue should be 16 bytes." );
+
+inline
+CellValue::CellValue()
+	:	m_double( 0.0 )
+	,	m_type( Cell::DataType::Unknown )
+{
+}
+
+inline
+CellValue::CellValue( double d )
+	:	m_double( d )
+	,	m_type( Cell::DataType::Double )
+{
+}
+
+inline
+CellValue::CellValue( const std::wstring * s )
+	:	m_string( s )
+	,	m_type( Cell::DataType::String )
+{
+}
+
+inline
+CellValue::CellValue( const Formula * f )
+	:	m_formula( f )
+	,	m_type( Cell::DataType::Formula )
+{
+}
+
+inline Cell::DataType
+CellValue::dataType() const
+{
+	return m_type;
+}
+
+inline const std::wstring &
+CellValue::getString() const
+{
+	static const std::wstring empty;
+
+	return ( m_type == Cell::DataType::String ? *m_string : empty );
+}
+
+inline double
+CellValue::getDouble() const
+{
+	return ( m_type == Cell::DataType::Double ? m_double : 0.0 );
+}
+
+inline const Formula &
+CellValue::getFormula() const
+{
+	static const Formula empty;
+
+	return ( m_type == Cell::DataType::Formula ? *m_formula : empty );
+}
+
+inline bool
+CellValue::isNull() const
+{
+	return ( m_type == Cell::DataType::Unknown );
+}
+
+inline Cell
+CellValue::toCell() const
+{
+	Cell cell;
+
+	switch( m_type )
+	{
+		case Cell::DataType::String :
+			cell.setSharedString( *m_string );
+			break;
+
+		case Cell::DataType::Double :
+			cell.setData( m_double );
+			break;
+
+		case Cell::DataType::Formula :
+			cell.setData( *m_formula );
+			break;
+
+		default :
+			break;
+	}
+
+	return cell;
+}
+
+} /* namespace Excel */
+
+#endif // EXCEL__CELL_HPP__INCLUDED
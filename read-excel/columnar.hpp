@@ -0,0 +1,579 @@
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef EXCEL__COLUMNAR_HPP__INCLUDED
+#define EXCEL__COLUMNAR_HPP__INCLUDED
+
+// Excel include.
+#include "book.hpp"
+#include "storage.hpp"
+#include "parser.hpp"
+#include "options.hpp"
+#include "formula.hpp"
+#include "dimension.hpp"
+#include "exceptions.hpp"
+#include "sst.hpp"
+
+// C++ include.
+#include <vector>
+#include <string>
+#include <memory>
+#include <sstream>
+#include <cstdint>
+#include <algorithm>
+
+
+namespace Excel {
+
+//
+// Column
+//
+
+/*!
+	Column of the columnar sheet. Each row of the column has the type,
+	the bit in the validity bitmap, the double and the index, so values
+	of one type may be processed as arrays. Indexes are indexes in the
+	shared string table for shared strings, in ColumnarSheet::strings()
+	for strings and in ColumnarSheet::formulas() for formulas.
+*/
+class Column {
+public:
+	//! Type of the value.
+	enum class Type : uint8_t {
+		//! No value.
+		Empty,
+		//! Double.
+		Double,
+		//! String from the shared string table.
+		SharedString,
+		//! String.
+		String,
+		//! Formula.
+		Formula
+	}; // enum class Type
+
+	Column();
+
+	//! \return Count of rows in the column, rows after the last value aren't stored.
+	size_t size() const;
+
+	//! \return Is there a value in the row.
+	bool isValid( size_t row ) const;
+
+	//! \return Type of the value in the row.
+	Type type( size_t row ) const;
+
+	//! \return Double in the row, 0.0 if it's not a double.
+	double getDouble( size_t row ) const;
+
+	//! \return Index of the value in the row, 0 if the value isn't indexed.
+	uint32_t index( size_t row ) const;
+
+	//! \return Doubles of the rows.
+	const std::vector< double > & doubles() const;
+
+	//! \return Indexes of the rows.
+	const std::vector< uint32_t > & indexes() const;
+
+	//! \return Types of the rows.
+	const std::vector< Type > & types() const;
+
+	//! \return Validity bitmap, bit ( row % 64 ) of the word ( row / 64 ).
+	const std::vector< uint64_t > & validity() const;
+
+	//! Set double.
+	void setDouble( size_t row, double value );
+
+	//! Set indexed value.
+	void setIndex( size_t row, Type type, uint32_t index );
+
+	//! Allocate rows.
+	void reserve( size_t rowsCount );
+
+private:
+	//! Resize column to have the row and mark the row as valid.
+	void initRow( size_t row );
+
+private:
+	//! Doubles.
+	std::vector< double > m_doubles;
+	//! Indexes.
+	std::vector< uint32_t > m_indexes;
+	//! Types.
+	std::vector< Type > m_types;
+	//! Validity bitmap.
+	std::vector< uint64_t > m_validity;
+}; // class Column
+
+inline
+Column::Column()
+{
+}
+
+inline size_t
+Column::size() const
+{
+	return m_types.size();
+}
+
+inline bool
+Column::isValid( size_t row ) const
+{
+	return ( row < m_types.size() && ( m_validity[ row / 64 ] >> ( row % 64 ) ) & 1 );
+}
+
+inline Column::Type
+Column::type( size_t row ) const
+{
+	return ( row < m_types.size() ? m_types[ row ] : Type::Empty );
+}
+
+inline double
+Column::getDouble( size_t row ) const
+{
+	return ( row < m_doubles.size() ? m_doubles[ row ] : 0.0 );
+}
+
+inline uint32_t
+Column::index( size_t row ) const
+{
+	return ( row < m_indexes.size() ? m_indexes[ row ] : 0 );
+}
+
+inline const std::vector< double > &
+Column::doubles() const
+{
+	return m_doubles;
+}
+
+inline const std::vector< uint32_t > &
+Column::indexes() const
+{
+	return m_indexes;
+}
+
+inline const std::vector< Column::Type > &
+Column::types() const
+{
+	return m_types;
+}
+
+inline const std::vector< uint64_t > &
+Column::validity() const
+{
+	return m_validity;
+}
+
+inline void
+Column::initRow( size_t row )
+{
+	if( row >= m_types.size() )
+	{
+		m_doubles.resize( row + 1, 0.0 );
+		m_indexes.resize( row + 1, 0 );
+		m_types.resize( row + 1, Type::Empty );
+		m_validity.resize( row / 64 + 1, 0 );
+	}
+
+	m_validity[ row / 64 ] |= ( static_cast< uint64_t > ( 1 ) << ( row % 64 ) );
+}
+
+inline void
+Column::setDouble( size_t row, double value )
+{
+	initRow( row );
+
+	m_doubles[ row ] = value;
+	m_indexes[ row ] = 0;
+	m_types[ row ] = Type::Double;
+}
+
+inline void
+Column::setIndex( size_t row, Type type, uint32_t index )
+{
+	initRow( row );
+
+	m_doubles[ row ] = 0.0;
+	m_indexes[ row ] = index;
+	m_types[ row ] = type;
+}
+
+inline void
+Column::reserve( size_t rowsCount )
+{
+	m_doubles.reserve( rowsCount );
+	m_indexes.reserve( rowsCount );
+	m_types.reserve( rowsCount );
+	m_validity.reserve( rowsCount / 64 + 1 );
+}
+
+
+//
+// ColumnarSheet
+//
+
+//! Sheet of ColumnarBook, cells are stored column by column.
+class ColumnarSheet {
+public:
+	explicit ColumnarSheet( const std::wstring & name );
+
+	//! \return Name of the sheet.
+	const std::wstring & sheetName() const;
+
+	//! \return Row's count.
+	size_t rowsCount() const;
+
+	//! \return Column's count.
+	size_t columnsCount() const;
+
+	//! \return Column, empty column if there is no such column.
+	const Column & column( size_t index ) const;
+
+	//! \return Strings of cells that are not in the shared string table.
+	const std::vector< std::wstring > & strings() const;
+
+	//! \return Formulas.
+	const std::vector< Formula > & formulas() const;
+
+	//! Set double.
+	void setDouble( size_t row, size_t column, double value );
+
+	//! Set string from the shared string table.
+	void setSharedString( size_t row, size_t column, size_t sstIndex );
+
+	//! Set string.
+	void setString( size_t row, size_t column, const std::wstring & value );
+
+	//! Set formula.
+	void setFormula( size_t row, size_t column, const Formula & value );
+
+	/*!
+		Allocate \a columnsCount columns with \a rowsCount rows in each,
+		counts of rows and columns of the sheet are not changed.
+	*/
+	void reserve( size_t rowsCount, size_t columnsCount );
+
+private:
+	//! \return Column for the cell, update counts of rows and columns.
+	Column & initCell( size_t row, size_t column );
+
+private:
+	//! Columns.
+	std::vector< Column > m_columns;
+	//! Strings.
+	std::vector< std::wstring > m_strings;
+	//! Formulas.
+	std::vector< Formula > m_formulas;
+	//! Empty column.
+	Column m_emptyColumn;
+	//! Row's count.
+	size_t m_rowsCount;
+	//! Name of the sheet.
+	std::wstring m_name;
+}; // class ColumnarSheet
+
+inline
+ColumnarSheet::ColumnarSheet( const std::wstring & name )
+	:	m_rowsCount( 0 )
+	,	m_name( name )
+{
+}
+
+inline const std::wstring &
+ColumnarSheet::sheetName() const
+{
+	return m_name;
+}
+
+inline size_t
+ColumnarSheet::rowsCount() const
+{
+	return m_rowsCount;
+}
+
+inline size_t
+ColumnarSheet::columnsCount() const
+{
+	return m_columns.size();
+}
+
+inline const Column &
+ColumnarSheet::column( size_t index ) const
+{
+	return ( index < m_columns.size() ? m_columns[ index ] : m_emptyColumn );
+}
+
+inline const std::vector< std::wstring > &
+ColumnarSheet::strings() const
+{
+	return m_strings;
+}
+
+inline const std::vector< Formula > &
+ColumnarSheet::formulas() const
+{
+	return m_formulas;
+}
+
+inline Column &
+ColumnarSheet::initCell( size_t row, size_t column )
+{
+	if( column >= m_columns.size() )
+		m_columns.resize( column + 1 );
+
+	m_rowsCount = std::max( m_rowsCount, row + 1 );
+
+	return m_columns[ column ];
+}
+
+inline void
+ColumnarSheet::setDouble( size_t row, size_t column, double value )
+{
+	initCell( row, column ).setDouble( row, value );
+}
+
+inline void
+ColumnarSheet::setSharedString( size_t row, size_t column, size_t sstIndex )
+{
+	initCell( row, column ).setIndex( row, Column::Type::SharedString,
+		static_cast< uint32_t > ( sstIndex ) );
+}
+
+inline void
+ColumnarSheet::setString( size_t row, size_t column, const std::wstring & value )
+{
+	m_strings.push_back( value );
+
+	initCell( row, column ).setIndex( row, Column::Type::String,
+		static_cast< uint32_t > ( m_strings.size() - 1 ) );
+}
+
+inline void
+ColumnarSheet::setFormula( size_t row, size_t column, const Formula & value )
+{
+	m_formulas.push_back( value );
+
+	initCell( row, column ).setIndex( row, Column::Type::Formula,
+		static_cast< uint32_t > ( m_formulas.size() - 1 ) );
+}
+
+inline void
+ColumnarSheet::reserve( size_t rowsCount, size_t columnsCount )
+{
+	if( rowsCount == 0 || columnsCount == 0 ||
+		rowsCount > c_maxReservedCells / columnsCount )
+			return;
+
+	if( m_columns.size() < columnsCount )
+		m_columns.resize( columnsCount );
+
+	for( auto & column : m_columns )
+		column.reserve( rowsCount );
+}
+
+
+//
+// ColumnarBook
+//
+
+/*!
+	Excel WorkBook with cells stored column by column, each column as
+	arrays of doubles, indexes, types and the validity bitmap. It suits
+	analytical processing of big sheets better than Book.
+*/
+class ColumnarBook : public IStorage {
+public:
+	ColumnarBook();
+	explicit ColumnarBook( std::istream & stream,
+		const LoadOptions & options = LoadOptions() );
+	explicit ColumnarBook( const std::string & fileName,
+		const LoadOptions & options = LoadOptions() );
+	//! Load book from memory block, the data is read in place and isn't needed after loading.
+	ColumnarBook( const void * data, size_t size,
+		const LoadOptions & options = LoadOptions() );
+
+protected:
+	SharedStringTable * sharedStringTable() override;
+	void onSharedString( size_t sstSize, size_t idx, const std::wstring & value ) override;
+	void onDateMode( uint16_t mode ) override;
+	void onSheet( size_t idx, const std::wstring & name ) override;
+	void onCellSharedString( size_t sheetIdx, size_t row, size_t column, size_t sstIndex ) override;
+	void onCell( size_t sheetIdx, size_t row, size_t column, const std::wstring & value ) override;
+	void onCell( size_t sheetIdx, size_t row, size_t column, double value ) override;
+	void onCell( size_t sheetIdx, const Formula & value ) override;
+	void onSheetDimension( size_t sheetIdx, const Dimension & dimension ) override;
+	void onCells( size_t sheetIdx, size_t row, size_t firstColumn,
+		const double * values, size_t count ) override;
+
+public:
+	//! \return Date mode.
+	Book::DateMode dateMode() const;
+
+	//! \return Count of the sheets.
+	size_t sheetsCount() const;
+
+	//! \return Sheet with given index,
+	//! or NULL if the sheet wasn't loaded.
+	ColumnarSheet * sheet( size_t index ) const;
+
+	//! \return Shared string table.
+	const SharedStringTable & sharedStrings() const;
+
+	//! Clear book.
+	void clear();
+
+private:
+	//! Parsed WorkSheets.
+	std::vector< std::unique_ptr< ColumnarSheet > > m_sheets;
+	//! Shared string table.
+	SharedStringTable m_sst;
+	//! Date mode.
+	Book::DateMode m_dateMode;
+}; // class ColumnarBook
+
+inline
+ColumnarBook::ColumnarBook()
+	:	m_dateMode( Book::DateMode::Unknown )
+{
+}
+
+inline
+ColumnarBook::ColumnarBook( std::istream & stream, const LoadOptions & options )
+	:	m_dateMode( Book::DateMode::Unknown )
+{
+	Parser::loadBook( stream, *this, "<custom-stream>", options );
+}
+
+inline
+ColumnarBook::ColumnarBook( const std::string & fileName, const LoadOptions & options )
+	:	m_dateMode( Book::DateMode::Unknown )
+{
+	Parser::loadBook( fileName, *this, options );
+}
+
+inline
+ColumnarBook::ColumnarBook( const void * data, size_t size, const LoadOptions & options )
+	:	m_dateMode( Book::DateMode::Unknown )
+{
+	Parser::loadBook( data, size, *this, "<memory-buffer>", options );
+}
+
+inline void
+ColumnarBook::clear()
+{
+	m_sheets.clear();
+	m_sst.clear();
+}
+
+inline Book::DateMode
+ColumnarBook::dateMode() const
+{
+	return m_dateMode;
+}
+
+inline const SharedStringTable &
+ColumnarBook::sharedStrings() const
+{
+	return m_sst;
+}
+
+inline SharedStringTable *
+ColumnarBook::sharedStringTable()
+{
+	return &m_sst;
+}
+
+inline void
+ColumnarBook::onSharedString( size_t sstSize, size_t idx, const std::wstring & value )
+{
+	if( idx == 0 )
+	{
+		m_sst.clear();
+		m_sst.reserve( sstSize );
+	}
+
+	m_sst.append( value );
+}
+
+inline void
+ColumnarBook::onDateMode( uint16_t mode )
+{
+	if( mode )
+		m_dateMode = Book::DateMode::Jan01_1904;
+	else
+		m_dateMode = Book::DateMode::Dec31_1899;
+}
+
+inline void
+ColumnarBook::onSheet( size_t idx, const std::wstring & name )
+{
+	auto sheet = std::make_unique< ColumnarSheet > ( name );
+	if( m_sheets.size() <= idx )
+		m_sheets.resize( idx + 1 );
+	m_sheets[ idx ] = std::move( sheet );
+}
+
+inline void
+ColumnarBook::onCellSharedString( size_t sheetIdx, size_t row, size_t column, size_t sstIndex )
+{
+	sheet( sheetIdx )->setSharedString( row, column, sstIndex );
+}
+
+inline void
+ColumnarBook::onCell( size_t sheetIdx, size_t row, size_t column, const std::wstring & value )
+{
+	sheet( sheetIdx )->setString( row, column, value );
+}
+
+inline void
+ColumnarBook::onCell( size_t sheetIdx, size_t row, size_t column, double value )
+{
+	sheet( sheetIdx )->setDouble( row, column, value );
+}
+
+inline void
+ColumnarBook::onCell( size_t sheetIdx, const Formula & formula )
+{
+	sheet( sheetIdx )->setFormula( formula.getRow(), formula.getColumn(), formula );
+}
+
+inline void
+ColumnarBook::onSheetDimension( size_t sheetIdx, const Dimension & dimension )
+{
+	sheet( sheetIdx )->reserve( dimension.rowsCount(), dimension.columnsCount() );
+}
+
+inline void
+ColumnarBook::onCells( size_t sheetIdx, size_t row, size_t firstColumn,
+	const double * values, size_t count )
+{
+	auto * s = sheet( sheetIdx );
+
+	for( size_t i = 0; i < count; ++i )
+		s->setDouble( row, firstColumn + i, values[ i ] );
+}
+
+inline size_t
+ColumnarBook::sheetsCount() const
+{
+	return m_sheets.size();
+}
+
+inline ColumnarSheet *
+ColumnarBook::sheet( size_t index ) const
+{
+	if( index < m_sheets.size() )
+		return m_sheets[ index ].get();
+
+	std::wstringstream stream;
+	stream << L"There is no such sheet with index : " << index;
+
+	throw Exception( stream.str() );
+}
+
+} /* namespace Excel */
+
+#endif // EXCEL__COLUMNAR_HPP__INCLUDED
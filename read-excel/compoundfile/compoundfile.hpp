@@ -1,234 +1,433 @@
-
-/*
-	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
-	SPDX-License-Identifier: MIT
-*/
-
-#ifndef COMPOUNDFILE__COMPOUNDFILE_HPP__INCLUDED
-#define COMPOUNDFILE__COMPOUNDFILE_HPP__INCLUDED
-
-// CompoundFile include.
-#include "compoundfile_stream_and_dir.hpp"
-#include "header.hpp"
-#include "sat.hpp"
-#include "msat.hpp"
-#include "utils.hpp"
-#include "compoundfile_exceptions.hpp"
-
-// C++ include.
-#include <string>
-#include <fstream>
-#include <memory>
-#include <map>
-
-
-namespace CompoundFile {
-
-//
-// File
-//
-
-//! Compound file.
-class File {
-public:
-	explicit File( std::istream & stream, const std::string & fileName = "<custom-stream>" );
-	explicit File( const std::string & fileName );
-	~File();
-
-	//! \return Directory entry by its name.
-	Directory directory( const std::wstring & name ) const;
-
-	//! \return is Directory entry exist by its name.
-	bool hasDirectory( const std::wstring & name ) const;
-
-	//! \return Stream in the directory.
-	std::unique_ptr< Excel::Stream > stream( const Directory & dir );
-
-private:
-	//! Read stream and initialize m_dirs.
-    void initialize( const std::string& fileName );
-
-private:
-	//! Inner file stream.
-	std::ifstream m_fileStream;
-	//! Stream.
-	std::istream & m_stream;
-	//! Header of the compound file.
-	Header m_header;
-	//! SAT.
-	SAT m_sat;
-	//! SSAT.
-	SAT m_ssat;
-	//! SecID of the first sector of the short-sector stream.
-	SecID m_shortStreamFirstSector;
-	//! All directories defined in the compound file.
-	std::map< int32_t, Directory > m_dirs;
-}; // class File
-
-
-//
-// loadSSAT
-//
-
-inline SAT
-loadSSAT( const Header & header, std::istream & stream,
-	const SAT & sat )
-{
-	std::vector< SecID > ssat;
-
-	if( header.ssatFirstSecID() != SecID::EndOfChain )
-	{
-		std::vector< SecID > chain = sat.sectors( header.ssatFirstSecID() );
-
-		for( std::vector< SecID >::const_iterator it = chain.begin(),
-			last = chain.end(); it != last; ++it )
-		{
-			stream.seekg( calcFileOffset( *it, header.sectorSize() ) );
-
-			loadSATSector( stream, ssat, header.sectorSize() );
-		}
-	}
-
-	return SAT( ssat );
-} // loadSSAT
-
-
-//! Size of the dir record.
-static const int32_t dirRecordSize = 128;
-
-
-//
-// loadChildDir
-//
-
-inline Directory *
-loadChildDir( std::map< int32_t, Directory > & dirs,
-	int32_t dirID, Stream & stream )
-{
-	if( dirID != -1 && dirs.count(dirID) == 0 )
-	{
-		stream.seek( dirID * dirRecordSize, Stream::FromBeginning );
-
-		Directory dir;
-		dir.load( stream );
-
-		dirs[ dirID ] = dir;
-
-		return &dirs[ dirID ];
-	}
-
-	return nullptr;
-} // loadChildDir
-
-
-//
-// loadChildDirectories
-//
-
-inline void
-loadChildDirectories( std::map< int32_t, Directory > & dirs,
-	const Directory parentDir, Stream & stream )
-{
-	Directory * childDir = nullptr;
-	if ( ( childDir = loadChildDir( dirs, parentDir.leftChild(), stream ) ) )
-		loadChildDirectories( dirs, *childDir, stream );
-	if ( ( childDir = loadChildDir( dirs, parentDir.rightChild(), stream ) ) )
-		loadChildDirectories( dirs, *childDir, stream );
-} // loadChildDirectories
-
-
-//
-// File
-//
-
-inline
-File::File( std::istream & stream, const std::string & fileName )
-	:	m_stream( stream )
-{
-	initialize( fileName );
-}
-
-inline
-File::File( const std::string & fileName )
-	:	m_fileStream( fileName, std::ios::in | std::ios::binary )
-	,	m_stream( m_fileStream )
-	
-{
-	initialize( fileName );
-}
-
-inline
-File::~File()
-{
-	m_fileStream.close();
-}
-
-inline Directory
-File::directory( const std::wstring & name ) const
-{
-	for( std::map< int32_t, Directory >::const_iterator it = m_dirs.begin(),
-		last = m_dirs.end(); it != last; ++it )
-	{
-		if( it->second.name() == name )
-			return it->second;
-	}
-
-	throw Exception( std::wstring( L"There is no such directory : " ) + name );
-}
-
-inline bool
-File::hasDirectory( const std::wstring & name ) const
-{
-	for( std::map< int32_t, Directory >::const_iterator it = m_dirs.begin(),
-		last = m_dirs.end(); it != last; ++it )
-	{
-		if ( it->second.name() == name )
-			return true;
-	}
-
-	return false;
-}
-
-inline std::unique_ptr< Excel::Stream >
-File::stream( const Directory & dir )
-{
-	return std::make_unique< CompoundFile::Stream > ( m_header,
-		m_sat, m_ssat, dir, m_shortStreamFirstSector, m_stream );
-}
-
-inline void
-File::initialize( const std::string & fileName )
-{
-	if( m_stream.good() )
-	{
-		m_header.load( m_stream );
-
-		MSAT msat( m_header, m_stream );
-		m_sat = msat.buildSAT();
-
-		m_ssat = loadSSAT( m_header, m_stream, m_sat );
-
-		Stream stream( m_header, m_sat, m_header.dirStreamSecID(), m_stream );
-
-		Directory root;
-		root.load( stream );
-
-		m_shortStreamFirstSector = root.streamSecID();
-
-		stream.seek( root.rootNode() * dirRecordSize, Stream::FromBeginning );
-
-		Directory rootEntry;
-		rootEntry.load( stream );
-
-		m_dirs[ root.rootNode() ] = rootEntry;
-
-		loadChildDirectories( m_dirs, rootEntry, stream );
-	}
-	else
-		throw Exception( std::wstring( L"Unable to open file : " ) +
-			std::wstring( fileName.cbegin(), fileName.cend() ) );
-}
-
-} /* namespace CompoundFile */
-
-#endif // COMPOUNDFILE__COMPOUNDFILE_HPP__INCLUDED
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef COMPOUNDFILE__COMPOUNDFILE_HPP__INCLUDED
+#define COMPOUNDFILE__COMPOUNDFILE_HPP__INCLUDED
+
+// CompoundFile include.
+#include "compoundfile_stream_and_dir.hpp"
+#include "header.hpp"
+#include "sat.hpp"
+#include "msat.hpp"
+#include "utils.hpp"
+#include "mapped_file.hpp"
+#include "compoundfile_exceptions.hpp"
+
+// C++ include.
+#include <string>
+#include <fstream>
+#include <memory>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+
+namespace CompoundFile {
+
+//
+// File
+//
+
+//! Compound file.
+class File {
+public:
+	explicit File( std::istream & stream, const std::string & fileName = "<custom-stream>" );
+	/*!
+		The file is memory mapped if the platform allows it, and sectors
+		are read in place from the mapping. Otherwise the file is read
+		through std::ifstream.
+	*/
+	explicit File( const std::string & fileName );
+	/*!
+		Compound file in the memory block of \a size bytes. The data is not
+		copied, sectors are read in place from it, so the data should
+		outlive the file and streams opened from it.
+	*/
+	File( const void * data, size_t size,
+		const std::string & fileName = "<memory-buffer>" );
+	~File();
+
+	//! \return Is the file memory mapped.
+	bool isMapped() const;
+
+	//! \return Is the whole file available in memory.
+	bool isInMemory() const;
+
+	//! \return Directory entry by its name.
+	Directory directory( const std::wstring & name ) const;
+
+	//! \return is Directory entry exist by its name.
+	bool hasDirectory( const std::wstring & name ) const;
+
+	/*!
+		\return Directory entry by its name or nullptr if there is no such
+		entry. The pointer is valid while the file lives.
+	*/
+	const Directory * findDirectory( const std::wstring & name ) const;
+
+	//! \return Names of all directory entries.
+	std::vector< std::wstring > directoryNames() const;
+
+	//! \return Stream in the directory.
+	std::unique_ptr< Excel::Stream > stream( const Directory & dir );
+
+	//! \return Stream in the directory with the given name.
+	std::unique_ptr< Excel::Stream > stream( const std::wstring & name );
+
+private:
+	//! Read stream and initialize m_dirs.
+    void initialize( const std::string& fileName );
+
+	//! Open inner file stream.
+	std::istream & openFileStream( const std::string & fileName );
+
+	//! Load short-sector stream into memory if it's not loaded yet.
+	void loadShortStream();
+
+	/*!
+		\return Data of the whole stream, read in place if possible or
+		into \a buffer otherwise.
+	*/
+	static const char * readWholeStream( Stream & stream, std::vector< char > & buffer );
+
+private:
+	//! Memory mapping of the file.
+	MappedFile m_mapping;
+	//! Data of the whole file if it's in memory.
+	const char * m_fileData;
+	//! Size of the file's data.
+	size_t m_fileSize;
+	//! Inner file stream.
+	std::ifstream m_fileStream;
+	//! Stream buffer over the file's data.
+	MemoryStreamBuffer m_memoryBuffer;
+	//! Stream over the file's data.
+	std::istream m_memoryStream;
+	//! Stream.
+	std::istream & m_stream;
+	//! Header of the compound file.
+	Header m_header;
+	//! SAT.
+	SAT m_sat;
+	//! SSAT.
+	SAT m_ssat;
+	//! Resolved chains of sectors in SAT.
+	ChainsCache m_satChains;
+	//! Resolved chains of sectors in SSAT.
+	ChainsCache m_ssatChains;
+	//! SecID of the first sector of the short-sector stream.
+	SecID m_shortStreamFirstSector;
+	//! All directories defined in the compound file.
+	std::map< int32_t, Directory > m_dirs;
+	//! Index of directories by their names.
+	std::unordered_map< std::wstring, const Directory * > m_names;
+	//! Short-sector stream if it's not available in place in the file's data.
+	std::vector< char > m_shortStream;
+	//! Data of the short-sector stream.
+	const char * m_shortStreamData;
+	//! Size of the short-sector stream.
+	size_t m_shortStreamSize;
+	//! Is short-sector stream loaded.
+	bool m_isShortStreamLoaded;
+}; // class File
+
+
+//
+// loadSSAT
+//
+
+inline SAT
+loadSSAT( const Header & header, std::istream & stream,
+	const SAT & sat )
+{
+	std::vector< SecID > ssat;
+
+	if( header.ssatFirstSecID() != SecID::EndOfChain )
+		loadSATSectors( stream, ssat, sat.sectors( header.ssatFirstSecID() ),
+			header.sectorSize() );
+
+	return SAT( ssat );
+} // loadSSAT
+
+
+//
+// loadDirectories
+//
+
+/*!
+	Load the root entry and the tree of its children from the data of the
+	directory stream. The tree is walked iteratively, the tree with loops
+	or with DirIDs out of the directory stream is rejected.
+*/
+inline void
+loadDirectories( const char * data, size_t size, Excel::Stream::ByteOrder byteOrder,
+	Directory & root, std::map< int32_t, Directory > & dirs )
+{
+	const size_t count = size / dirRecordSize;
+
+	if( count == 0 )
+		throw Exception( L"There is no root entry in the directory." );
+
+	root.load( data, byteOrder );
+
+	std::vector< bool > visited( count, false );
+	visited[ 0 ] = true;
+
+	std::vector< int32_t > ids;
+	ids.push_back( root.rootNode() );
+
+	while( !ids.empty() )
+	{
+		const int32_t id = ids.back();
+		ids.pop_back();
+
+		if( id == -1 )
+			continue;
+
+		if( id < 0 || static_cast< size_t > ( id ) >= count )
+			throw Exception( L"Wrong DirID in the directory tree." );
+
+		if( visited[ id ] )
+			throw Exception( L"Loop in the directory tree." );
+
+		visited[ id ] = true;
+
+		Directory & dir = dirs[ id ];
+		dir.load( data + static_cast< size_t > ( id ) * dirRecordSize, byteOrder );
+
+		ids.push_back( dir.rightChild() );
+		ids.push_back( dir.leftChild() );
+	}
+} // loadDirectories
+
+
+//
+// File
+//
+
+inline
+File::File( std::istream & stream, const std::string & fileName )
+	:	m_fileData( nullptr )
+	,	m_fileSize( 0 )
+	,	m_memoryBuffer( nullptr, 0 )
+	,	m_memoryStream( &m_memoryBuffer )
+	,	m_stream( stream )
+	,	m_satChains( m_sat )
+	,	m_ssatChains( m_ssat )
+	,	m_shortStreamData( nullptr )
+	,	m_shortStreamSize( 0 )
+	,	m_isShortStreamLoaded( false )
+{
+	initialize( fileName );
+}
+
+inline
+File::File( const std::string & fileName )
+	:	m_mapping( fileName )
+	,	m_fileData( m_mapping.data() )
+	,	m_fileSize( m_mapping.size() )
+	,	m_memoryBuffer( m_fileData, m_fileSize )
+	,	m_memoryStream( &m_memoryBuffer )
+	,	m_stream( m_mapping.isMapped() ? m_memoryStream : openFileStream( fileName ) )
+	,	m_satChains( m_sat )
+	,	m_ssatChains( m_ssat )
+	,	m_shortStreamData( nullptr )
+	,	m_shortStreamSize( 0 )
+	,	m_isShortStreamLoaded( false )
+{
+	initialize( fileName );
+}
+
+inline
+File::File( const void * data, size_t size, const std::string & fileName )
+	:	m_fileData( static_cast< const char * > ( data ) )
+	,	m_fileSize( size )
+	,	m_memoryBuffer( m_fileData, m_fileSize )
+	,	m_memoryStream( &m_memoryBuffer )
+	,	m_stream( m_memoryStream )
+	,	m_satChains( m_sat )
+	,	m_ssatChains( m_ssat )
+	,	m_shortStreamData( nullptr )
+	,	m_shortStreamSize( 0 )
+	,	m_isShortStreamLoaded( false )
+{
+	initialize( fileName );
+}
+
+inline
+File::~File()
+{
+	m_fileStream.close();
+}
+
+inline bool
+File::isMapped() const
+{
+	return m_mapping.isMapped();
+}
+
+inline bool
+File::isInMemory() const
+{
+	return ( m_fileData != nullptr );
+}
+
+inline std::istream &
+File::openFileStream( const std::string & fileName )
+{
+	m_fileStream.open( fileName, std::ios::in | std::ios::binary );
+
+	return m_fileStream;
+}
+
+inline Directory
+File::directory( const std::wstring & name ) const
+{
+	const Directory * dir = findDirectory( name );
+
+	if( dir )
+		return *dir;
+
+	throw Exception( std::wstring( L"There is no such directory : " ) + name );
+}
+
+inline bool
+File::hasDirectory( const std::wstring & name ) const
+{
+	return ( m_names.find( name ) != m_names.cend() );
+}
+
+inline const Directory *
+File::findDirectory( const std::wstring & name ) const
+{
+	const auto it = m_names.find( name );
+
+	if( it != m_names.cend() )
+		return it->second;
+
+	return nullptr;
+}
+
+inline std::vector< std::wstring >
+File::directoryNames() const
+{
+	std::vector< std::wstring > names;
+	names.reserve( m_dirs.size() );
+
+	for( const auto & dir : m_dirs )
+		names.push_back( dir.second.name() );
+
+	return names;
+}
+
+inline std::unique_ptr< Excel::Stream >
+File::stream( const std::wstring & name )
+{
+	return stream( directory( name ) );
+}
+
+inline std::unique_ptr< Excel::Stream >
+File::stream( const Directory & dir )
+{
+	if( dir.streamSize() < m_header.streamMinSize() )
+	{
+		loadShortStream();
+
+		if( m_shortStreamData )
+			return std::unique_ptr< Excel::Stream > ( new CompoundFile::Stream(
+				m_header, m_ssatChains.sectors( dir.streamSecID() ),
+				m_header.shortSectorSize(), dir.streamSize(), 0, m_stream,
+				m_shortStreamData, m_shortStreamSize ) );
+
+		return std::make_unique< CompoundFile::Stream > ( m_header,
+			m_sat, m_ssat, dir, m_shortStreamFirstSector, m_stream,
+			m_fileData, m_fileSize );
+	}
+
+	return std::unique_ptr< Excel::Stream > ( new CompoundFile::Stream(
+		m_header, m_satChains.sectors( dir.streamSecID() ),
+		m_header.sectorSize(), dir.streamSize(),
+		calcFileOffset( 0, m_header.sectorSize() ), m_stream,
+		m_fileData, m_fileSize ) );
+}
+
+inline void
+File::loadShortStream()
+{
+	if( m_isShortStreamLoaded )
+		return;
+
+	m_isShortStreamLoaded = true;
+
+	if( m_shortStreamFirstSector < 0 )
+		return;
+
+	Stream stream( m_header, m_satChains.sectors( m_shortStreamFirstSector ),
+		m_header.sectorSize(), -1, calcFileOffset( 0, m_header.sectorSize() ),
+		m_stream, m_fileData, m_fileSize );
+
+	m_shortStreamSize = static_cast< size_t > ( stream.m_streamSize );
+	m_shortStreamData = readWholeStream( stream, m_shortStream );
+}
+
+inline const char *
+File::readWholeStream( Stream & stream, std::vector< char > & buffer )
+{
+	const size_t size = static_cast< size_t > ( stream.m_streamSize );
+
+	const char * data = stream.readInPlace( size );
+
+	if( !data && size )
+	{
+		buffer.resize( size );
+
+		stream.read( &buffer[ 0 ], size );
+
+		data = &buffer[ 0 ];
+	}
+
+	return data;
+}
+
+inline void
+File::initialize( const std::string & fileName )
+{
+	if( m_stream.good() )
+	{
+		m_header.load( m_stream );
+
+		MSAT msat( m_header, m_stream );
+		m_sat = msat.buildSAT();
+
+		m_ssat = loadSSAT( m_header, m_stream, m_sat );
+
+		Stream stream( m_header, m_sat, m_header.dirStreamSecID(), m_stream,
+			m_fileData, m_fileSize );
+
+		std::vector< char > buffer;
+		const size_t size = static_cast< size_t > ( stream.m_streamSize );
+		const char * data = readWholeStream( stream, buffer );
+
+		Directory root;
+
+		loadDirectories( data, size, m_header.byteOrder(), root, m_dirs );
+
+		m_shortStreamFirstSector = root.streamSecID();
+
+		m_names.reserve( m_dirs.size() );
+
+		// The first entry wins if names are duplicated.
+		for( const auto & dir : m_dirs )
+			m_names.emplace( dir.second.name(), &dir.second );
+	}
+	else
+		throw Exception( std::wstring( L"Unable to open file : " ) +
+			std::wstring( fileName.cbegin(), fileName.cend() ) );
+}
+
+} /* namespace CompoundFile */
+
+#endif // COMPOUNDFILE__COMPOUNDFILE_HPP__INCLUDED
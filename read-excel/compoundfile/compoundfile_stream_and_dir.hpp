@@ -1,543 +1,834 @@
-
-/*
-	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
-	SPDX-License-Identifier: MIT
-*/
-
-#ifndef COMPOUNDFILE__STREAM_HPP__INCLUDED
-#define COMPOUNDFILE__STREAM_HPP__INCLUDED
-
-// CompoundFile include.
-#include "header.hpp"
-#include "sat.hpp"
-#include "utils.hpp"
-
-// Excel include.
-#include "../stream.hpp"
-
-// C++ include.
-#include <iostream>
-#include <string>
-
-
-namespace CompoundFile {
-
-class Stream;
-
-
-//
-// Directory
-//
-
-//! Directory in a compound file.
-class Directory {
-public:
-	Directory();
-
-	//! Type of the entry.
-	enum Type {
-		//! Empty.
-		Empty = 0x00,
-		//! User storage.
-		UserStorage = 0x01,
-		//! User stream.
-		UserStream = 0x02,
-		//! LockBytes.
-		LockBytes = 0x03,
-		//! Property.
-		Property = 0x04,
-		//! Root storage.
-		RootStorage = 0x05
-	}; // enum Type
-
-	//! \return Name of the directory.
-	const std::wstring & name() const;
-
-	//! \return Type of the directory.
-	Type type() const;
-
-	//! \return SecID of the first sector.
-	SecID streamSecID() const;
-
-	//! \return Stream size.
-	int32_t streamSize() const;
-
-	//! \return DirID of the right child node.
-	int32_t rightChild() const;
-
-	//! \return DirID of the left child node.
-	int32_t leftChild() const;
-
-	//! \return DirID of the root node.
-	int32_t rootNode() const;
-
-	//! Load directory.
-	void load( Stream & stream );
-
-private:
-	//! Name of the directory.
-	std::wstring m_name;
-	//! Type of the directory.
-	Type m_type;
-	//! SecID of the first sector.
-	SecID m_secID;
-	//! Stream size.
-	int32_t m_streamSize;
-	//! DirID of the right child node.
-	int32_t m_rightChild;
-	//! DirID of the left child node.
-	int32_t m_leftChild;
-	//! DirID of the root node.
-	int32_t m_rootNode;
-}; // class Directory
-
-
-//
-// Stream
-//
-
-//! Stream in a compound file.
-class Stream
-	:	public Excel::Stream
-{
-
-	friend class File;
-
-protected:
-	Stream( const Header & header,
-		const SAT & sat,
-		const SecID & secID,
-		std::istream & stream );
-
-public:
-	Stream( const Header & header,
-		const SAT & sat,
-		const SAT & ssat,
-		const Directory & dir,
-		const SecID & shortStreamFirstSector,
-		std::istream & cstream );
-
-	//! Read one byte from the stream.
-	char getByte() override;
-
-	//! \return true if EOF reached.
-	bool eof() const override;
-
-	//! Seek stream to new position.
-	void seek( int32_t pos, SeekType type = FromBeginning ) override;
-
-	//! \return Position in the stream.
-	int32_t pos() override;
-
-private:
-	//! Seek internal stream to the next sector.
-	void seekToNextSector();
-	//! \return Offset in sectors from the beginning of the large
-	//! stream sector.
-	int32_t whereIsShortSector( const SecID & shortSector,
-		SecID & largeSector );
-
-private:
-	//! Header.
-	const Header & m_header;
-	//! Large stream sectors chain.
-	std::vector< SecID > m_largeStreamChain;
-	//! Short stream sectors chain.
-	std::vector< SecID > m_shortStreamChain;
-	//! File's stream.
-	std::istream & m_stream;
-
-	//! Mode of the stream.
-	enum Mode {
-		//! Large stream mode.
-		LargeStream,
-		//! Short stream mode.
-		ShortStream
-	}; // enum Mode
-
-	//! Mode of the stream.
-	Mode m_mode;
-	//! Bytes readed from the stream.
-	int32_t m_bytesReaded;
-	//! Size of the sector for this stream.
-	int32_t m_sectorSize;
-	//! Bytes readed from the current sector.
-	int32_t m_sectorBytesReaded;
-	//! Current SecID in the short stream.
-	int32_t m_shortSecIDIdx;
-	//! Current SecID in the large stream.
-	int32_t m_largeSecIDIdx;
-	//! Size of the stream.
-	int32_t m_streamSize;
-
-	//! Buffer.
-	std::vector< char > m_buf;
-	//! Posiztion in buffer.
-	int32_t m_pos;
-	//! Current large sector ID.
-	SecID m_currentLargeSectorID;
-}; // class Stream
-
-inline
-Stream::Stream( const Header & header,
-	const SAT & sat,
-	const SecID & secID,
-	std::istream & stream )
-	:	Excel::Stream( header.byteOrder() )
-	,	m_header( header )
-	,	m_stream( stream )
-	,	m_mode( LargeStream )
-	,	m_bytesReaded( 0 )
-	,	m_sectorSize( m_header.sectorSize() )
-	,	m_sectorBytesReaded( 0 )
-	,	m_shortSecIDIdx( 0 )
-	,	m_largeSecIDIdx( 0 )
-	,	m_streamSize( 0 )
-	,	m_pos( 0 )
-{
-	m_largeStreamChain = sat.sectors( secID );
-
-	m_stream.seekg( calcFileOffset( m_largeStreamChain.front(),
-		m_sectorSize ) );
-
-	m_currentLargeSectorID = m_largeStreamChain.front();
-
-	m_streamSize = static_cast< int32_t > ( m_largeStreamChain.size() ) * m_sectorSize;
-
-	m_buf.resize( m_sectorSize );
-
-	m_stream.read( &m_buf[ 0 ], m_sectorSize );
-}
-
-inline
-Stream::Stream( const Header & header,
-	const SAT & sat,
-	const SAT & ssat,
-	const Directory & dir,
-	const SecID & shortStreamFirstSector,
-	std::istream & cstream )
-	:	Excel::Stream( header.byteOrder() )
-	,	m_header( header )
-	,	m_stream( cstream )
-	,	m_mode(
-		( dir.streamSize() < m_header.streamMinSize() ? ShortStream : LargeStream ) )
-	,	m_bytesReaded( 0 )
-	,	m_sectorSize(
-		( dir.streamSize() < m_header.streamMinSize() ?
-			m_header.shortSectorSize() : m_header.sectorSize() ) )
-	,	m_sectorBytesReaded( 0 )
-	,	m_shortSecIDIdx( 0 )
-	,	m_largeSecIDIdx( 0 )
-	,	m_streamSize( dir.streamSize() )
-	,	m_pos( 0 )
-{
-	m_buf.resize( m_header.sectorSize() );
-
-	if( m_mode == LargeStream )
-	{
-		m_largeStreamChain = sat.sectors( dir.streamSecID() );
-		m_stream.seekg( calcFileOffset( m_largeStreamChain.front(),
-			m_header.sectorSize() ) );
-		m_currentLargeSectorID = m_largeStreamChain.front();
-
-		m_stream.read( &m_buf[ 0 ], m_sectorSize );
-	}
-	else
-	{
-		m_largeStreamChain = sat.sectors( shortStreamFirstSector );
-		m_shortStreamChain = ssat.sectors( dir.streamSecID() );
-
-		SecID largeSector;
-		const int32_t offset = whereIsShortSector( dir.streamSecID(),
-			largeSector );
-
-		m_currentLargeSectorID = largeSector;
-
-		std::streampos pos = calcFileOffset( largeSector,
-			m_header.sectorSize() );
-
-		m_stream.seekg( pos );
-
-		m_stream.read( &m_buf[ 0 ], m_header.sectorSize() );
-
-		m_pos = offset * m_header.shortSectorSize();
-	}
-}
-
-inline bool
-Stream::eof() const
-{
-	return ( m_bytesReaded > m_streamSize );
-}
-
-inline void
-Stream::seek( int32_t pos, SeekType type )
-{
-	if( type == FromCurrent )
-	{
-		pos += m_bytesReaded;
-
-		if( pos < 0 )
-			pos += m_streamSize;
-	}
-	else if( type == FromEnd && pos > 0 )
-		pos = m_streamSize - pos;
-	else if( type == FromEnd && pos < 0 )
-		pos = std::abs( pos );
-	else if( type == FromBeginning && pos < 0 )
-		pos = m_streamSize - pos;
-
-	if( pos >= m_streamSize )
-	{
-		m_bytesReaded = m_streamSize;
-		return;
-	}
-
-	const int32_t offset = pos % m_sectorSize;
-	const int32_t sectorIdx = pos / m_sectorSize;
-
-	m_bytesReaded = pos;
-	m_sectorBytesReaded = offset;
-
-	if( m_mode == LargeStream )
-	{
-		m_largeSecIDIdx = sectorIdx;
-
-		if( m_currentLargeSectorID != m_largeStreamChain.at( m_largeSecIDIdx ) )
-		{
-			m_currentLargeSectorID = m_largeStreamChain.at( m_largeSecIDIdx );
-
-			m_stream.seekg( calcFileOffset( m_largeStreamChain.at( m_largeSecIDIdx ),
-				m_sectorSize ), std::ios::beg );
-
-			m_stream.read( &m_buf[ 0 ], m_sectorSize );
-		}
-
-		m_pos = offset;
-	}
-	else
-	{
-		const SecID shortSector = m_shortStreamChain.at( sectorIdx );
-
-		SecID largeSector;
-		const int32_t offsetInLargeSector = whereIsShortSector( shortSector,
-			largeSector );
-
-		m_shortSecIDIdx = sectorIdx;
-
-		if( m_currentLargeSectorID != largeSector )
-		{
-			m_currentLargeSectorID = largeSector;
-
-			std::streampos pos = calcFileOffset( largeSector,
-				m_header.sectorSize() );
-
-			m_stream.seekg( pos, std::ios::beg );
-
-			m_stream.read( &m_buf[ 0 ], m_header.sectorSize() );
-		}
-
-		m_pos = offsetInLargeSector * m_header.shortSectorSize();
-		m_pos += offset;
-	}
-}
-
-inline int32_t
-Stream::pos()
-{
-	if( eof() )
-		return -1;
-	else
-		return m_bytesReaded;
-}
-
-inline int32_t
-Stream::whereIsShortSector( const SecID & shortSector,
-	SecID & largeSector )
-{
-	const int32_t shortSectorsInLarge =
-		m_header.sectorSize() / m_header.shortSectorSize();
-
-	const int32_t offset = shortSector % shortSectorsInLarge;
-
-	const int32_t largeSectorIdx = shortSector / shortSectorsInLarge;
-
-	largeSector = m_largeStreamChain.at( largeSectorIdx );
-
-	return offset;
-}
-
-inline void
-Stream::seekToNextSector()
-{
-	if( m_mode == LargeStream )
-	{
-		++m_largeSecIDIdx;
-
-		m_stream.seekg( calcFileOffset( m_largeStreamChain.at( m_largeSecIDIdx ),
-			m_sectorSize ), std::ios::beg );
-
-		m_currentLargeSectorID = m_largeStreamChain.at( m_largeSecIDIdx );
-
-		m_stream.read( &m_buf[ 0 ], m_sectorSize );
-
-		m_pos = 0;
-	}
-	else
-	{
-		++m_shortSecIDIdx;
-
-		SecID largeSector;
-		const int32_t offset =
-			whereIsShortSector( m_shortStreamChain.at( m_shortSecIDIdx ),
-				largeSector );
-
-		if( m_currentLargeSectorID != largeSector )
-		{
-			m_currentLargeSectorID = largeSector;
-
-			std::streampos pos = calcFileOffset( largeSector,
-				m_header.sectorSize() );
-
-			m_stream.seekg( pos, std::ios::beg );
-
-			m_stream.read( &m_buf[ 0 ], m_header.sectorSize() );
-		}
-
-		m_pos = offset * m_header.shortSectorSize();
-	}
-}
-
-inline char
-Stream::getByte()
-{
-	if( m_bytesReaded > m_streamSize )
-		return 0xFFu;
-
-	if( m_sectorBytesReaded == m_sectorSize )
-	{
-		m_sectorBytesReaded = 0;
-
-		seekToNextSector();
-	}
-
-	const auto ch = m_buf.at( m_pos );
-
-	++m_sectorBytesReaded;
-	++m_bytesReaded;
-	++m_pos;
-
-	return ch;
-}
-
-
-//
-// Directory
-//
-
-inline
-Directory::Directory()
-	:	m_type( Empty )
-	,	m_secID( SecID::EndOfChain )
-	,	m_streamSize( 0 )
-	,	m_rightChild( -1 )
-	,	m_leftChild( -1 )
-	,	m_rootNode( -1 )
-{
-}
-
-inline const std::wstring &
-Directory::name() const
-{
-	return m_name;
-}
-
-inline Directory::Type
-Directory::type() const
-{
-	return m_type;
-}
-
-inline SecID
-Directory::streamSecID() const
-{
-	return m_secID;
-}
-
-inline int32_t
-Directory::streamSize() const
-{
-	return m_streamSize;
-}
-
-inline int32_t
-Directory::rightChild() const
-{
-	return m_rightChild;
-}
-
-inline int32_t
-Directory::leftChild() const
-{
-	return m_leftChild;
-}
-
-inline int32_t
-Directory::rootNode() const
-{
-	return m_rootNode;
-}
-
-inline void
-Directory::load( Stream & stream )
-{
-	{
-		const int16_t maxSymbolsInName = 32;
-
-		int16_t i = 1;
-
-		std::vector< uint16_t > data;
-		data.reserve( maxSymbolsInName - 1 );
-
-		for( ; i <= maxSymbolsInName; ++i )
-		{
-			uint16_t symbol = 0;
-			stream.read( symbol, 2 );
-
-			if( symbol != 0 )
-				data.push_back( symbol );
-			else
-				break;
-		}
-
-		m_name.assign( data.begin(), data.end() );
-
-		if( i < maxSymbolsInName )
-			stream.seek( ( maxSymbolsInName - i ) * 2, Stream::FromCurrent );
-	}
-
-	stream.seek( 2, Stream::FromCurrent );
-	m_type = (Type)(int32_t) stream.getByte();
-
-	if( stream.eof() )
-		throw Exception( L"Unexpected end of file." );
-
-	stream.seek( 1, Stream::FromCurrent );
-	stream.read( m_leftChild, 4 );
-	stream.read( m_rightChild, 4 );
-	stream.read( m_rootNode, 4 );
-	stream.seek( 36, Stream::FromCurrent );
-
-	{
-		int32_t sec = 0;
-		stream.read( sec, 4 );
-		m_secID = sec;
-	}
-
-	stream.read( m_streamSize, 4 );
-	stream.seek( 4, Stream::FromCurrent );
-}
-
-} /* namespace CompoundFile */
-
-#endif // COMPOUNDFILE__STREAM_HPP__INCLUDED
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef COMPOUNDFILE__STREAM_HPP__INCLUDED
+#define COMPOUNDFILE__STREAM_HPP__INCLUDED
+
+// CompoundFile include.
+#include "header.hpp"
+#include "sat.hpp"
+#include "utils.hpp"
+
+// Excel include.
+#include "../stream.hpp"
+
+// C++ include.
+#include <iostream>
+#include <string>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#include <utility>
+
+
+namespace CompoundFile {
+
+class Stream;
+
+//! Maximum size of the run of consecutive sectors read at once from std::istream.
+static const int32_t maxRunSize = 256 * 1024;
+
+//! Size of the dir record.
+static const int32_t dirRecordSize = 128;
+
+
+//
+// Directory
+//
+
+//! Directory in a compound file.
+class Directory {
+public:
+	Directory();
+
+	//! Type of the entry.
+	enum Type {
+		//! Empty.
+		Empty = 0x00,
+		//! User storage.
+		UserStorage = 0x01,
+		//! User stream.
+		UserStream = 0x02,
+		//! LockBytes.
+		LockBytes = 0x03,
+		//! Property.
+		Property = 0x04,
+		//! Root storage.
+		RootStorage = 0x05
+	}; // enum Type
+
+	//! \return Name of the directory.
+	const std::wstring & name() const;
+
+	//! \return Type of the directory.
+	Type type() const;
+
+	//! \return SecID of the first sector.
+	SecID streamSecID() const;
+
+	//! \return Stream size.
+	int32_t streamSize() const;
+
+	//! \return DirID of the right child node.
+	int32_t rightChild() const;
+
+	//! \return DirID of the left child node.
+	int32_t leftChild() const;
+
+	//! \return DirID of the root node.
+	int32_t rootNode() const;
+
+	//! Load directory.
+	void load( Stream & stream );
+
+	//! Load directory from the entry's data of dirRecordSize bytes.
+	void load( const char * data, Excel::Stream::ByteOrder byteOrder );
+
+private:
+	//! Name of the directory.
+	std::wstring m_name;
+	//! Type of the directory.
+	Type m_type;
+	//! SecID of the first sector.
+	SecID m_secID;
+	//! Stream size.
+	int32_t m_streamSize;
+	//! DirID of the right child node.
+	int32_t m_rightChild;
+	//! DirID of the left child node.
+	int32_t m_leftChild;
+	//! DirID of the root node.
+	int32_t m_rootNode;
+}; // class Directory
+
+
+//
+// Stream
+//
+
+//! Stream in a compound file.
+class Stream
+	:	public Excel::Stream
+{
+
+	friend class File;
+
+protected:
+	Stream( const Header & header,
+		const SAT & sat,
+		const SecID & secID,
+		std::istream & stream,
+		const char * fileData = nullptr,
+		size_t fileSize = 0 );
+
+	/*!
+		Stream over the already resolved \a chain of sectors of \a sectorSize
+		bytes, the first of them is at \a firstSectorOffset in \a data.
+		If \a streamSize is negative then the stream takes the whole chain.
+		The chain is not copied and should outlive the stream.
+	*/
+	Stream( const Header & header,
+		const std::vector< SecID > & chain,
+		int32_t sectorSize,
+		int32_t streamSize,
+		size_t firstSectorOffset,
+		std::istream & stream,
+		const char * data,
+		size_t size );
+
+public:
+	/*!
+		If \a fileData is not null then sectors are read in place
+		from this memory block, that should contain the whole compound
+		file, and \a cstream is not used for reading sectors.
+	*/
+	Stream( const Header & header,
+		const SAT & sat,
+		const SAT & ssat,
+		const Directory & dir,
+		const SecID & shortStreamFirstSector,
+		std::istream & cstream,
+		const char * fileData = nullptr,
+		size_t fileSize = 0 );
+
+	/*!
+		Short stream over the short-sector stream loaded into memory,
+		\a shortStreamData should contain the whole short-sector stream.
+		Sectors are read in place from it with direct offset arithmetic.
+	*/
+	Stream( const Header & header,
+		const SAT & ssat,
+		const Directory & dir,
+		const char * shortStreamData,
+		size_t shortStreamSize,
+		std::istream & cstream );
+
+	//! Read one byte from the stream.
+	char getByte() override;
+
+	//! Read \a size bytes from the stream, \return false if EOF reached.
+	bool tryRead( char * data, size_t size ) override;
+
+	//! Skip \a size bytes, sectors between are not loaded.
+	bool skip( size_t size ) override;
+
+	//! Read \a size bytes in place, possible if the file is in memory.
+	const char * readInPlace( size_t size ) override;
+
+	//! \return true if EOF reached.
+	bool eof() const override;
+
+	//! Seek stream to new position.
+	void seek( int32_t pos, SeekType type = FromBeginning ) override;
+
+	//! \return Position in the stream.
+	int32_t pos() override;
+
+private:
+	Stream( const Header & header,
+		std::vector< SecID > && ownChain,
+		const std::vector< SecID > * chain,
+		int32_t sectorSize,
+		int32_t streamSize,
+		size_t firstSectorOffset,
+		std::istream & stream,
+		const char * data,
+		size_t size );
+
+	//! Seek internal stream to the next sector.
+	void seekToNextSector();
+	//! \return Offset in sectors from the beginning of the large
+	//! stream sector, \a largeSectorIdx is index of this sector in
+	//! the large stream chain.
+	int32_t whereIsShortSector( const SecID & shortSector,
+		int32_t & largeSectorIdx ) const;
+	//! Make large sector with the given index in the chain current.
+	void loadLargeSector( int32_t idx );
+	//! Load run of consecutive sectors starting with the given index in the chain.
+	void loadRun( int32_t idx );
+	//! \return Size of the sectors in m_largeStreamChain.
+	int32_t largeSectorSize() const;
+	//! \return Count of bytes available in memory from the current position.
+	int32_t contiguousBytes() const;
+	//! Move position forward by \a count bytes available in memory.
+	void skipContiguous( int32_t count );
+
+private:
+	//! Header.
+	const Header & m_header;
+	//! Own large stream sectors chain if it's not shared.
+	std::vector< SecID > m_ownLargeStreamChain;
+	//! Large stream sectors chain. In short stream mode it's the chain of
+	//! the short-sector stream.
+	const std::vector< SecID > & m_largeStreamChain;
+	//! Short stream sectors chain.
+	std::vector< SecID > m_shortStreamChain;
+	//! File's stream.
+	std::istream & m_stream;
+	//! Data of the whole file if it's in memory.
+	const char * m_fileData;
+	//! Size of the file's data.
+	size_t m_fileSize;
+	//! Offset of the sector with SecID 0 in the file's data.
+	size_t m_firstSectorOffset;
+
+	//! Mode of the stream.
+	enum Mode {
+		//! Large stream mode, sectors are addressed directly in the file's data.
+		//! Short stream over the loaded short-sector stream works in this mode too.
+		LargeStream,
+		//! Short stream mode, short sectors are resolved through sectors
+		//! of the short-sector stream.
+		ShortStream
+	}; // enum Mode
+
+	//! Mode of the stream.
+	Mode m_mode;
+	//! Bytes readed from the stream.
+	int32_t m_bytesReaded;
+	//! Size of the sector for this stream.
+	int32_t m_sectorSize;
+	//! Bytes readed from the current sector.
+	int32_t m_sectorBytesReaded;
+	//! Current SecID in the short stream.
+	int32_t m_shortSecIDIdx;
+	//! Current SecID in the large stream.
+	int32_t m_largeSecIDIdx;
+	//! Size of the stream.
+	int32_t m_streamSize;
+
+	//! Buffer.
+	std::vector< char > m_buf;
+	//! Data of the loaded run of sectors, either m_buf or data of the file.
+	const char * m_run;
+	//! Index in the large stream chain of the first sector in the run.
+	int32_t m_runFirstIdx;
+	//! Count of sectors in the run.
+	int32_t m_runSectorsCount;
+	//! Data of the current large sector.
+	const char * m_sector;
+	//! Posiztion in buffer.
+	int32_t m_pos;
+}; // class Stream
+
+inline
+Stream::Stream( const Header & header,
+	const SAT & sat,
+	const SecID & secID,
+	std::istream & stream,
+	const char * fileData,
+	size_t fileSize )
+	:	Stream( header, sat.sectors( secID ), nullptr, header.sectorSize(), -1,
+			calcFileOffset( 0, header.sectorSize() ), stream, fileData, fileSize )
+{
+}
+
+inline
+Stream::Stream( const Header & header,
+	const std::vector< SecID > & chain,
+	int32_t sectorSize,
+	int32_t streamSize,
+	size_t firstSectorOffset,
+	std::istream & stream,
+	const char * data,
+	size_t size )
+	:	Stream( header, std::vector< SecID > (), &chain, sectorSize, streamSize,
+			firstSectorOffset, stream, data, size )
+{
+}
+
+inline
+Stream::Stream( const Header & header,
+	std::vector< SecID > && ownChain,
+	const std::vector< SecID > * chain,
+	int32_t sectorSize,
+	int32_t streamSize,
+	size_t firstSectorOffset,
+	std::istream & stream,
+	const char * data,
+	size_t size )
+	:	Excel::Stream( header.byteOrder() )
+	,	m_header( header )
+	,	m_ownLargeStreamChain( std::move( ownChain ) )
+	,	m_largeStreamChain( chain ? *chain : m_ownLargeStreamChain )
+	,	m_stream( stream )
+	,	m_fileData( data )
+	,	m_fileSize( size )
+	,	m_firstSectorOffset( firstSectorOffset )
+	,	m_mode( LargeStream )
+	,	m_bytesReaded( 0 )
+	,	m_sectorSize( sectorSize )
+	,	m_sectorBytesReaded( 0 )
+	,	m_shortSecIDIdx( 0 )
+	,	m_largeSecIDIdx( 0 )
+	,	m_streamSize( streamSize < 0 ?
+			static_cast< int32_t > ( m_largeStreamChain.size() ) * sectorSize : streamSize )
+	,	m_run( nullptr )
+	,	m_runFirstIdx( 0 )
+	,	m_runSectorsCount( 0 )
+	,	m_sector( nullptr )
+	,	m_pos( 0 )
+{
+	m_buf.resize( m_header.sectorSize() );
+
+	loadLargeSector( 0 );
+}
+
+inline
+Stream::Stream( const Header & header,
+	const SAT & sat,
+	const SAT & ssat,
+	const Directory & dir,
+	const SecID & shortStreamFirstSector,
+	std::istream & cstream,
+	const char * fileData,
+	size_t fileSize )
+	:	Excel::Stream( header.byteOrder() )
+	,	m_header( header )
+	,	m_ownLargeStreamChain( sat.sectors(
+			dir.streamSize() < header.streamMinSize() ?
+				shortStreamFirstSector : dir.streamSecID() ) )
+	,	m_largeStreamChain( m_ownLargeStreamChain )
+	,	m_stream( cstream )
+	,	m_fileData( fileData )
+	,	m_fileSize( fileSize )
+	,	m_firstSectorOffset( calcFileOffset( 0, m_header.sectorSize() ) )
+	,	m_mode(
+		( dir.streamSize() < m_header.streamMinSize() ? ShortStream : LargeStream ) )
+	,	m_bytesReaded( 0 )
+	,	m_sectorSize(
+		( dir.streamSize() < m_header.streamMinSize() ?
+			m_header.shortSectorSize() : m_header.sectorSize() ) )
+	,	m_sectorBytesReaded( 0 )
+	,	m_shortSecIDIdx( 0 )
+	,	m_largeSecIDIdx( 0 )
+	,	m_streamSize( dir.streamSize() )
+	,	m_run( nullptr )
+	,	m_runFirstIdx( 0 )
+	,	m_runSectorsCount( 0 )
+	,	m_sector( nullptr )
+	,	m_pos( 0 )
+{
+	m_buf.resize( m_header.sectorSize() );
+
+	if( m_mode == LargeStream )
+		loadLargeSector( 0 );
+	else
+	{
+		m_shortStreamChain = ssat.sectors( dir.streamSecID() );
+
+		int32_t largeSectorIdx = 0;
+		const int32_t offset = whereIsShortSector( dir.streamSecID(),
+			largeSectorIdx );
+
+		loadLargeSector( largeSectorIdx );
+
+		m_pos = offset * m_header.shortSectorSize();
+	}
+}
+
+inline
+Stream::Stream( const Header & header,
+	const SAT & ssat,
+	const Directory & dir,
+	const char * shortStreamData,
+	size_t shortStreamSize,
+	std::istream & cstream )
+	:	Stream( header, ssat.sectors( dir.streamSecID() ), nullptr,
+			header.shortSectorSize(), dir.streamSize(), 0, cstream,
+			shortStreamData, shortStreamSize )
+{
+}
+
+inline bool
+Stream::eof() const
+{
+	return ( m_bytesReaded > m_streamSize );
+}
+
+inline void
+Stream::seek( int32_t pos, SeekType type )
+{
+	if( type == FromCurrent )
+	{
+		pos += m_bytesReaded;
+
+		if( pos < 0 )
+			pos += m_streamSize;
+	}
+	else if( type == FromEnd && pos > 0 )
+		pos = m_streamSize - pos;
+	else if( type == FromEnd && pos < 0 )
+		pos = std::abs( pos );
+	else if( type == FromBeginning && pos < 0 )
+		pos = m_streamSize - pos;
+
+	if( pos >= m_streamSize )
+	{
+		m_bytesReaded = m_streamSize;
+		return;
+	}
+
+	const int32_t offset = pos % m_sectorSize;
+	const int32_t sectorIdx = pos / m_sectorSize;
+
+	m_bytesReaded = pos;
+	m_sectorBytesReaded = offset;
+
+	if( m_mode == LargeStream )
+	{
+		loadLargeSector( sectorIdx );
+
+		m_pos = offset;
+	}
+	else
+	{
+		const SecID shortSector = m_shortStreamChain.at( sectorIdx );
+
+		int32_t largeSectorIdx = 0;
+		const int32_t offsetInLargeSector = whereIsShortSector( shortSector,
+			largeSectorIdx );
+
+		m_shortSecIDIdx = sectorIdx;
+
+		loadLargeSector( largeSectorIdx );
+
+		m_pos = offsetInLargeSector * m_header.shortSectorSize();
+		m_pos += offset;
+	}
+}
+
+inline int32_t
+Stream::pos()
+{
+	if( eof() )
+		return -1;
+	else
+		return m_bytesReaded;
+}
+
+inline int32_t
+Stream::whereIsShortSector( const SecID & shortSector,
+	int32_t & largeSectorIdx ) const
+{
+	const int32_t shortSectorsInLarge =
+		m_header.sectorSize() / m_header.shortSectorSize();
+
+	const int32_t offset = shortSector % shortSectorsInLarge;
+
+	largeSectorIdx = shortSector / shortSectorsInLarge;
+
+	return offset;
+}
+
+inline void
+Stream::loadLargeSector( int32_t idx )
+{
+	if( idx < m_runFirstIdx || idx >= m_runFirstIdx + m_runSectorsCount )
+		loadRun( idx );
+
+	m_largeSecIDIdx = idx;
+	m_sector = m_run + static_cast< size_t > ( idx - m_runFirstIdx ) *
+		largeSectorSize();
+}
+
+inline int32_t
+Stream::largeSectorSize() const
+{
+	return ( m_mode == LargeStream ? m_sectorSize : m_header.sectorSize() );
+}
+
+inline void
+Stream::loadRun( int32_t idx )
+{
+	const size_t sectorSize = largeSectorSize();
+	const SecID first = m_largeStreamChain.at( idx );
+	const size_t offset = m_firstSectorOffset +
+		static_cast< size_t > ( first ) * sectorSize;
+	const int32_t chainSize = static_cast< int32_t > ( m_largeStreamChain.size() );
+	const int32_t maxCount = ( m_fileData ? chainSize :
+		std::max( 1, maxRunSize / static_cast< int32_t > ( sectorSize ) ) );
+
+	int32_t count = 1;
+
+	while( idx + count < chainSize && count < maxCount &&
+		m_largeStreamChain[ idx + count ] == first + count )
+			++count;
+
+	if( m_fileData )
+	{
+		const size_t sectorsInFile = ( offset < m_fileSize ?
+			( m_fileSize - offset ) / sectorSize : 0 );
+
+		if( sectorsInFile > 0 )
+		{
+			count = static_cast< int32_t > ( std::min( static_cast< size_t > ( count ),
+				sectorsInFile ) );
+
+			m_run = m_fileData + offset;
+		}
+		else
+		{
+			// Truncated last sector, pad it with zeroes.
+			count = 1;
+
+			std::fill( m_buf.begin(), m_buf.end(), 0 );
+
+			if( offset < m_fileSize )
+				std::memcpy( &m_buf[ 0 ], m_fileData + offset, m_fileSize - offset );
+
+			m_run = &m_buf[ 0 ];
+		}
+	}
+	else
+	{
+		const size_t size = count * sectorSize;
+
+		if( m_buf.size() < size )
+			m_buf.resize( size );
+
+		m_stream.seekg( offset, std::ios::beg );
+
+		m_stream.read( &m_buf[ 0 ], size );
+
+		if( !m_stream )
+		{
+			// Truncated file, pad the rest of the run with zeroes.
+			std::fill( m_buf.begin() + static_cast< size_t > ( m_stream.gcount() ),
+				m_buf.begin() + size, 0 );
+
+			m_stream.clear();
+		}
+
+		m_run = &m_buf[ 0 ];
+	}
+
+	m_runFirstIdx = idx;
+	m_runSectorsCount = count;
+}
+
+inline int32_t
+Stream::contiguousBytes() const
+{
+	int32_t bytes = m_sectorSize - m_sectorBytesReaded;
+
+	if( m_mode == LargeStream )
+		bytes += ( m_runFirstIdx + m_runSectorsCount - m_largeSecIDIdx - 1 ) *
+			m_sectorSize;
+
+	return std::min( bytes, m_streamSize - m_bytesReaded );
+}
+
+inline void
+Stream::skipContiguous( int32_t count )
+{
+	m_bytesReaded += count;
+
+	const int32_t total = m_sectorBytesReaded + count;
+
+	if( m_mode == LargeStream && total > m_sectorSize )
+	{
+		const int32_t sectors = ( total - 1 ) / m_sectorSize;
+
+		m_largeSecIDIdx += sectors;
+		m_sectorBytesReaded = total - sectors * m_sectorSize;
+		m_sector = m_run + static_cast< size_t > ( m_largeSecIDIdx - m_runFirstIdx ) *
+			m_sectorSize;
+		m_pos = m_sectorBytesReaded;
+	}
+	else
+	{
+		m_sectorBytesReaded = total;
+		m_pos += count;
+	}
+}
+
+inline void
+Stream::seekToNextSector()
+{
+	if( m_mode == LargeStream )
+	{
+		loadLargeSector( m_largeSecIDIdx + 1 );
+
+		m_pos = 0;
+	}
+	else
+	{
+		++m_shortSecIDIdx;
+
+		int32_t largeSectorIdx = 0;
+		const int32_t offset =
+			whereIsShortSector( m_shortStreamChain.at( m_shortSecIDIdx ),
+				largeSectorIdx );
+
+		loadLargeSector( largeSectorIdx );
+
+		m_pos = offset * m_header.shortSectorSize();
+	}
+}
+
+inline char
+Stream::getByte()
+{
+	if( m_bytesReaded > m_streamSize )
+		return 0xFFu;
+
+	if( m_sectorBytesReaded == m_sectorSize )
+	{
+		m_sectorBytesReaded = 0;
+
+		seekToNextSector();
+	}
+
+	const auto ch = m_sector[ m_pos ];
+
+	++m_sectorBytesReaded;
+	++m_bytesReaded;
+	++m_pos;
+
+	return ch;
+}
+
+inline bool
+Stream::tryRead( char * data, size_t size )
+{
+	while( size > 0 )
+	{
+		if( m_bytesReaded >= m_streamSize )
+		{
+			m_bytesReaded = m_streamSize + 1;
+
+			return false;
+		}
+
+		int32_t available = contiguousBytes();
+
+		if( available == 0 )
+		{
+			m_sectorBytesReaded = 0;
+
+			seekToNextSector();
+
+			available = contiguousBytes();
+		}
+
+		const size_t count = std::min( size, static_cast< size_t > ( available ) );
+
+		std::memcpy( data, m_sector + m_pos, count );
+
+		data += count;
+		size -= count;
+
+		skipContiguous( static_cast< int32_t > ( count ) );
+	}
+
+	return true;
+}
+
+inline bool
+Stream::skip( size_t size )
+{
+	if( m_bytesReaded > m_streamSize ||
+		size > static_cast< size_t > ( m_streamSize - m_bytesReaded ) )
+	{
+		m_bytesReaded = m_streamSize + 1;
+
+		return false;
+	}
+
+	if( size <= static_cast< size_t > ( contiguousBytes() ) )
+		skipContiguous( static_cast< int32_t > ( size ) );
+	else
+		seek( m_bytesReaded + static_cast< int32_t > ( size ), FromBeginning );
+
+	return true;
+}
+
+inline const char *
+Stream::readInPlace( size_t size )
+{
+	if( !m_fileData || m_bytesReaded >= m_streamSize ||
+		size > static_cast< size_t > ( m_streamSize - m_bytesReaded ) )
+			return nullptr;
+
+	if( contiguousBytes() == 0 )
+	{
+		m_sectorBytesReaded = 0;
+
+		seekToNextSector();
+	}
+
+	if( m_run == &m_buf[ 0 ] ||
+		size > static_cast< size_t > ( contiguousBytes() ) )
+			return nullptr;
+
+	const char * data = m_sector + m_pos;
+
+	skipContiguous( static_cast< int32_t > ( size ) );
+
+	return data;
+}
+
+
+//
+// Directory
+//
+
+inline
+Directory::Directory()
+	:	m_type( Empty )
+	,	m_secID( SecID::EndOfChain )
+	,	m_streamSize( 0 )
+	,	m_rightChild( -1 )
+	,	m_leftChild( -1 )
+	,	m_rootNode( -1 )
+{
+}
+
+inline const std::wstring &
+Directory::name() const
+{
+	return m_name;
+}
+
+inline Directory::Type
+Directory::type() const
+{
+	return m_type;
+}
+
+inline SecID
+Directory::streamSecID() const
+{
+	return m_secID;
+}
+
+inline int32_t
+Directory::streamSize() const
+{
+	return m_streamSize;
+}
+
+inline int32_t
+Directory::rightChild() const
+{
+	return m_rightChild;
+}
+
+inline int32_t
+Directory::leftChild() const
+{
+	return m_leftChild;
+}
+
+inline int32_t
+Directory::rootNode() const
+{
+	return m_rootNode;
+}
+
+inline void
+Directory::load( Stream & stream )
+{
+	char data[ dirRecordSize ];
+
+	stream.read( data, dirRecordSize );
+
+	load( data, stream.byteOrder() );
+}
+
+inline void
+Directory::load( const char * data, Excel::Stream::ByteOrder byteOrder )
+{
+	const bool littleEndian = ( byteOrder == Excel::Stream::LittleEndian );
+
+	{
+		const int16_t maxSymbolsInName = 32;
+
+		m_name.clear();
+
+		for( int16_t i = 0; i < maxSymbolsInName; ++i )
+		{
+			const uint16_t symbol = decodeData< uint16_t > ( data + i * 2, littleEndian );
+
+			if( symbol != 0 )
+				m_name.push_back( symbol );
+			else
+				break;
+		}
+	}
+
+	m_type = (Type)(int32_t) data[ 66 ];
+	m_leftChild = decodeData< int32_t > ( data + 68, littleEndian );
+	m_rightChild = decodeData< int32_t > ( data + 72, littleEndian );
+	m_rootNode = decodeData< int32_t > ( data + 76, littleEndian );
+	m_secID = decodeData< int32_t > ( data + 116, littleEndian );
+	m_streamSize = decodeData< int32_t > ( data + 120, littleEndian );
+}
+
+} /* namespace CompoundFile */
+
+#endif // COMPOUNDFILE__STREAM_HPP__INCLUDED
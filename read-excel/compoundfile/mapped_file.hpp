@@ -0,0 +1,279 @@
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef COMPOUNDFILE__MAPPED_FILE_HPP__INCLUDED
+#define COMPOUNDFILE__MAPPED_FILE_HPP__INCLUDED
+
+// C++ include.
+#include <string>
+#include <streambuf>
+#include <ios>
+#include <cstddef>
+
+#if defined( _WIN32 )
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+	#include <windows.h>
+#elif defined( __unix__ ) || defined( __APPLE__ )
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <fcntl.h>
+	#include <unistd.h>
+	#define COMPOUNDFILE__MAPPED_FILE_POSIX
+#endif
+
+
+namespace CompoundFile {
+
+//
+// MappedFile
+//
+
+//! Read-only memory mapping of the whole file.
+class MappedFile {
+public:
+	MappedFile();
+	explicit MappedFile( const std::string & fileName );
+	~MappedFile();
+
+	MappedFile( const MappedFile & ) = delete;
+	MappedFile & operator = ( const MappedFile & ) = delete;
+
+	//! \return Is file mapped.
+	bool isMapped() const;
+
+	//! \return Mapped data.
+	const char * data() const;
+
+	//! \return Size of the mapped data.
+	size_t size() const;
+
+private:
+	//! Map file.
+	void map( const std::string & fileName );
+	//! Unmap file.
+	void unmap();
+
+private:
+	//! Mapped data.
+	const char * m_data;
+	//! Size of the mapped data.
+	size_t m_size;
+#if defined( _WIN32 )
+	//! Handle of the file mapping.
+	HANDLE m_mapping;
+#endif
+}; // class MappedFile
+
+inline
+MappedFile::MappedFile()
+	:	m_data( nullptr )
+	,	m_size( 0 )
+#if defined( _WIN32 )
+	,	m_mapping( nullptr )
+#endif
+{
+}
+
+inline
+MappedFile::MappedFile( const std::string & fileName )
+	:	m_data( nullptr )
+	,	m_size( 0 )
+#if defined( _WIN32 )
+	,	m_mapping( nullptr )
+#endif
+{
+	map( fileName );
+}
+
+inline
+MappedFile::~MappedFile()
+{
+	unmap();
+}
+
+inline bool
+MappedFile::isMapped() const
+{
+	return ( m_data != nullptr );
+}
+
+inline const char *
+MappedFile::data() const
+{
+	return m_data;
+}
+
+inline size_t
+MappedFile::size() const
+{
+	return m_size;
+}
+
+#if defined( _WIN32 )
+
+inline void
+MappedFile::map( const std::string & fileName )
+{
+	HANDLE file = CreateFileA( fileName.c_str(), GENERIC_READ, FILE_SHARE_READ,
+		nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+		nullptr );
+
+	if( file == INVALID_HANDLE_VALUE )
+		return;
+
+	LARGE_INTEGER size;
+
+	if( GetFileSizeEx( file, &size ) && size.QuadPart > 0 )
+	{
+		m_mapping = CreateFileMappingA( file, nullptr, PAGE_READONLY, 0, 0, nullptr );
+
+		if( m_mapping )
+		{
+			m_data = static_cast< const char * > (
+				MapViewOfFile( m_mapping, FILE_MAP_READ, 0, 0, 0 ) );
+
+			if( m_data )
+				m_size = static_cast< size_t > ( size.QuadPart );
+			else
+			{
+				CloseHandle( m_mapping );
+				m_mapping = nullptr;
+			}
+		}
+	}
+
+	CloseHandle( file );
+}
+
+inline void
+MappedFile::unmap()
+{
+	if( m_data )
+		UnmapViewOfFile( m_data );
+
+	if( m_mapping )
+		CloseHandle( m_mapping );
+
+	m_data = nullptr;
+	m_mapping = nullptr;
+	m_size = 0;
+}
+
+#elif defined( COMPOUNDFILE__MAPPED_FILE_POSIX )
+
+inline void
+MappedFile::map( const std::string & fileName )
+{
+	const int fd = ::open( fileName.c_str(), O_RDONLY );
+
+	if( fd == -1 )
+		return;
+
+	struct stat st;
+
+	if( ::fstat( fd, &st ) == 0 && st.st_size > 0 )
+	{
+		void * data = ::mmap( nullptr, static_cast< size_t > ( st.st_size ),
+			PROT_READ, MAP_PRIVATE, fd, 0 );
+
+		if( data != MAP_FAILED )
+		{
+			m_data = static_cast< const char * > ( data );
+			m_size = static_cast< size_t > ( st.st_size );
+		}
+	}
+
+	::close( fd );
+}
+
+inline void
+MappedFile::unmap()
+{
+	if( m_data )
+		::munmap( const_cast< char * > ( m_data ), m_size );
+
+	m_data = nullptr;
+	m_size = 0;
+}
+
+#else
+
+inline void
+MappedFile::map( const std::string & )
+{
+}
+
+inline void
+MappedFile::unmap()
+{
+}
+
+#endif
+
+
+//
+// MemoryStreamBuffer
+//
+
+//! Read-only stream buffer over the memory block, doesn't copy the data.
+class MemoryStreamBuffer
+	:	public std::streambuf
+{
+public:
+	MemoryStreamBuffer( const char * data, size_t size );
+
+protected:
+	pos_type seekoff( off_type off, std::ios_base::seekdir dir,
+		std::ios_base::openmode which = std::ios_base::in ) override;
+
+	pos_type seekpos( pos_type pos,
+		std::ios_base::openmode which = std::ios_base::in ) override;
+}; // class MemoryStreamBuffer
+
+inline
+MemoryStreamBuffer::MemoryStreamBuffer( const char * data, size_t size )
+{
+	char * begin = const_cast< char * > ( data );
+
+	setg( begin, begin, begin + size );
+}
+
+inline MemoryStreamBuffer::pos_type
+MemoryStreamBuffer::seekoff( off_type off, std::ios_base::seekdir dir,
+	std::ios_base::openmode which )
+{
+	if( !( which & std::ios_base::in ) )
+		return pos_type( off_type( -1 ) );
+
+	off_type pos = off;
+
+	if( dir == std::ios_base::cur )
+		pos += gptr() - eback();
+	else if( dir == std::ios_base::end )
+		pos += egptr() - eback();
+
+	if( pos < 0 || pos > egptr() - eback() )
+		return pos_type( off_type( -1 ) );
+
+	setg( eback(), eback() + pos, egptr() );
+
+	return pos_type( pos );
+}
+
+inline MemoryStreamBuffer::pos_type
+MemoryStreamBuffer::seekpos( pos_type pos, std::ios_base::openmode which )
+{
+	return seekoff( off_type( pos ), std::ios_base::beg, which );
+}
+
+} /* namespace CompoundFile */
+
+#endif // COMPOUNDFILE__MAPPED_FILE_HPP__INCLUDED
@@ -1,152 +1,219 @@
-
-/*
-	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
-	SPDX-License-Identifier: MIT
-*/
-
-#ifndef COMPOUNDFILE__SAT_HPP__INCLUDED
-#define COMPOUNDFILE__SAT_HPP__INCLUDED
-
-// C++ include.
-#include <vector>
-#include <cstdint>
-#include <string>
-#include <sstream>
-
-// CompoundFile include.
-#include "compoundfile_exceptions.hpp"
-
-
-namespace CompoundFile {
-
-//
-// SecID
-//
-
-//! Sector identifier.
-class SecID {
-public:
-	enum Ids {
-		//! Free sector identifier.
-		FreeSecID = -1,
-		//! End of chain of sectors identifier.
-		EndOfChain = -2,
-		//! SAT sector identifier.
-		SATSecID = -3,
-		//! MSAT sector identifier.
-		MSATSecID = -4
-	}; // enum Ids
-
-public:
-	SecID();
-	SecID( int32_t id );
-
-	//! Convert SecID into integral value.
-	operator int32_t () const;
-
-private:
-	//! Integral sector identifier.
-	int32_t m_id;
-}; // class SecID
-
-
-//
-// SAT
-//
-
-//! Sector allocation table.
-class SAT {
-public:
-	SAT();
-	explicit SAT( const std::vector< SecID > & sat );
-
-	//! \return Sector allocation table.
-	const std::vector< SecID > & sat() const;
-
-	//! \return Chain of sectors for the given stream in the right order.
-	std::vector< SecID > sectors( const SecID & firstSector ) const;
-
-private:
-	//! SAT.
-	std::vector< SecID > m_sat;
-}; // class SAT
-
-
-//
-// SecID
-//
-
-inline
-SecID::SecID()
-	:	m_id( EndOfChain )
-{}
-
-inline
-SecID::SecID( int32_t id )
-	:	m_id( id )
-{
-}
-
-inline
-SecID::operator int32_t () const
-{
-	return m_id;
-}
-
-
-//
-// SAT
-//
-
-inline
-SAT::SAT()
-{
-}
-
-inline
-SAT::SAT( const std::vector< SecID > & sat )
-	:	m_sat( sat )
-{
-}
-
-inline const std::vector< SecID > &
-SAT::sat() const
-{
-	return m_sat;
-}
-
-inline std::vector< SecID >
-SAT::sectors( const SecID & firstSector ) const
-{
-	if( firstSector < static_cast< int32_t > ( m_sat.size() ) )
-	{
-		std::vector< SecID > result;
-
-		result.push_back( firstSector );
-
-		SecID id = m_sat.at( firstSector );
-
-		while( true )
-		{
-			if( id >= 0 )
-				result.push_back( id );
-			else
-				break;
-
-			id = m_sat.at( id );
-		}
-
-		return result;
-	}
-	else
-	{
-		std::wstringstream stream;
-		stream << L"There is no such sector with id: " << firstSector;
-
-		throw Exception( stream.str() );
-	}
-}
-
-} /* namespace CompoundFile */
-
-#endif // COMPOUNDFILE__SAT_HPP__INCLUDED
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef COMPOUNDFILE__SAT_HPP__INCLUDED
+#define COMPOUNDFILE__SAT_HPP__INCLUDED
+
+// C++ include.
+#include <vector>
+#include <cstdint>
+#include <string>
+#include <sstream>
+#include <unordered_map>
+
+// CompoundFile include.
+#include "compoundfile_exceptions.hpp"
+
+
+namespace CompoundFile {
+
+//
+// SecID
+//
+
+//! Sector identifier.
+class SecID {
+public:
+	enum Ids {
+		//! Free sector identifier.
+		FreeSecID = -1,
+		//! End of chain of sectors identifier.
+		EndOfChain = -2,
+		//! SAT sector identifier.
+		SATSecID = -3,
+		//! MSAT sector identifier.
+		MSATSecID = -4
+	}; // enum Ids
+
+public:
+	SecID();
+	SecID( int32_t id );
+
+	//! Convert SecID into integral value.
+	operator int32_t () const;
+
+private:
+	//! Integral sector identifier.
+	int32_t m_id;
+}; // class SecID
+
+
+//
+// SAT
+//
+
+//! Sector allocation table.
+class SAT {
+public:
+	SAT();
+	explicit SAT( const std::vector< SecID > & sat );
+
+	//! \return Sector allocation table.
+	const std::vector< SecID > & sat() const;
+
+	/*!
+		\return Chain of sectors for the given stream in the right order.
+		Throws Exception if the chain has a loop or refers to a sector
+		out of the SAT, so it takes not more than O(SAT size) time.
+	*/
+	std::vector< SecID > sectors( const SecID & firstSector ) const;
+
+private:
+	//! SAT.
+	std::vector< SecID > m_sat;
+}; // class SAT
+
+
+//
+// ChainsCache
+//
+
+//! Cache of the chains of sectors resolved in the SAT by the first sector.
+class ChainsCache {
+public:
+	explicit ChainsCache( const SAT & sat );
+
+	/*!
+		\return Chain of sectors for the given stream. The chain is
+		resolved once for each first sector, the reference is valid
+		while the cache lives.
+	*/
+	const std::vector< SecID > & sectors( const SecID & firstSector );
+
+private:
+	//! SAT.
+	const SAT & m_sat;
+	//! Resolved chains.
+	std::unordered_map< int32_t, std::vector< SecID > > m_chains;
+}; // class ChainsCache
+
+
+//
+// SecID
+//
+
+inline
+SecID::SecID()
+	:	m_id( EndOfChain )
+{}
+
+inline
+SecID::SecID( int32_t id )
+	:	m_id( id )
+{
+}
+
+inline
+SecID::operator int32_t () const
+{
+	return m_id;
+}
+
+
+//
+// SAT
+//
+
+inline
+SAT::SAT()
+{
+}
+
+inline
+SAT::SAT( const std::vector< SecID > & sat )
+	:	m_sat( sat )
+{
+}
+
+inline const std::vector< SecID > &
+SAT::sat() const
+{
+	return m_sat;
+}
+
+inline std::vector< SecID >
+SAT::sectors( const SecID & firstSector ) const
+{
+	const int32_t size = static_cast< int32_t > ( m_sat.size() );
+
+	if( firstSector >= 0 && firstSector < size )
+	{
+		std::vector< SecID > result;
+		std::vector< bool > visited( m_sat.size(), false );
+
+		SecID id = firstSector;
+
+		while( id >= 0 )
+		{
+			if( id >= size )
+			{
+				std::wstringstream stream;
+				stream << L"There is no such sector with id: " << id;
+
+				throw Exception( stream.str() );
+			}
+
+			if( visited[ id ] )
+			{
+				std::wstringstream stream;
+				stream << L"Loop in the chain of sectors at sector with id: " << id;
+
+				throw Exception( stream.str() );
+			}
+
+			visited[ id ] = true;
+
+			result.push_back( id );
+
+			id = m_sat[ id ];
+		}
+
+		return result;
+	}
+	else
+	{
+		std::wstringstream stream;
+		stream << L"There is no such sector with id: " << firstSector;
+
+		throw Exception( stream.str() );
+	}
+}
+
+
+//
+// ChainsCache
+//
+
+inline
+ChainsCache::ChainsCache( const SAT & sat )
+	:	m_sat( sat )
+{
+}
+
+inline const std::vector< SecID > &
+ChainsCache::sectors( const SecID & firstSector )
+{
+	const auto it = m_chains.find( firstSector );
+
+	if( it != m_chains.cend() )
+		return it->second;
+
+	return m_chains.emplace( firstSector, m_sat.sectors( firstSector ) ).first->second;
+}
+
+} /* namespace CompoundFile */
+
+#endif // COMPOUNDFILE__SAT_HPP__INCLUDED
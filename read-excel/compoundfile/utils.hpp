@@ -1,75 +1,199 @@
-
-/*
-	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
-	SPDX-License-Identifier: MIT
-*/
-
-#ifndef COMPOUNDFILE__UTILS_HPP__INCLUDED
-#define COMPOUNDFILE__UTILS_HPP__INCLUDED
-
-// CompoundFile include.
-#include "sat.hpp"
-
-// C++ include.
-#include <iostream>
-
-
-namespace CompoundFile {
-
-//
-// readData
-//
-
-//! Read data from the stream.
-template< class Type >
-void readData( std::istream & stream, Type & data, size_t bytes = 0 )
-{
-	data = Type(0);
-	if( bytes == 0 ) bytes = sizeof( Type );
-
-	for( size_t i = 0; i < bytes; ++i )
-	{
-		char c = 0x00;
-		stream.get( c );
-
-		data |= (((Type) (unsigned char) c ) << 8*i);
-	}
-} // readData
-
-
-//
-// calcFileOffset
-//
-
-//! Calculate file offset for the given sector.
-inline size_t
-calcFileOffset( const SecID & id, size_t sectorSize )
-{
-	return ( 512 + id * sectorSize );
-}
-
-
-//
-// loadSATSector
-//
-
-//! Load SAT or SSAT sector.
-inline void
-loadSATSector( std::istream & stream, std::vector< SecID > & sat,
-	int32_t sectorSize )
-{
-	const int32_t secIDCount = sectorSize / 4;
-
-	for( int32_t i = 0; i < secIDCount; ++i )
-	{
-		int32_t secID = 0;
-
-		readData( stream, secID, 4 );
-
-		sat.push_back( secID );
-	}
-} // loadSATSector
-
-} /* namespace CompoundFile */
-
-#endif // COMPOUNDFILE__UTILS_HPP__INCLUDED
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef COMPOUNDFILE__UTILS_HPP__INCLUDED
+#define COMPOUNDFILE__UTILS_HPP__INCLUDED
+
+// CompoundFile include.
+#include "sat.hpp"
+
+// C++ include.
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+
+namespace CompoundFile {
+
+//
+// readData
+//
+
+//! Read data from the stream.
+template< class Type >
+void readData( std::istream & stream, Type & data, size_t bytes = 0 )
+{
+	data = Type(0);
+	if( bytes == 0 ) bytes = sizeof( Type );
+
+	for( size_t i = 0; i < bytes; ++i )
+	{
+		char c = 0x00;
+		stream.get( c );
+
+		data |= (((Type) (unsigned char) c ) << 8*i);
+	}
+} // readData
+
+
+//
+// decodeData
+//
+
+//! Decode integer of \a bytes bytes from the memory with the given byte order.
+template< class Type >
+inline Type
+decodeData( const char * data, bool littleEndian, size_t bytes = sizeof( Type ) )
+{
+	typedef typename std::make_unsigned< Type >::type Unsigned;
+
+	Unsigned value = 0;
+
+	for( size_t i = 0; i < bytes; ++i )
+	{
+		const size_t shift = 8 * ( littleEndian ? i : bytes - 1 - i );
+
+		value |= static_cast< Unsigned > (
+			static_cast< Unsigned > ( static_cast< unsigned char > ( data[ i ] ) ) << shift );
+	}
+
+	return static_cast< Type > ( value );
+} // decodeData
+
+
+//
+// calcFileOffset
+//
+
+//! Calculate file offset for the given sector.
+inline size_t
+calcFileOffset( const SecID & id, size_t sectorSize )
+{
+	return ( 512 + id * sectorSize );
+}
+
+
+//
+// isLittleEndianSystem
+//
+
+//! \return Is system's byte order little-endian.
+inline bool
+isLittleEndianSystem()
+{
+	static const int16_t word = 0x0001;
+
+	return ( *reinterpret_cast< const char * > ( &word ) != 0 );
+} // isLittleEndianSystem
+
+
+//
+// swapBytes
+//
+
+//! \return Value with reversed order of bytes.
+inline uint32_t
+swapBytes( uint32_t value )
+{
+	return ( ( value >> 24 ) | ( ( value >> 8 ) & 0x0000FF00u ) |
+		( ( value << 8 ) & 0x00FF0000u ) | ( value << 24 ) );
+} // swapBytes
+
+
+//
+// readSecIDs
+//
+
+/*!
+	Read \a count little-endian SecIDs from the stream with one read and
+	append them to \a ids. Missing data at the end of the stream is read
+	as zeroes.
+*/
+inline void
+readSecIDs( std::istream & stream, std::vector< SecID > & ids, size_t count )
+{
+	static_assert( sizeof( SecID ) == sizeof( uint32_t ) &&
+		std::is_trivially_copyable< SecID >::value,
+		"SecID should be a plain 32-bit integer." );
+
+	if( count == 0 )
+		return;
+
+	const size_t offset = ids.size();
+
+	ids.resize( offset + count );
+
+	char * data = reinterpret_cast< char * > ( &ids[ offset ] );
+	const size_t size = count * sizeof( SecID );
+
+	stream.read( data, size );
+
+	const size_t readed = static_cast< size_t > ( stream.gcount() );
+
+	if( readed < size )
+		std::fill( data + readed, data + size, 0 );
+
+	if( !isLittleEndianSystem() )
+	{
+		// Simple loop to let the compiler vectorize it.
+		uint32_t * values = reinterpret_cast< uint32_t * > ( data );
+
+		for( size_t i = 0; i < count; ++i )
+			values[ i ] = swapBytes( values[ i ] );
+	}
+} // readSecIDs
+
+
+//
+// loadSATSector
+//
+
+//! Load SAT or SSAT sector.
+inline void
+loadSATSector( std::istream & stream, std::vector< SecID > & sat,
+	int32_t sectorSize )
+{
+	readSecIDs( stream, sat, sectorSize / 4 );
+} // loadSATSector
+
+
+//
+// loadSATSectors
+//
+
+/*!
+	Load SAT or SSAT sectors with the given SecIDs. Runs of consecutive
+	sectors are read with one read.
+*/
+inline void
+loadSATSectors( std::istream & stream, std::vector< SecID > & sat,
+	const std::vector< SecID > & sectors, int32_t sectorSize )
+{
+	const size_t secIDsInSector = sectorSize / 4;
+
+	sat.reserve( sat.size() + sectors.size() * secIDsInSector );
+
+	for( size_t i = 0; i < sectors.size(); )
+	{
+		size_t count = 1;
+
+		while( i + count < sectors.size() &&
+			sectors[ i + count ] == sectors[ i ] + static_cast< int32_t > ( count ) )
+				++count;
+
+		stream.seekg( calcFileOffset( sectors[ i ], sectorSize ) );
+
+		readSecIDs( stream, sat, count * secIDsInSector );
+
+		i += count;
+	}
+} // loadSATSectors
+
+} /* namespace CompoundFile */
+
+#endif // COMPOUNDFILE__UTILS_HPP__INCLUDED
@@ -0,0 +1,121 @@
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef EXCEL__DIMENSION_HPP__INCLUDED
+#define EXCEL__DIMENSION_HPP__INCLUDED
+
+// C++ include.
+#include <cstdint>
+
+// Excel include.
+#include "record.hpp"
+
+
+namespace Excel {
+
+//
+// Dimension
+//
+
+/*!
+	DIMENSION record in the Excel file, used range of the worksheet.
+	Rows and columns in the range are [ firstRow(), rowsCount() ) and
+	[ firstColumn(), columnsCount() ).
+*/
+class Dimension {
+public:
+	Dimension();
+
+	//! \return Is the dimension loaded from the record.
+	bool isValid() const;
+
+	//! \return Index of the first used row.
+	uint32_t firstRow() const;
+
+	//! \return Index of the last used row plus 1.
+	uint32_t rowsCount() const;
+
+	//! \return Index of the first used column.
+	uint16_t firstColumn() const;
+
+	//! \return Index of the last used column plus 1.
+	uint16_t columnsCount() const;
+
+	/*!
+		Parse DIMENSION record. Rows are 32-bit in BIFF8 and 16-bit in
+		earlier versions, some writers use the short record in BIFF8 too.
+	*/
+	void parse( Record & record );
+
+private:
+	//! Is the dimension loaded from the record.
+	bool m_isValid;
+	//! Index of the first used row.
+	uint32_t m_firstRow;
+	//! Index of the last used row plus 1.
+	uint32_t m_rowsCount;
+	//! Index of the first used column.
+	uint16_t m_firstColumn;
+	//! Index of the last used column plus 1.
+	uint16_t m_columnsCount;
+}; // class Dimension
+
+inline
+Dimension::Dimension()
+	:	m_isValid( false )
+	,	m_firstRow( 0 )
+	,	m_rowsCount( 0 )
+	,	m_firstColumn( 0 )
+	,	m_columnsCount( 0 )
+{
+}
+
+inline bool
+Dimension::isValid() const
+{
+	return m_isValid;
+}
+
+inline uint32_t
+Dimension::firstRow() const
+{
+	return m_firstRow;
+}
+
+inline uint32_t
+Dimension::rowsCount() const
+{
+	return m_rowsCount;
+}
+
+inline uint16_t
+Dimension::firstColumn() const
+{
+	return m_firstColumn;
+}
+
+inline uint16_t
+Dimension::columnsCount() const
+{
+	return m_columnsCount;
+}
+
+inline void
+Dimension::parse( Record & record )
+{
+	const int32_t rowBytes = ( record.length() >= 14 ? 4 : 2 );
+
+	record.dataStream().read( m_firstRow, rowBytes );
+	record.dataStream().read( m_rowsCount, rowBytes );
+	record.dataStream().read( m_firstColumn, 2 );
+	record.dataStream().read( m_columnsCount, 2 );
+
+	m_isValid = true;
+}
+
+} /* namespace Excel */
+
+#endif // EXCEL__DIMENSION_HPP__INCLUDED
@@ -0,0 +1,53 @@
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+// C++ include.
+#include <cstdint>
+#include <vector>
+
+// Excel include.
+#include "sheet.hpp"
+#include "dimension.hpp"
+
+namespace Excel {
+
+//
+// SheetInfo
+//
+
+//! Metadata of the sheet.
+struct SheetInfo {
+	explicit SheetInfo( const BoundSheet & sheet )
+		:	boundSheet( sheet )
+	{
+	}
+
+	//! BOUNDSHEET record with the name and the type of the sheet.
+	BoundSheet boundSheet;
+	//! Used range of the worksheet, it's not valid for other sheets.
+	Dimension dimension;
+}; // struct SheetInfo
+
+
+//
+// BookInfo
+//
+
+//! Metadata of the workbook.
+struct BookInfo {
+	/*!
+		Date mode from the DATEMODE record: 0 if the base date is 1899-Dec-31,
+		1 if it's 1904-Jan-01, -1 if unknown. Values are the same as in
+		Book::DateMode.
+	*/
+	int32_t dateMode = -1;
+	//! Sheets in the order of the workbook.
+	std::vector< SheetInfo > sheets;
+}; // struct BookInfo
+
+} /* namespace Excel */
@@ -0,0 +1,82 @@
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+// C++ include.
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+namespace Excel {
+
+//
+// LoadOptions
+//
+
+//! Options of loading of the workbook.
+struct LoadOptions {
+	/*!
+		Count of threads to parse worksheets, 1 to parse them sequentially,
+		0 to use std::thread::hardware_concurrency() threads.
+
+		Worksheets are parsed in parallel only if the whole file is in
+		memory (memory mapped file or memory block), each worksheet with
+		its own stream over the file's data. In this mode IStorage cell
+		callbacks of different sheets may be called concurrently, see
+		IStorage.
+	*/
+	size_t threadsCount = 1;
+
+	/*!
+		Filter of worksheets to load, it's called with the index and the
+		name of the sheet. Only worksheets for which it returns true are
+		parsed and reported to IStorage, others are skipped without
+		reading. All worksheets are loaded if the filter is empty.
+	*/
+	std::function< bool ( size_t, const std::wstring & ) > sheetFilter;
+
+	/*!
+		Store cells of Book's sheets in Sheet::StorageMode::Compact mode,
+		it takes much less memory for big and sparse sheets. It's used by
+		Book only, custom storages don't get it.
+	*/
+	bool compactSheets = false;
+}; // struct LoadOptions
+
+
+//
+// sheetsWithNames
+//
+
+//! \return Filter of worksheets with the given names.
+inline std::function< bool ( size_t, const std::wstring & ) >
+sheetsWithNames( const std::vector< std::wstring > & names )
+{
+	return [ names ]( size_t, const std::wstring & name )
+	{
+		return ( std::find( names.cbegin(), names.cend(), name ) != names.cend() );
+	};
+} // sheetsWithNames
+
+
+//
+// sheetsWithIndexes
+//
+
+//! \return Filter of worksheets with the given indexes.
+inline std::function< bool ( size_t, const std::wstring & ) >
+sheetsWithIndexes( const std::vector< size_t > & indexes )
+{
+	return [ indexes ]( size_t idx, const std::wstring & )
+	{
+		return ( std::find( indexes.cbegin(), indexes.cend(), idx ) != indexes.cend() );
+	};
+} // sheetsWithIndexes
+
+} /* namespace Excel */
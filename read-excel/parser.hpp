@@ -1,402 +1,926 @@
-
-/*
-	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
-	SPDX-License-Identifier: MIT
-*/
-
-#pragma once
-
-// C++ include.
-#include <string>
-
-// Excel include.
-#include "storage.hpp"
-#include "sheet.hpp"
-
-#include "compoundfile/compoundfile.hpp"
-#include "compoundfile/compoundfile_exceptions.hpp"
-
-namespace Excel {
-
-//
-// Parser
-//
-
-//! Parser of XLS file.
-class Parser final {
-public:
-	//! Load WorkBook from stream.
-	static void loadBook( std::istream & fileStream, IStorage & storage,
-		const std::string & fileName = "<custom-stream>" );
-
-	//! Store document date mode.
-	static void handleDateMode( Record & r, IStorage & storage );
-
-	//! Load sheets from file.
-	static void loadGlobals( std::vector< BoundSheet > & boundSheets, 
-		Stream & stream, IStorage & storage );
-
-	//! Load boundsheet.
-	static BoundSheet parseBoundSheet( Record & record, BOF::BiffVersion ver );
-
-	//! Load WorkSheets.
-	static void loadWorkSheets( const std::vector< BoundSheet > & boundSheets,
-		Stream & stream, IStorage& storage );
-
-	//! Parse shared string table.
-	static void parseSST( Record & record, IStorage & storage );
-
-	//! Load WorkSheet.
-	static void loadSheet( size_t sheetIdx, const BoundSheet & boundSheet,
-		Stream & stream, IStorage & storage );
-
-	//! Handle label SST.
-	static void handleLabelSST( Record & record, size_t sheetIdx, IStorage & storage );
-
-	//! Handle label.
-	static void handleLabel( Record & record, size_t sheetIdx, IStorage & storage );
-
-	//! Handle RK.
-	static void handleRK( Record & record, size_t sheetIdx, IStorage & storage );
-
-	//! Handle MULRK.
-	static void handleMULRK( Record & record, size_t sheetIdx, IStorage & storage );
-
-	//! Handle NUMBER.
-	static void handleNUMBER( Record & record, size_t sheetIdx, IStorage & storage );
-
-	//! Handle FORMULA.
-	static void handleFORMULA( Record & record, Stream & stream, size_t sheetIdx,
-		IStorage & storage );
-}; // class Parser
-
-inline void
-Parser::loadBook( std::istream & fileStream, IStorage & storage,
-	const std::string & fileName )
-{
-	static_assert( sizeof( double ) == 8,
-		"Unsupported platform: double has to be 8 bytes." );
-
-	try {
-		CompoundFile::File file( fileStream, fileName );
-		auto stream = file.stream( 
-			file.hasDirectory( L"Workbook" ) ? file.directory( L"Workbook" ) 
-			                                 : file.directory( L"Book") );
-
-		std::vector< BoundSheet > boundSheets;
-
-		loadGlobals( boundSheets, *stream, storage );
-
-		loadWorkSheets( boundSheets, *stream, storage );
-	}
-	catch( const CompoundFile::Exception & x )
-	{
-		throw Exception( x.whatAsWString() );
-	}
-}
-
-inline void
-Parser::handleDateMode( Record & r, IStorage & storage )
-{
-	uint16_t mode = 0;
-
-	r.dataStream().read( mode, 2 );
-
-	storage.onDateMode( mode );
-}
-
-inline void
-Parser::loadGlobals( std::vector< BoundSheet > & boundSheets, 
-	Stream & stream, IStorage & storage )
-{
-	BOF bof;
-
-	while( true )
-	{
-		Record r( stream );
-
-		switch( r.code() )
-		{
-			case XL_BOF :
-				bof.parse( r );
-				break;
-
-			case XL_FILEPASS :
-				throw Exception( L"This file is protected. Decryption is not implemented yet." );
-
-			case XL_SST :
-				parseSST( r, storage );
-				break;
-
-			case XL_BOUNDSHEET :
-				boundSheets.push_back( parseBoundSheet( r, bof.version() ) );
-				break;
-
-			case XL_DATEMODE :
-				handleDateMode( r, storage );
-				break;
-
-			case XL_EOF :
-				return;
-
-			case XL_UNKNOWN :
-				throw Exception( L"Wrong format." );
-
-			default:
-				break;
-		}
-	}
-}
-
-inline BoundSheet
-Parser::parseBoundSheet( Record & record, BOF::BiffVersion ver )
-{
-	int32_t pos = 0;
-	int16_t sheetType = 0;
-	std::wstring sheetName;
-
-	record.dataStream().read( pos, 4 );
-
-	record.dataStream().read( sheetType, 2 );
-
-	sheetName = loadString( record.dataStream(), record.borders(), 1, ver );
-
-	return BoundSheet( pos,
-		BoundSheet::convertSheetType( sheetType ),
-		sheetName );
-}
-
-inline void
-Parser::loadWorkSheets( const std::vector< BoundSheet > & boundSheets,
-	Stream & stream, IStorage& storage )
-{
-	for( size_t i = 0; i < boundSheets.size(); ++i )
-	{
-		if( boundSheets[i].sheetType() == BoundSheet::WorkSheet )
-		{
-			storage.onSheet( i, boundSheets[i].sheetName() );
-			loadSheet( i, boundSheets[i], stream, storage );
-		}
-	}
-}
-
-inline void
-Parser::parseSST( Record & record, IStorage & storage )
-{
-	int32_t totalStrings = 0;
-	int32_t uniqueStrings = 0;
-
-	record.dataStream().read( totalStrings, 4 );
-	record.dataStream().read( uniqueStrings, 4 );
-
-	std::vector< std::wstring > sst( uniqueStrings );
-
-	for( int32_t i = 0; i < uniqueStrings; ++i )
-		storage.onSharedString( uniqueStrings, i,
-			loadString( record.dataStream(), record.borders() ) );
-}
-
-inline void
-Parser::loadSheet( size_t sheetIdx, const BoundSheet & boundSheet,
-	Stream & stream, IStorage & storage )
-{
-	stream.seek( boundSheet.BOFPosition(), Stream::FromBeginning );
-	BOF bof;
-
-	{
-		Record record( stream );
-
-		bof.parse( record );
-	}
-
-	if( bof.version() != BOF::BIFF8 )
-		throw Exception( L"Unsupported BIFF version. BIFF8 is supported only." );
-
-	while( true )
-	{
-		Record record( stream );
-
-		switch( record.code() )
-		{
-			case XL_LABELSST :
-				handleLabelSST( record, sheetIdx, storage );
-				break;
-
-			case XL_LABEL :
-				handleLabel( record, sheetIdx, storage );
-				break;
-
-			case XL_RK :
-			case XL_RK2 :
-				handleRK( record, sheetIdx, storage );
-				break;
-
-			case XL_MULRK :
-				handleMULRK( record, sheetIdx, storage );
-				break;
-
-			case XL_NUMBER :
-				handleNUMBER( record, sheetIdx, storage );
-				break;
-
-			case XL_FORMULA :
-				handleFORMULA( record, stream, sheetIdx, storage );
-				break;
-
-			case XL_EOF :
-				return;
-
-			case XL_UNKNOWN :
-				throw Exception( L"Wrong format." );
-
-			default:
-				break;
-		}
-	}
-}
-
-inline void
-Parser::handleLabelSST( Record & record, size_t sheetIdx, IStorage & storage )
-{
-	int16_t row = 0;
-	int16_t column = 0;
-	int16_t xfIndex = 0;
-	int32_t sstIndex = 0;
-
-	record.dataStream().read( row, 2 );
-	record.dataStream().read( column, 2 );
-	record.dataStream().read( xfIndex, 2 );
-	record.dataStream().read( sstIndex, 4 );
-
-	storage.onCellSharedString( sheetIdx, row, column, sstIndex );
-}
-
-inline void
-Parser::handleLabel( Record & record, size_t sheetIdx, IStorage & storage )
-{
-	int16_t row = 0;
-	int16_t column = 0;
-
-	record.dataStream().read( row, 2 );
-	record.dataStream().read( column, 2 );
-	record.dataStream().seek( 2, Excel::Stream::FromCurrent );
-	const auto data = loadString( record.dataStream(), record.borders(), 2, BOF::BIFF7 );
-
-	storage.onCell( sheetIdx, row, column, data );
-}
-
-//
-// doubleFromRK
-//
-
-inline double
-doubleFromRK( uint32_t rk )
-{
-	double num = 0;
-
-	if( rk & 0x02 )
-	{
-		// int32_t
-		num = (double) (rk >> 2);
-	}
-	else
-	{
-		// hi words of IEEE num
-		*((uint32_t *)&num+1) = rk & 0xFFFFFFFC;
-		*((uint32_t *)&num) = 0;
-	}
-
-	if( rk & 0x01 )
-		// divide by 100
-		num /= 100;
-
-	return num;
-} // doubleFromRK
-
-inline void
-Parser::handleRK( Record & record, size_t sheetIdx, IStorage & storage )
-{
-	int16_t row = 0;
-	int16_t column = 0;
-	uint32_t rk = 0;
-
-	record.dataStream().read( row, 2 );
-	record.dataStream().read( column, 2 );
-
-	record.dataStream().seek( 2, Stream::FromCurrent );
-	record.dataStream().read( rk, 4 );
-
-	storage.onCell( sheetIdx, row, column, doubleFromRK( rk ) );
-}
-
-inline void
-Parser::handleMULRK( Record & record, size_t sheetIdx, IStorage & storage )
-{
-	int16_t row = 0;
-	int16_t colFirst = 0;
-	int16_t colLast = 0;
-
-	record.dataStream().read( row, 2 );
-	record.dataStream().read( colFirst, 2 );
-
-	int32_t pos = record.dataStream().pos();
-
-	record.dataStream().seek( -2, Stream::FromEnd );
-
-	record.dataStream().read( colLast, 2 );
-
-	record.dataStream().seek( pos, Stream::FromBeginning );
-
-	const int16_t rkCount = colLast - colFirst + 1;
-
-	for( int16_t i = 0; i < rkCount; ++i )
-	{
-		uint32_t rk = 0;
-
-		record.dataStream().seek( 2, Stream::FromCurrent );
-
-		record.dataStream().read( rk, 4 );
-
-		storage.onCell( sheetIdx, row, colFirst + i, doubleFromRK( rk ) );
-	}
-}
-
-inline void
-Parser::handleNUMBER( Record & record, size_t sheetIdx, IStorage & storage )
-{
-	int16_t row = 0;
-	int16_t column = 0;
-
-	record.dataStream().read( row, 2 );
-	record.dataStream().read( column, 2 );
-
-	record.dataStream().seek( 2, Stream::FromCurrent );
-
-	union {
-		double m_asDouble;
-		uint64_t m_asLongLong;
-	} doubleAndLongLong;
-
-	record.dataStream().read( doubleAndLongLong.m_asLongLong, 8 );
-
-	storage.onCell( sheetIdx, row, column, doubleAndLongLong.m_asDouble );
-}
-
-inline void
-Parser::handleFORMULA( Record & record, Stream & stream, size_t sheetIdx, IStorage & storage )
-{
-	Formula formula( record );
-
-	if( formula.valueType() == Formula::StringValue )
-	{
-		Record stringRecord( stream );
-
-		std::vector< int32_t > borders;
-
-		formula.setString( loadString( stringRecord.dataStream(), borders ) );
-	}
-
-	storage.onCell( sheetIdx, formula );
-}
-
-} /* namespace Excel */
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+// C++ include.
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <system_error>
+#include <memory>
+#include <algorithm>
+#include <type_traits>
+
+// Excel include.
+#include "storage.hpp"
+#include "sheet.hpp"
+#include "options.hpp"
+#include "info.hpp"
+#include "dimension.hpp"
+#include "rk.hpp"
+
+#include "compoundfile/compoundfile.hpp"
+#include "compoundfile/compoundfile_exceptions.hpp"
+
+namespace Excel {
+
+//
+// StorageRef
+//
+
+/*!
+	Reference to the storage in Parser's methods. The storage type isn't
+	deduced from the argument, so the storage is IStorage with virtual
+	handlers unless the type is given explicitly.
+*/
+template< typename Storage >
+using StorageRef = typename std::enable_if< true, Storage >::type &;
+
+
+//
+// Parser
+//
+
+/*!
+	Parser of XLS file.
+
+	Methods with the storage are templates on the type of the storage,
+	it's IStorage by default and handlers are called virtually. If the
+	type is given explicitly, e.g. Parser::loadBook< MyStorage >( fileName,
+	storage ), handlers are called directly and may be inlined into the
+	parser. Such storage should have all handlers of IStorage accessible
+	by Parser, it doesn't have to derive from IStorage, but if it does
+	it should be final to avoid virtual calls.
+*/
+class Parser final {
+public:
+	//! Load WorkBook from stream.
+	template< typename Storage = IStorage >
+	static void loadBook( std::istream & fileStream, StorageRef< Storage > storage,
+		const std::string & fileName = "<custom-stream>",
+		const LoadOptions & options = LoadOptions() );
+
+	//! Load WorkBook from file, file is memory mapped if possible.
+	template< typename Storage = IStorage >
+	static void loadBook( const std::string & fileName, StorageRef< Storage > storage,
+		const LoadOptions & options = LoadOptions() );
+
+	//! Load WorkBook from memory block, the data is read in place without copying.
+	template< typename Storage = IStorage >
+	static void loadBook( const void * data, size_t size, StorageRef< Storage > storage,
+		const std::string & fileName = "<memory-buffer>",
+		const LoadOptions & options = LoadOptions() );
+
+	//! Load WorkBook from compound file.
+	template< typename Storage = IStorage >
+	static void loadBook( CompoundFile::File & file, StorageRef< Storage > storage,
+		const LoadOptions & options = LoadOptions() );
+
+	/*!
+		\return Metadata of the workbook: date mode, sheets and used ranges
+		of worksheets. Only the globals substream and the beginning of each
+		worksheet up to the DIMENSION record are read, cells are not.
+	*/
+	static BookInfo inspectBook( std::istream & fileStream,
+		const std::string & fileName = "<custom-stream>" );
+
+	//! \return Metadata of the workbook in the file, file is memory mapped if possible.
+	static BookInfo inspectBook( const std::string & fileName );
+
+	//! \return Metadata of the workbook in the memory block.
+	static BookInfo inspectBook( const void * data, size_t size,
+		const std::string & fileName = "<memory-buffer>" );
+
+	//! \return Metadata of the workbook in the compound file.
+	static BookInfo inspectBook( CompoundFile::File & file );
+
+	//! \return Directory of the workbook stream.
+	static CompoundFile::Directory workbookDirectory( const CompoundFile::File & file );
+
+	//! Load metadata from the globals substream.
+	static void inspectGlobals( BookInfo & info, Stream & stream );
+
+	//! Load used range of the worksheet.
+	static Dimension inspectSheet( const BoundSheet & boundSheet, Stream & stream );
+
+	//! \return Types of the records \a storage wants, see IStorage::recordFilter().
+	template< typename Storage >
+	static auto storageRecordFilter( const Storage & storage, int )
+		-> decltype( storage.recordFilter() );
+
+	//! \return All types of the records if \a storage doesn't declare them.
+	template< typename Storage >
+	static RecordFilter storageRecordFilter( const Storage & storage, long );
+
+	//! \return Table to load SST into, see IStorage::sharedStringTable().
+	template< typename Storage >
+	static auto storageSharedStringTable( Storage & storage, int )
+		-> decltype( storage.sharedStringTable() );
+
+	//! \return nullptr if \a storage doesn't have the table.
+	template< typename Storage >
+	static SharedStringTable * storageSharedStringTable( Storage & storage, long );
+
+	//! Store document date mode.
+	template< typename Storage = IStorage >
+	static void handleDateMode( Record & r, StorageRef< Storage > storage );
+
+	//! Load sheets from file.
+	template< typename Storage = IStorage >
+	static void loadGlobals( std::vector< BoundSheet > & boundSheets, 
+		Stream & stream, StorageRef< Storage > storage );
+
+	//! Load boundsheet.
+	static BoundSheet parseBoundSheet( Record & record, BOF::BiffVersion ver );
+
+	//! Load WorkSheets.
+	template< typename Storage = IStorage >
+	static void loadWorkSheets( const std::vector< BoundSheet > & boundSheets,
+		Stream & stream, StorageRef< Storage > storage,
+		const LoadOptions & options = LoadOptions() );
+
+	/*!
+		Load WorkSheets with LoadOptions::threadsCount threads, each
+		worksheet is parsed with its own stream of the workbook \a dir.
+		The file should be in memory.
+	*/
+	template< typename Storage = IStorage >
+	static void loadWorkSheets( const std::vector< BoundSheet > & boundSheets,
+		CompoundFile::File & file, const CompoundFile::Directory & dir,
+		StorageRef< Storage > storage, const LoadOptions & options );
+
+	//! \return Should the sheet with the given index be loaded.
+	static bool isWorkSheetToLoad( size_t sheetIdx, const BoundSheet & boundSheet,
+		const LoadOptions & options );
+
+	//! Parse shared string table.
+	template< typename Storage = IStorage >
+	static void parseSST( Record & record, StorageRef< Storage > storage );
+
+	//! Load WorkSheet.
+	template< typename Storage = IStorage >
+	static void loadSheet( size_t sheetIdx, const BoundSheet & boundSheet,
+		Stream & stream, StorageRef< Storage > storage );
+
+	/*!
+		\return \a size bytes of the record's data from the current position,
+		the whole size is checked once instead of every field.
+
+		\throw Exception if the record is shorter.
+	*/
+	static const char * recordData( Record & record, size_t size );
+
+	//! Handle DIMENSION.
+	template< typename Storage = IStorage >
+	static void handleDimension( Record & record, size_t sheetIdx, StorageRef< Storage > storage );
+
+	//! Handle label SST.
+	template< typename Storage = IStorage >
+	static void handleLabelSST( Record & record, size_t sheetIdx, StorageRef< Storage > storage );
+
+	//! Handle label.
+	template< typename Storage = IStorage >
+	static void handleLabel( Record & record, size_t sheetIdx, StorageRef< Storage > storage );
+
+	//! Handle RK.
+	template< typename Storage = IStorage >
+	static void handleRK( Record & record, size_t sheetIdx, StorageRef< Storage > storage );
+
+	//! Handle MULRK.
+	template< typename Storage = IStorage >
+	static void handleMULRK( Record & record, size_t sheetIdx, StorageRef< Storage > storage );
+
+	//! Handle NUMBER.
+	template< typename Storage = IStorage >
+	static void handleNUMBER( Record & record, size_t sheetIdx, StorageRef< Storage > storage );
+
+	//! Handle FORMULA.
+	template< typename Storage = IStorage >
+	static void handleFORMULA( Record & record, Stream & stream, size_t sheetIdx,
+		StorageRef< Storage > storage );
+}; // class Parser
+
+template< typename Storage >
+inline void
+Parser::loadBook( std::istream & fileStream, StorageRef< Storage > storage,
+	const std::string & fileName, const LoadOptions & options )
+{
+	try {
+		CompoundFile::File file( fileStream, fileName );
+
+		loadBook< Storage >( file, storage, options );
+	}
+	catch( const CompoundFile::Exception & x )
+	{
+		throw Exception( x.whatAsWString() );
+	}
+}
+
+template< typename Storage >
+inline void
+Parser::loadBook( const std::string & fileName, StorageRef< Storage > storage,
+	const LoadOptions & options )
+{
+	try {
+		CompoundFile::File file( fileName );
+
+		loadBook< Storage >( file, storage, options );
+	}
+	catch( const CompoundFile::Exception & x )
+	{
+		throw Exception( x.whatAsWString() );
+	}
+}
+
+template< typename Storage >
+inline void
+Parser::loadBook( const void * data, size_t size, StorageRef< Storage > storage,
+	const std::string & fileName, const LoadOptions & options )
+{
+	try {
+		CompoundFile::File file( data, size, fileName );
+
+		loadBook< Storage >( file, storage, options );
+	}
+	catch( const CompoundFile::Exception & x )
+	{
+		throw Exception( x.whatAsWString() );
+	}
+}
+
+template< typename Storage >
+inline void
+Parser::loadBook( CompoundFile::File & file, StorageRef< Storage > storage,
+	const LoadOptions & options )
+{
+	static_assert( sizeof( double ) == 8,
+		"Unsupported platform: double has to be 8 bytes." );
+
+	try {
+		const CompoundFile::Directory dir = workbookDirectory( file );
+
+		auto stream = file.stream( dir );
+
+		std::vector< BoundSheet > boundSheets;
+
+		loadGlobals< Storage >( boundSheets, *stream, storage );
+
+		if( options.threadsCount != 1 && file.isInMemory() )
+			loadWorkSheets< Storage >( boundSheets, file, dir, storage, options );
+		else
+			loadWorkSheets< Storage >( boundSheets, *stream, storage, options );
+	}
+	catch( const CompoundFile::Exception & x )
+	{
+		throw Exception( x.whatAsWString() );
+	}
+}
+
+inline BookInfo
+Parser::inspectBook( std::istream & fileStream, const std::string & fileName )
+{
+	try {
+		CompoundFile::File file( fileStream, fileName );
+
+		return inspectBook( file );
+	}
+	catch( const CompoundFile::Exception & x )
+	{
+		throw Exception( x.whatAsWString() );
+	}
+}
+
+inline BookInfo
+Parser::inspectBook( const std::string & fileName )
+{
+	try {
+		CompoundFile::File file( fileName );
+
+		return inspectBook( file );
+	}
+	catch( const CompoundFile::Exception & x )
+	{
+		throw Exception( x.whatAsWString() );
+	}
+}
+
+inline BookInfo
+Parser::inspectBook( const void * data, size_t size, const std::string & fileName )
+{
+	try {
+		CompoundFile::File file( data, size, fileName );
+
+		return inspectBook( file );
+	}
+	catch( const CompoundFile::Exception & x )
+	{
+		throw Exception( x.whatAsWString() );
+	}
+}
+
+inline BookInfo
+Parser::inspectBook( CompoundFile::File & file )
+{
+	try {
+		auto stream = file.stream( workbookDirectory( file ) );
+
+		BookInfo info;
+
+		inspectGlobals( info, *stream );
+
+		for( auto & sheet : info.sheets )
+		{
+			if( sheet.boundSheet.sheetType() == BoundSheet::WorkSheet )
+				sheet.dimension = inspectSheet( sheet.boundSheet, *stream );
+		}
+
+		return info;
+	}
+	catch( const CompoundFile::Exception & x )
+	{
+		throw Exception( x.whatAsWString() );
+	}
+}
+
+inline CompoundFile::Directory
+Parser::workbookDirectory( const CompoundFile::File & file )
+{
+	const CompoundFile::Directory * dir = file.findDirectory( L"Workbook" );
+
+	return ( dir ? *dir : file.directory( L"Book" ) );
+}
+
+inline void
+Parser::inspectGlobals( BookInfo & info, Stream & stream )
+{
+	static const RecordFilter filter = { XL_BOF, XL_BOUNDSHEET, XL_DATEMODE };
+
+	BOF bof;
+	std::vector< char > buffer;
+
+	Record r( stream.byteOrder() );
+
+	while( r.read( stream, buffer, filter ) )
+	{
+		switch( r.code() )
+		{
+			case XL_BOF :
+				bof.parse( r );
+				break;
+
+			case XL_FILEPASS :
+				throw Exception( L"This file is protected. Decryption is not implemented yet." );
+
+			case XL_BOUNDSHEET :
+				info.sheets.push_back( SheetInfo( parseBoundSheet( r, bof.version() ) ) );
+				break;
+
+			case XL_DATEMODE :
+			{
+				uint16_t mode = 0;
+
+				r.dataStream().read( mode, 2 );
+
+				info.dateMode = ( mode ? 1 : 0 );
+			}
+				break;
+
+			case XL_EOF :
+				return;
+
+			case XL_UNKNOWN :
+				throw Exception( L"Wrong format." );
+
+			default:
+				break;
+		}
+	}
+
+	throw Exception( L"Unexpected end of file." );
+}
+
+inline Dimension
+Parser::inspectSheet( const BoundSheet & boundSheet, Stream & stream )
+{
+	stream.seek( boundSheet.BOFPosition(), Stream::FromBeginning );
+
+	std::vector< char > buffer;
+	Dimension dimension;
+	BOF bof;
+
+	{
+		Record record( stream, buffer );
+
+		bof.parse( record );
+	}
+
+	if( bof.version() != BOF::BIFF8 )
+		return dimension;
+
+	static const RecordFilter filter = { XL_DIMENSION };
+
+	Record record( stream.byteOrder() );
+
+	while( record.read( stream, buffer, filter ) )
+	{
+		switch( record.code() )
+		{
+			case XL_DIMENSION :
+				dimension.parse( record );
+				return dimension;
+
+			// DIMENSION precedes cells, so there is no one if cells are met.
+			case XL_ROW :
+			case XL_LABELSST :
+			case XL_LABEL :
+			case XL_RK :
+			case XL_RK2 :
+			case XL_MULRK :
+			case XL_NUMBER :
+			case XL_FORMULA :
+			case XL_BOOLERR :
+			case XL_EOF :
+				return dimension;
+
+			case XL_UNKNOWN :
+				throw Exception( L"Wrong format." );
+
+			default:
+				break;
+		}
+	}
+
+	throw Exception( L"Unexpected end of file." );
+}
+
+template< typename Storage >
+inline auto
+Parser::storageRecordFilter( const Storage & storage, int )
+	-> decltype( storage.recordFilter() )
+{
+	return storage.recordFilter();
+}
+
+template< typename Storage >
+inline RecordFilter
+Parser::storageRecordFilter( const Storage &, long )
+{
+	return RecordFilter::all();
+}
+
+template< typename Storage >
+inline auto
+Parser::storageSharedStringTable( Storage & storage, int )
+	-> decltype( storage.sharedStringTable() )
+{
+	return storage.sharedStringTable();
+}
+
+template< typename Storage >
+inline SharedStringTable *
+Parser::storageSharedStringTable( Storage &, long )
+{
+	return nullptr;
+}
+
+template< typename Storage >
+inline void
+Parser::handleDateMode( Record & r, StorageRef< Storage > storage )
+{
+	uint16_t mode = 0;
+
+	r.dataStream().read( mode, 2 );
+
+	storage.onDateMode( mode );
+}
+
+template< typename Storage >
+inline void
+Parser::loadGlobals( std::vector< BoundSheet > & boundSheets, 
+	Stream & stream, StorageRef< Storage > storage )
+{
+	// Data of other records is skipped, only their codes are read.
+	RecordFilter filter = { XL_SST, XL_DATEMODE };
+	filter &= storageRecordFilter< Storage >( storage, 0 );
+	filter |= RecordFilter{ XL_BOF, XL_FILEPASS, XL_BOUNDSHEET, XL_EOF, XL_UNKNOWN };
+
+	BOF bof;
+	std::vector< char > buffer;
+
+	Record r( stream.byteOrder() );
+
+	while( r.read( stream, buffer, filter ) )
+	{
+		if( !filter.contains( r.code() ) )
+			continue;
+
+		switch( r.code() )
+		{
+			case XL_BOF :
+				bof.parse( r );
+				break;
+
+			case XL_FILEPASS :
+				throw Exception( L"This file is protected. Decryption is not implemented yet." );
+
+			case XL_SST :
+				parseSST< Storage >( r, storage );
+				break;
+
+			case XL_BOUNDSHEET :
+				boundSheets.push_back( parseBoundSheet( r, bof.version() ) );
+				break;
+
+			case XL_DATEMODE :
+				handleDateMode< Storage >( r, storage );
+				break;
+
+			case XL_EOF :
+				return;
+
+			case XL_UNKNOWN :
+				throw Exception( L"Wrong format." );
+
+			default:
+				break;
+		}
+	}
+
+	throw Exception( L"Unexpected end of file." );
+}
+
+inline BoundSheet
+Parser::parseBoundSheet( Record & record, BOF::BiffVersion ver )
+{
+	int32_t pos = 0;
+	int16_t sheetType = 0;
+	std::wstring sheetName;
+
+	record.dataStream().read( pos, 4 );
+
+	record.dataStream().read( sheetType, 2 );
+
+	sheetName = loadString( record.dataStream(), record.borders(), 1, ver );
+
+	return BoundSheet( pos,
+		BoundSheet::convertSheetType( sheetType ),
+		sheetName );
+}
+
+inline bool
+Parser::isWorkSheetToLoad( size_t sheetIdx, const BoundSheet & boundSheet,
+	const LoadOptions & options )
+{
+	return ( boundSheet.sheetType() == BoundSheet::WorkSheet &&
+		( !options.sheetFilter || options.sheetFilter( sheetIdx, boundSheet.sheetName() ) ) );
+}
+
+template< typename Storage >
+inline void
+Parser::loadWorkSheets( const std::vector< BoundSheet > & boundSheets,
+	Stream & stream, StorageRef< Storage > storage, const LoadOptions & options )
+{
+	for( size_t i = 0; i < boundSheets.size(); ++i )
+	{
+		if( isWorkSheetToLoad( i, boundSheets[i], options ) )
+		{
+			storage.onSheet( i, boundSheets[i].sheetName() );
+			loadSheet< Storage >( i, boundSheets[i], stream, storage );
+		}
+	}
+}
+
+template< typename Storage >
+inline void
+Parser::loadWorkSheets( const std::vector< BoundSheet > & boundSheets,
+	CompoundFile::File & file, const CompoundFile::Directory & dir,
+	StorageRef< Storage > storage, const LoadOptions & options )
+{
+	std::vector< size_t > sheets;
+
+	for( size_t i = 0; i < boundSheets.size(); ++i )
+	{
+		if( isWorkSheetToLoad( i, boundSheets[i], options ) )
+		{
+			storage.onSheet( i, boundSheets[i].sheetName() );
+			sheets.push_back( i );
+		}
+	}
+
+	// Streams are opened here as File is not thread-safe, reading of
+	// the streams over the file's data is.
+	std::vector< std::unique_ptr< Stream > > streams;
+	streams.reserve( sheets.size() );
+
+	for( size_t i = 0; i < sheets.size(); ++i )
+		streams.push_back( file.stream( dir ) );
+
+	const size_t threadsCount = ( options.threadsCount ? options.threadsCount :
+		std::max< size_t > ( std::thread::hardware_concurrency(), 1 ) );
+
+	std::vector< std::exception_ptr > errors( sheets.size() );
+	std::atomic< size_t > next( 0 );
+
+	auto worker = [ & ]()
+	{
+		for( size_t i = next++; i < sheets.size(); i = next++ )
+		{
+			try {
+				loadSheet< Storage >( sheets[ i ], boundSheets[ sheets[ i ] ], *streams[ i ], storage );
+			}
+			catch( ... )
+			{
+				errors[ i ] = std::current_exception();
+			}
+		}
+	};
+
+	std::vector< std::thread > threads;
+	threads.reserve( threadsCount - 1 );
+
+	try {
+		for( size_t i = 1; i < std::min( threadsCount, sheets.size() ); ++i )
+			threads.emplace_back( worker );
+	}
+	catch( const std::system_error & )
+	{
+		// Sheets will be parsed with already started threads.
+	}
+
+	worker();
+
+	for( auto & t : threads )
+		t.join();
+
+	for( const auto & error : errors )
+	{
+		if( error )
+			std::rethrow_exception( error );
+	}
+}
+
+template< typename Storage >
+inline void
+Parser::parseSST( Record & record, StorageRef< Storage > storage )
+{
+	int32_t totalStrings = 0;
+	int32_t uniqueStrings = 0;
+
+	record.dataStream().read( totalStrings, 4 );
+	record.dataStream().read( uniqueStrings, 4 );
+
+	SharedStringTable * table = storageSharedStringTable< Storage >( storage, 0 );
+
+	if( table )
+	{
+		table->clear();
+		// Each character takes at least one byte of the record, so
+		// characters are allocated once.
+		table->reserve( static_cast< size_t > ( std::max( uniqueStrings, 0 ) ),
+			record.length() );
+
+		for( int32_t i = 0; i < uniqueStrings; ++i )
+			table->appendWith( [ &record ] ( std::vector< wchar_t > & chars )
+				{
+					appendString( record.dataStream(), record.borders(), chars );
+				} );
+
+		table->shrinkToFit();
+
+		return;
+	}
+
+	for( int32_t i = 0; i < uniqueStrings; ++i )
+		storage.onSharedString( uniqueStrings, i,
+			loadString( record.dataStream(), record.borders() ) );
+}
+
+template< typename Storage >
+inline void
+Parser::loadSheet( size_t sheetIdx, const BoundSheet & boundSheet,
+	Stream & stream, StorageRef< Storage > storage )
+{
+	stream.seek( boundSheet.BOFPosition(), Stream::FromBeginning );
+	BOF bof;
+
+	{
+		Record record( stream );
+
+		bof.parse( record );
+	}
+
+	if( bof.version() != BOF::BIFF8 )
+		throw Exception( L"Unsupported BIFF version. BIFF8 is supported only." );
+
+	// Formatting, ROW, DBCELL, drawings, comments, etc. are skipped.
+	RecordFilter filter = { XL_DIMENSION, XL_LABELSST, XL_LABEL, XL_RK, XL_RK2,
+		XL_MULRK, XL_NUMBER, XL_FORMULA };
+	filter &= storageRecordFilter< Storage >( storage, 0 );
+	filter |= RecordFilter{ XL_EOF, XL_UNKNOWN };
+
+	std::vector< char > buffer;
+
+	Record record( stream.byteOrder() );
+
+	while( record.read( stream, buffer, filter ) )
+	{
+		if( !filter.contains( record.code() ) )
+			continue;
+
+		switch( record.code() )
+		{
+			case XL_DIMENSION :
+				handleDimension< Storage >( record, sheetIdx, storage );
+				break;
+
+			case XL_LABELSST :
+				handleLabelSST< Storage >( record, sheetIdx, storage );
+				break;
+
+			case XL_LABEL :
+				handleLabel< Storage >( record, sheetIdx, storage );
+				break;
+
+			case XL_RK :
+			case XL_RK2 :
+				handleRK< Storage >( record, sheetIdx, storage );
+				break;
+
+			case XL_MULRK :
+				handleMULRK< Storage >( record, sheetIdx, storage );
+				break;
+
+			case XL_NUMBER :
+				handleNUMBER< Storage >( record, sheetIdx, storage );
+				break;
+
+			case XL_FORMULA :
+				handleFORMULA< Storage >( record, stream, sheetIdx, storage );
+				break;
+
+			case XL_EOF :
+				return;
+
+			case XL_UNKNOWN :
+				throw Exception( L"Wrong format." );
+
+			default:
+				break;
+		}
+	}
+
+	throw Exception( L"Unexpected end of file." );
+}
+
+inline const char *
+Parser::recordData( Record & record, size_t size )
+{
+	const char * data = record.dataStream().readInPlace( size );
+
+	if( !data )
+		throw Exception( L"Unexpected end of file." );
+
+	return data;
+}
+
+template< typename Storage >
+inline void
+Parser::handleDimension( Record & record, size_t sheetIdx, StorageRef< Storage > storage )
+{
+	Dimension dimension;
+
+	dimension.parse( record );
+
+	storage.onSheetDimension( sheetIdx, dimension );
+}
+
+template< typename Storage >
+inline void
+Parser::handleLabelSST( Record & record, size_t sheetIdx, StorageRef< Storage > storage )
+{
+	const Stream & stream = record.dataStream();
+	const char * data = recordData( record, 10 );
+
+	const auto row = stream.fromBytes< int16_t >( data, 2 );
+	const auto column = stream.fromBytes< int16_t >( data + 2, 2 );
+	const auto sstIndex = stream.fromBytes< int32_t >( data + 6, 4 );
+
+	storage.onCellSharedString( sheetIdx, row, column, sstIndex );
+}
+
+template< typename Storage >
+inline void
+Parser::handleLabel( Record & record, size_t sheetIdx, StorageRef< Storage > storage )
+{
+	int16_t row = 0;
+	int16_t column = 0;
+
+	record.dataStream().read( row, 2 );
+	record.dataStream().read( column, 2 );
+	record.dataStream().seek( 2, Excel::Stream::FromCurrent );
+	const auto data = loadString( record.dataStream(), record.borders(), 2, BOF::BIFF7 );
+
+	storage.onCell( sheetIdx, row, column, data );
+}
+
+//! Count of cells of MULRK record passed to IStorage::onCells() at once.
+static const size_t c_mulRKChunk = 256;
+
+template< typename Storage >
+inline void
+Parser::handleRK( Record & record, size_t sheetIdx, StorageRef< Storage > storage )
+{
+	const Stream & stream = record.dataStream();
+	const char * data = recordData( record, 10 );
+
+	const auto row = stream.fromBytes< int16_t >( data, 2 );
+	const auto column = stream.fromBytes< int16_t >( data + 2, 2 );
+	const auto rk = stream.fromBytes< uint32_t >( data + 6, 4 );
+
+	storage.onCell( sheetIdx, row, column, doubleFromRK( rk ) );
+}
+
+template< typename Storage >
+inline void
+Parser::handleMULRK( Record & record, size_t sheetIdx, StorageRef< Storage > storage )
+{
+	const Stream & stream = record.dataStream();
+
+	if( record.length() < 6 )
+		throw Exception( L"Unexpected end of file." );
+
+	const char * data = recordData( record, record.length() );
+
+	const auto row = stream.fromBytes< int16_t >( data, 2 );
+	const auto colFirst = stream.fromBytes< int16_t >( data + 2, 2 );
+	const auto colLast = stream.fromBytes< int16_t >( data + record.length() - 2, 2 );
+
+	const int16_t rkCount = colLast - colFirst + 1;
+
+	if( rkCount <= 0 )
+		return;
+
+	if( static_cast< size_t > ( rkCount ) * 6 + 6 > record.length() )
+		throw Exception( L"Unexpected end of file." );
+
+	data += 4;
+
+	const bool lowByteFirst = stream.isSystemByteOrder();
+
+	double values[ c_mulRKChunk ];
+
+	for( size_t first = 0; first < static_cast< size_t > ( rkCount ); first += c_mulRKChunk )
+	{
+		const size_t count = std::min( c_mulRKChunk, static_cast< size_t > ( rkCount ) - first );
+
+		doublesFromRKs( data + first * 6, count, lowByteFirst, values );
+
+		storage.onCells( sheetIdx, row, colFirst + first, values, count );
+	}
+}
+
+template< typename Storage >
+inline void
+Parser::handleNUMBER( Record & record, size_t sheetIdx, StorageRef< Storage > storage )
+{
+	const Stream & stream = record.dataStream();
+	const char * data = recordData( record, 14 );
+
+	const auto row = stream.fromBytes< int16_t >( data, 2 );
+	const auto column = stream.fromBytes< int16_t >( data + 2, 2 );
+
+	union {
+		double m_asDouble;
+		uint64_t m_asLongLong;
+	} doubleAndLongLong;
+
+	doubleAndLongLong.m_asLongLong = stream.fromBytes< uint64_t >( data + 6, 8 );
+
+	storage.onCell( sheetIdx, row, column, doubleAndLongLong.m_asDouble );
+}
+
+template< typename Storage >
+inline void
+Parser::handleFORMULA( Record & record, Stream & stream, size_t sheetIdx, StorageRef< Storage > storage )
+{
+	Formula formula( record );
+
+	if( formula.valueType() == Formula::StringValue )
+	{
+		Record stringRecord( stream );
+
+		std::vector< int32_t > borders;
+
+		formula.setString( loadString( stringRecord.dataStream(), borders ) );
+	}
+
+	storage.onCell( sheetIdx, formula );
+}
+
+} /* namespace Excel */
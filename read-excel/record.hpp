@@ -1,295 +1,565 @@
-
-/*
-	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
-	SPDX-License-Identifier: MIT
-*/
-
-#ifndef EXCEL__RECORD_HPP__INCLUDED
-#define EXCEL__RECORD_HPP__INCLUDED
-
-// Excel include.
-#include "stream.hpp"
-#include "exceptions.hpp"
-
-// C++ include.
-#include <vector>
-#include <sstream>
-
-
-namespace Excel {
-
-
-//
-// RecordSubstream
-//
-
-class RecordSubstream
-	:	public Stream
-{
-	friend class Record;
-
-public:
-	explicit RecordSubstream( Stream::ByteOrder byteOrder );
-
-	//! Read one byte from the stream.
-	char getByte() override;
-
-	//! \return true if EOF reached.
-	bool eof() const override;
-
-	//! Seek stream to new position.
-	void seek( int32_t pos, SeekType type = FromBeginning ) override;
-
-	//! \return Position in the stream.
-	int32_t pos() override;
-
-protected:
-	//! Write data to the stream.
-	void write( const char * data, size_t size );
-
-private:
-	//! Stream.
-	std::stringstream m_stream;
-}; // class RecordSubstream
-
-
-//
-// RecordType
-//
-
-//! Types of the Excel's records.
-enum RecordType {
-	XL_BOF = 0x809,
-	XL_EOF = 0x0A,
-	XL_BOUNDSHEET = 0x85,
-	XL_DIMENSION = 0x200,
-	XL_ROW = 0x208,
-	XL_NOTE = 0x1C,
-	XL_TXO = 0x1B6,
-	XL_RK = 0x7E,
-	XL_RK2 = 0x27E,
-	XL_MULRK = 0xBD,
-	XL_INDEX = 0x20B,
-	XL_SST = 0xFC,
-	XL_EXTSST = 0xFF,
-	XL_CONTINUE = 0x3C,
-	XL_LABEL = 0x204,
-	XL_LABELSST = 0xFD,
-	XL_NUMBER = 0x203,
-	XL_NAME = 0x18,
-	XL_ARRAY = 0x221,
-	XL_STRING = 0x207,
-	XL_FORMULA = 0x06,
-	XL_FORMAT = 0x41E,
-	XL_XF = 0xE0,
-	XL_BOOLERR = 0x205,
-	XL_DATEMODE = 0x22,
-	XL_FILEPASS = 0x2F,
-	XL_UNKNOWN = 0xFFFF
-}; // enum RecordType
-
-//
-// Record
-//
-
-//! Record in the Excel file.
-class Record {
-public:
-	Record( Stream & stream );
-	~Record();
-
-	//! \return Record's code.
-	uint16_t code() const;
-
-	//! \return Record's length.
-	uint32_t length() const;
-
-	//! \return Stream with record's data.
-	Stream & dataStream();
-
-	//! \return Borders indexes of the continue records.
-	const std::vector< int32_t > & borders() const;
-
-private:
-	//! Read record from the stream.
-	void read( Stream & stream );
-
-private:
-	//! Record's code.
-	uint16_t m_code;
-	//! Record's length.
-	uint32_t m_length;
-	//! Record's substream.
-	RecordSubstream m_stream;
-	//! Borders indexes of the continue records.
-	std::vector< int32_t > m_borders;
-}; // class Record
-
-//
-// RecordSubstream
-//
-
-inline
-RecordSubstream::RecordSubstream( Stream::ByteOrder byteOrder )
-	:	Stream( byteOrder )
-{
-}
-
-inline char
-RecordSubstream::getByte()
-{
-	char ch;
-	m_stream.get( ch );
-
-	return ch;
-}
-
-inline bool
-RecordSubstream::eof() const
-{
-	return m_stream.eof();
-}
-
-inline void
-RecordSubstream::seek( int32_t pos, SeekType type )
-{
-	std::ios::seekdir dir;
-
-	if( type == Stream::FromBeginning )
-		dir = std::ios::beg;
-	else if( type == Stream::FromCurrent )
-		dir = std::ios::cur;
-	else
-		dir = std::ios::end;
-
-	m_stream.seekg( pos, dir );
-}
-
-inline int32_t
-RecordSubstream::pos()
-{
-	return static_cast< int32_t > ( m_stream.tellg() );
-}
-
-inline void
-RecordSubstream::write( const char * data, size_t size )
-{
-	m_stream.write( data, size );
-}
-
-
-//
-// Record
-//
-
-inline
-Record::Record( Stream & stream )
-	:	m_code( 0 )
-	,	m_length( 0 )
-	,	m_stream( stream.byteOrder() )
-{
-	read( stream );
-}
-
-inline
-Record::~Record()
-{
-}
-
-inline void
-Record::read( Stream & stream )
-{
-	stream.read( m_code, 2 );
-	stream.read( m_length, 2 );
-
-	uint16_t nextRecordCode = 0;
-	uint16_t nextRecordLength = 0;
-
-	std::vector< char > data;
-
-	if( m_length )
-	{
-		data.reserve( m_length );
-
-		for( size_t i = 0; i < m_length; ++i )
-		{
-			data.push_back( stream.getByte() );
-
-			if( stream.eof() )
-				throw Exception( L"Unexpected end of file." );
-		}
-	}
-
-	try {
-		stream.read( nextRecordCode, 2 );
-	}
-	catch( const Exception & )
-	{
-		nextRecordCode = XL_UNKNOWN;
-	}
-
-	while( nextRecordCode == XL_CONTINUE )
-	{
-		m_borders.push_back( m_length );
-
-		stream.read( nextRecordLength, 2 );
-
-		data.reserve( data.size() + nextRecordLength );
-
-		if( nextRecordLength )
-		{
-			for( uint16_t i = 0; i < nextRecordLength; ++i )
-			{
-				data.push_back( stream.getByte() );
-
-				if( stream.eof() )
-					throw Exception( L"Unexpected end of file." );
-			}
-		}
-
-		m_length += nextRecordLength;
-
-		try {
-			stream.read( nextRecordCode, 2 );
-		}
-		catch( const Exception & )
-		{
-			nextRecordCode = XL_UNKNOWN;
-		}
-	}
-
-	if( !stream.eof() )
-		stream.seek( -2, Stream::FromCurrent );
-
-	if( data.size() )
-		m_stream.write( &data[ 0 ], data.size() );
-}
-
-inline uint16_t
-Record::code() const
-{
-	return m_code;
-}
-
-inline uint32_t
-Record::length() const
-{
-	return m_length;
-}
-
-inline Stream &
-Record::dataStream()
-{
-	return m_stream;
-}
-
-inline const std::vector< int32_t > &
-Record::borders() const
-{
-	return m_borders;
-}
-
-} /* namespace Excel */
-
-#endif // EXCEL__RECORD_HPP__INCLUDED
-
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef EXCEL__RECORD_HPP__INCLUDED
+#define EXCEL__RECORD_HPP__INCLUDED
+
+// Excel include.
+#include "stream.hpp"
+#include "exceptions.hpp"
+
+// C++ include.
+#include <vector>
+#include <cstring>
+#include <bitset>
+#include <initializer_list>
+
+
+namespace Excel {
+
+
+//
+// RecordSubstream
+//
+
+//! Cursor over the record's data, doesn't own and doesn't copy the data.
+class RecordSubstream
+	:	public Stream
+{
+	friend class Record;
+
+public:
+	explicit RecordSubstream( Stream::ByteOrder byteOrder );
+
+	//! Read one byte from the stream.
+	char getByte() override;
+
+	//! Read \a size bytes from the stream, \return false if EOF reached.
+	bool tryRead( char * data, size_t size ) override;
+
+	//! \return true if EOF reached.
+	bool eof() const override;
+
+	//! Seek stream to new position.
+	void seek( int32_t pos, SeekType type = FromBeginning ) override;
+
+	//! \return Position in the stream.
+	int32_t pos() override;
+
+	//! Read \a size bytes in place.
+	const char * readInPlace( size_t size ) override;
+
+protected:
+	//! Set data of the stream.
+	void setData( const char * data, size_t size );
+
+private:
+	//! Data.
+	const char * m_data;
+	//! Size of the data.
+	size_t m_size;
+	//! Position in the data, m_size + 1 if EOF reached.
+	size_t m_pos;
+}; // class RecordSubstream
+
+
+//
+// RecordType
+//
+
+//! Types of the Excel's records.
+enum RecordType {
+	XL_BOF = 0x809,
+	XL_EOF = 0x0A,
+	XL_BOUNDSHEET = 0x85,
+	XL_DIMENSION = 0x200,
+	XL_ROW = 0x208,
+	XL_NOTE = 0x1C,
+	XL_TXO = 0x1B6,
+	XL_RK = 0x7E,
+	XL_RK2 = 0x27E,
+	XL_MULRK = 0xBD,
+	XL_INDEX = 0x20B,
+	XL_SST = 0xFC,
+	XL_EXTSST = 0xFF,
+	XL_CONTINUE = 0x3C,
+	XL_LABEL = 0x204,
+	XL_LABELSST = 0xFD,
+	XL_NUMBER = 0x203,
+	XL_NAME = 0x18,
+	XL_ARRAY = 0x221,
+	XL_STRING = 0x207,
+	XL_FORMULA = 0x06,
+	XL_FORMAT = 0x41E,
+	XL_XF = 0xE0,
+	XL_BOOLERR = 0x205,
+	XL_DATEMODE = 0x22,
+	XL_FILEPASS = 0x2F,
+	XL_UNKNOWN = 0xFFFF
+}; // enum RecordType
+
+
+//
+// RecordFilter
+//
+
+/*!
+	Set of types of the records which data should be read. Data of other
+	records is skipped in the stream, only their codes are known.
+*/
+class RecordFilter {
+public:
+	//! Empty filter, data of no record is read.
+	RecordFilter();
+	RecordFilter( std::initializer_list< uint16_t > codes );
+
+	//! \return Filter with all types of the records.
+	static RecordFilter all();
+
+	//! \return Is the type of the record in the filter.
+	bool contains( uint16_t code ) const;
+
+	//! Add type of the record to the filter.
+	void add( uint16_t code );
+
+	//! Remove type of the record from the filter.
+	void remove( uint16_t code );
+
+	//! Leave types that are in both filters.
+	RecordFilter & operator &= ( const RecordFilter & other );
+
+	//! Add types of other filter.
+	RecordFilter & operator |= ( const RecordFilter & other );
+
+private:
+	//! Types of the records.
+	std::bitset< 0x10000 > m_codes;
+}; // class RecordFilter
+
+inline
+RecordFilter::RecordFilter()
+{
+}
+
+inline
+RecordFilter::RecordFilter( std::initializer_list< uint16_t > codes )
+{
+	for( const auto code : codes )
+		add( code );
+}
+
+inline RecordFilter
+RecordFilter::all()
+{
+	RecordFilter filter;
+	filter.m_codes.set();
+
+	return filter;
+}
+
+inline bool
+RecordFilter::contains( uint16_t code ) const
+{
+	return m_codes.test( code );
+}
+
+inline void
+RecordFilter::add( uint16_t code )
+{
+	m_codes.set( code );
+}
+
+inline void
+RecordFilter::remove( uint16_t code )
+{
+	m_codes.reset( code );
+}
+
+inline RecordFilter &
+RecordFilter::operator &= ( const RecordFilter & other )
+{
+	m_codes &= other.m_codes;
+
+	return *this;
+}
+
+inline RecordFilter &
+RecordFilter::operator |= ( const RecordFilter & other )
+{
+	m_codes |= other.m_codes;
+
+	return *this;
+}
+
+
+//
+// Record
+//
+
+/*!
+	Record in the Excel file.
+
+	Record's data is a view over the data of the parent stream if the
+	stream has it in memory (see Stream::readInPlace()), or over the
+	buffer with the copy of the data. So the record should not outlive
+	the parent stream.
+*/
+class Record {
+public:
+	//! Empty record, it's read by read().
+	explicit Record( Stream::ByteOrder byteOrder );
+	Record( Stream & stream );
+	/*!
+		\a buffer is used for the copy of the data when it can't be read in
+		place or when it's split by CONTINUE records, so one buffer can be
+		reused for a sequence of records. The record should not outlive
+		the buffer and the buffer should not be modified while the record
+		is in use.
+	*/
+	Record( Stream & stream, std::vector< char > & buffer );
+	~Record();
+
+	//! \return Record's code.
+	uint16_t code() const;
+
+	//! \return Record's length.
+	uint32_t length() const;
+
+	//! \return Stream with record's data.
+	Stream & dataStream();
+
+	//! \return Borders indexes of the continue records.
+	const std::vector< int32_t > & borders() const;
+
+	/*!
+		Read the next record from the stream, see the constructor with
+		\a buffer. It doesn't throw, so one record can be reused in the
+		loop over the stream.
+
+		\return false if the stream ends before the record.
+	*/
+	bool read( Stream & stream, std::vector< char > & buffer );
+
+	/*!
+		Read the next record from the stream if its type is in \a filter,
+		otherwise only the header is read and the data of the record with
+		its CONTINUE records is skipped in the stream. Data stream of the
+		skipped record is empty, length() is the length of the skipped data.
+
+		\return false if the stream ends before the record.
+	*/
+	bool read( Stream & stream, std::vector< char > & buffer, const RecordFilter & filter );
+
+private:
+	//! Read the record, skip its data if it's not in \a filter.
+	bool readRecord( Stream & stream, std::vector< char > & buffer,
+		const RecordFilter * filter );
+	//! Skip data of the record with the header read.
+	bool skipData( Stream & stream );
+
+private:
+	//! Record's code.
+	uint16_t m_code;
+	//! Record's length.
+	uint32_t m_length;
+	//! Record's substream.
+	RecordSubstream m_stream;
+	//! Borders indexes of the continue records.
+	std::vector< int32_t > m_borders;
+	//! Own buffer for the data.
+	std::vector< char > m_buffer;
+}; // class Record
+
+//
+// RecordSubstream
+//
+
+inline
+RecordSubstream::RecordSubstream( Stream::ByteOrder byteOrder )
+	:	Stream( byteOrder )
+	,	m_data( nullptr )
+	,	m_size( 0 )
+	,	m_pos( 0 )
+{
+}
+
+inline char
+RecordSubstream::getByte()
+{
+	if( m_pos < m_size )
+		return m_data[ m_pos++ ];
+
+	m_pos = m_size + 1;
+
+	return 0x00;
+}
+
+inline bool
+RecordSubstream::tryRead( char * data, size_t size )
+{
+	if( m_pos > m_size || m_size - m_pos < size )
+	{
+		m_pos = m_size + 1;
+
+		return false;
+	}
+
+	std::memcpy( data, m_data + m_pos, size );
+
+	m_pos += size;
+
+	return true;
+}
+
+inline const char *
+RecordSubstream::readInPlace( size_t size )
+{
+	if( m_pos > m_size || m_size - m_pos < size )
+		return nullptr;
+
+	const char * data = m_data + m_pos;
+
+	m_pos += size;
+
+	return data;
+}
+
+inline bool
+RecordSubstream::eof() const
+{
+	return ( m_pos > m_size );
+}
+
+inline void
+RecordSubstream::seek( int32_t pos, SeekType type )
+{
+	int64_t newPos = pos;
+
+	if( type == Stream::FromCurrent )
+		newPos += static_cast< int64_t > ( m_pos > m_size ? m_size : m_pos );
+	else if( type == Stream::FromEnd )
+		newPos += static_cast< int64_t > ( m_size );
+
+	if( newPos < 0 || newPos > static_cast< int64_t > ( m_size ) )
+		m_pos = m_size + 1;
+	else
+		m_pos = static_cast< size_t > ( newPos );
+}
+
+inline int32_t
+RecordSubstream::pos()
+{
+	if( eof() )
+		return -1;
+	else
+		return static_cast< int32_t > ( m_pos );
+}
+
+inline void
+RecordSubstream::setData( const char * data, size_t size )
+{
+	m_data = data;
+	m_size = size;
+	m_pos = 0;
+}
+
+
+//
+// Record
+//
+
+inline
+Record::Record( Stream::ByteOrder byteOrder )
+	:	m_code( 0 )
+	,	m_length( 0 )
+	,	m_stream( byteOrder )
+{
+}
+
+inline
+Record::Record( Stream & stream )
+	:	m_code( 0 )
+	,	m_length( 0 )
+	,	m_stream( stream.byteOrder() )
+{
+	if( !read( stream, m_buffer ) )
+		throw Exception( L"Unexpected end of file." );
+}
+
+inline
+Record::Record( Stream & stream, std::vector< char > & buffer )
+	:	m_code( 0 )
+	,	m_length( 0 )
+	,	m_stream( stream.byteOrder() )
+{
+	if( !read( stream, buffer ) )
+		throw Exception( L"Unexpected end of file." );
+}
+
+inline
+Record::~Record()
+{
+}
+
+//! \return Code of the next record, XL_UNKNOWN if the stream is over.
+inline uint16_t
+nextRecordCode( Stream & stream )
+{
+	char code[ 2 ];
+
+	if( !stream.tryRead( code, 2 ) )
+		return XL_UNKNOWN;
+
+	return stream.fromBytes< uint16_t >( code, 2 );
+}
+
+inline bool
+Record::read( Stream & stream, std::vector< char > & buffer )
+{
+	return readRecord( stream, buffer, nullptr );
+}
+
+inline bool
+Record::read( Stream & stream, std::vector< char > & buffer, const RecordFilter & filter )
+{
+	return readRecord( stream, buffer, &filter );
+}
+
+inline bool
+Record::skipData( Stream & stream )
+{
+	if( !stream.skip( m_length ) )
+		return false;
+
+	uint16_t nextCode = nextRecordCode( stream );
+
+	while( nextCode == XL_CONTINUE )
+	{
+		char length[ 2 ];
+
+		if( !stream.tryRead( length, 2 ) )
+			return false;
+
+		const uint16_t nextLength = stream.fromBytes< uint16_t >( length, 2 );
+
+		if( !stream.skip( nextLength ) )
+			return false;
+
+		m_length += nextLength;
+
+		nextCode = nextRecordCode( stream );
+	}
+
+	if( !stream.eof() )
+		stream.seek( -2, Stream::FromCurrent );
+
+	return true;
+}
+
+inline bool
+Record::readRecord( Stream & stream, std::vector< char > & buffer,
+	const RecordFilter * filter )
+{
+	m_borders.clear();
+	m_stream.setData( nullptr, 0 );
+
+	char header[ 4 ];
+
+	if( !stream.tryRead( header, 4 ) )
+		return false;
+
+	m_code = stream.fromBytes< uint16_t >( header, 2 );
+	m_length = stream.fromBytes< uint16_t >( header + 2, 2 );
+
+	if( filter && !filter->contains( m_code ) )
+		return skipData( stream );
+
+	const char * data = nullptr;
+
+	if( m_length )
+	{
+		data = stream.readInPlace( m_length );
+
+		if( !data )
+		{
+			buffer.resize( m_length );
+
+			if( !stream.tryRead( &buffer[ 0 ], m_length ) )
+				return false;
+
+			data = &buffer[ 0 ];
+		}
+	}
+
+	uint16_t nextCode = nextRecordCode( stream );
+
+	if( nextCode == XL_CONTINUE && data != buffer.data() )
+		buffer.assign( data, data + m_length );
+
+	while( nextCode == XL_CONTINUE )
+	{
+		m_borders.push_back( m_length );
+
+		char length[ 2 ];
+
+		if( !stream.tryRead( length, 2 ) )
+			return false;
+
+		const uint16_t nextLength = stream.fromBytes< uint16_t >( length, 2 );
+
+		if( nextLength )
+		{
+			const size_t offset = buffer.size();
+
+			buffer.resize( offset + nextLength );
+
+			if( !stream.tryRead( &buffer[ offset ], nextLength ) )
+				return false;
+		}
+
+		data = buffer.data();
+
+		m_length += nextLength;
+
+		nextCode = nextRecordCode( stream );
+	}
+
+	if( !stream.eof() )
+		stream.seek( -2, Stream::FromCurrent );
+
+	m_stream.setData( data, m_length );
+
+	return true;
+}
+
+inline uint16_t
+Record::code() const
+{
+	return m_code;
+}
+
+inline uint32_t
+Record::length() const
+{
+	return m_length;
+}
+
+inline Stream &
+Record::dataStream()
+{
+	return m_stream;
+}
+
+inline const std::vector< int32_t > &
+Record::borders() const
+{
+	return m_borders;
+}
+
+} /* namespace Excel */
+
+#endif // EXCEL__RECORD_HPP__INCLUDED
+
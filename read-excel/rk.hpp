@@ -0,0 +1,177 @@
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef EXCEL__RK_HPP__INCLUDED
+#define EXCEL__RK_HPP__INCLUDED
+
+// C++ include.
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+// Excel include.
+#include "simd.hpp"
+
+
+namespace Excel {
+
+//
+// doubleFromRK
+//
+
+inline double
+doubleFromRK( uint32_t rk )
+{
+	double num = 0;
+
+	if( rk & 0x02 )
+	{
+		// int32_t
+		num = (double) (rk >> 2);
+	}
+	else
+	{
+		// hi words of IEEE num
+		const uint64_t bits = static_cast< uint64_t > ( rk & 0xFFFFFFFC ) << 32;
+		std::memcpy( &num, &bits, sizeof( num ) );
+	}
+
+	if( rk & 0x01 )
+		// divide by 100
+		num /= 100;
+
+	return num;
+} // doubleFromRK
+
+
+//
+// rkFromBytes
+//
+
+//! \return RK number from 4 bytes, low byte goes first if \a lowByteFirst.
+inline uint32_t
+rkFromBytes( const char * data, bool lowByteFirst )
+{
+	const unsigned char * bytes = reinterpret_cast< const unsigned char * > ( data );
+
+	if( lowByteFirst )
+		return ( static_cast< uint32_t > ( bytes[ 0 ] ) |
+			( static_cast< uint32_t > ( bytes[ 1 ] ) << 8 ) |
+			( static_cast< uint32_t > ( bytes[ 2 ] ) << 16 ) |
+			( static_cast< uint32_t > ( bytes[ 3 ] ) << 24 ) );
+	else
+		return ( static_cast< uint32_t > ( bytes[ 3 ] ) |
+			( static_cast< uint32_t > ( bytes[ 2 ] ) << 8 ) |
+			( static_cast< uint32_t > ( bytes[ 1 ] ) << 16 ) |
+			( static_cast< uint32_t > ( bytes[ 0 ] ) << 24 ) );
+} // rkFromBytes
+
+
+//
+// doublesFromRKsScalar
+//
+
+//! Decode RK numbers of MULRK record one by one, see doublesFromRKs().
+inline void
+doublesFromRKsScalar( const char * data, size_t count, bool lowByteFirst, double * values )
+{
+	for( size_t i = 0; i < count; ++i )
+		values[ i ] = doubleFromRK( rkFromBytes( data + i * 6 + 2, lowByteFirst ) );
+} // doublesFromRKsScalar
+
+
+//
+// doublesFromRKs
+//
+
+/*!
+	Decode \a count RK numbers of MULRK record into \a values. \a data
+	is the array of pairs of 2-bytes XF index and 4-bytes RK number,
+	low byte goes first if \a lowByteFirst.
+
+	RK numbers are decoded with AVX2 by 4 or with SSE2 by 2 if they are
+	available, results are bit-exact with doubleFromRK().
+*/
+inline void
+doublesFromRKs( const char * data, size_t count, bool lowByteFirst, double * values )
+{
+	size_t i = 0;
+
+#ifdef EXCEL__SSE2
+	// x86 is little-endian, so RK numbers in little-endian are read as is.
+	if( lowByteFirst )
+	{
+		auto rkAt = [ data ] ( size_t idx )
+		{
+			int32_t rk = 0;
+			std::memcpy( &rk, data + idx * 6 + 2, sizeof( rk ) );
+
+			return rk;
+		};
+
+	#ifdef EXCEL__AVX2
+		const __m256i one4 = _mm256_set1_epi64x( 1 );
+		const __m256i two4 = _mm256_set1_epi64x( 2 );
+		const __m256i mantissaMask4 = _mm256_set1_epi64x( 0xFFFFFFFC );
+		const __m256d hundred4 = _mm256_set1_pd( 100.0 );
+
+		for( ; i + 4 <= count; i += 4 )
+		{
+			const __m128i rks = _mm_set_epi32( rkAt( i + 3 ), rkAt( i + 2 ),
+				rkAt( i + 1 ), rkAt( i ) );
+			const __m256i wide = _mm256_cvtepu32_epi64( rks );
+
+			const __m256d ints = _mm256_cvtepi32_pd( _mm_srli_epi32( rks, 2 ) );
+			const __m256d floats = _mm256_castsi256_pd( _mm256_slli_epi64(
+				_mm256_and_si256( wide, mantissaMask4 ), 32 ) );
+			const __m256d isInt = _mm256_castsi256_pd( _mm256_cmpeq_epi64(
+				_mm256_and_si256( wide, two4 ), two4 ) );
+			const __m256d isScaled = _mm256_castsi256_pd( _mm256_cmpeq_epi64(
+				_mm256_and_si256( wide, one4 ), one4 ) );
+
+			const __m256d num = _mm256_blendv_pd( floats, ints, isInt );
+
+			_mm256_storeu_pd( values + i, _mm256_blendv_pd( num,
+				_mm256_div_pd( num, hundred4 ), isScaled ) );
+		}
+	#endif
+
+		const __m128i one = _mm_set1_epi32( 1 );
+		const __m128i two = _mm_set1_epi32( 2 );
+		const __m128i mantissaMask = _mm_set_epi32( 0, -4, 0, -4 );
+		const __m128d hundred = _mm_set1_pd( 100.0 );
+
+		for( ; i + 2 <= count; i += 2 )
+		{
+			const __m128i rks = _mm_set_epi32( 0, 0, rkAt( i + 1 ), rkAt( i ) );
+			// Each RK number in both halves of its 64-bit lane.
+			const __m128i lanes = _mm_shuffle_epi32( rks, _MM_SHUFFLE( 1, 1, 0, 0 ) );
+
+			const __m128d ints = _mm_cvtepi32_pd( _mm_srli_epi32( rks, 2 ) );
+			const __m128d floats = _mm_castsi128_pd( _mm_slli_epi64(
+				_mm_and_si128( _mm_unpacklo_epi32( rks, _mm_setzero_si128() ), mantissaMask ),
+				32 ) );
+			const __m128d isInt = _mm_castsi128_pd( _mm_cmpeq_epi32(
+				_mm_and_si128( lanes, two ), two ) );
+			const __m128d isScaled = _mm_castsi128_pd( _mm_cmpeq_epi32(
+				_mm_and_si128( lanes, one ), one ) );
+
+			const __m128d num = _mm_or_pd( _mm_and_pd( isInt, ints ),
+				_mm_andnot_pd( isInt, floats ) );
+
+			_mm_storeu_pd( values + i, _mm_or_pd(
+				_mm_and_pd( isScaled, _mm_div_pd( num, hundred ) ),
+				_mm_andnot_pd( isScaled, num ) ) );
+		}
+	}
+#endif
+
+	doublesFromRKsScalar( data + i * 6, count - i, lowByteFirst, values + i );
+} // doublesFromRKs
+
+} /* namespace Excel */
+
+#endif // EXCEL__RK_HPP__INCLUDED
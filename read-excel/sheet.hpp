@@ -1,243 +1,620 @@
-
-/*
-	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
-	SPDX-License-Identifier: MIT
-*/
-
-#ifndef EXCEL__SHEET_HPP__INCLUDED
-#define EXCEL__SHEET_HPP__INCLUDED
-
-// Excel include.
-#include "cell.hpp"
-#include "record.hpp"
-#include "bof.hpp"
-#include "formula.hpp"
-#include "string.hpp"
-#include "exceptions.hpp"
-#include "storage.hpp"
-
-// C++ include.
-#include <vector>
-#include <string>
-
-
-namespace Excel {
-
-//
-// BoundSheet
-//
-
-//! BoundSheet record.
-class BoundSheet {
-public:
-	//! Sheet's type.
-	enum SheetType {
-		//! Worksheet.
-		WorkSheet = 0x0000,
-		//! Excel 4.0 macro sheet.
-		MacroSheet = 0x0100,
-		//! Chart.
-		Chart = 0x0200,
-		//! Visual Basic module.
-		VisualBasicModule = 0x0600
-	}; // enum SheetType
-
-	BoundSheet( int32_t pos,
-		SheetType type, const std::wstring & name );
-
-	//! \return BOF position.
-	int32_t BOFPosition() const;
-
-	//! \return Sheet's type.
-	SheetType sheetType() const;
-
-	//! \return Sheet's name.
-	const std::wstring & sheetName() const;
-
-	//! Convert 2-bytes type field to the SheetType.
-	static SheetType convertSheetType( int16_t type );
-
-private:
-	//! BOF position.
-	int32_t m_BOFPosition;
-	//! Sheet's type.
-	SheetType m_sheetType;
-	//! Sheet's name.
-	std::wstring m_sheetName;
-}; // class BoundSheet
-
-
-//
-// Sheet
-//
-
-//! Excel's sheet.
-class Sheet {
-public:
-	explicit Sheet( const std::wstring & name );
-
-	//! \return Cell.
-	const Cell & cell( size_t row, size_t column ) const;
-
-	//! \return Row's count.
-	size_t rowsCount() const;
-
-	//! \return Column's count.
-	size_t columnsCount() const;
-
-	//! Set cell.
-	template< typename Value >
-	void setCell( size_t row, size_t column, Value value );
-
-	//! \return Name of the sheet.
-	const std::wstring & sheetName() const;
-
-private:
-	//! Init cell's table with given cell.
-	void initCell( size_t row, size_t column );
-
-private:
-	//! Cells.
-	std::vector< std::vector< Cell > > m_cells;
-	//! Dummy cell.
-	Cell m_dummyCell;
-	//! Column's count;
-	size_t m_columnsCount;
-	//! Name of the sheet.
-	std::wstring m_name;
-}; // class Sheet
-
-//
-// BoundSheet
-//
-
-//! Sheet's type.
-enum SheetType {
-	//! Worksheet.
-	WorkSheet = 0x0000,
-	//! Excel 4.0 macro sheet.
-	MacroSheet = 0x0100,
-	//! Chart.
-	Chart = 0x0200,
-	//! Visual Basic module.
-	VisualBasicModule = 0x0600
-}; // enum SheetType
-
-inline
-BoundSheet::BoundSheet( int32_t pos,
-	SheetType type, const std::wstring & name )
-	:	m_BOFPosition( pos )
-	,	m_sheetType( type )
-	,	m_sheetName( name )
-{
-}
-
-inline int32_t
-BoundSheet::BOFPosition() const
-{
-	return m_BOFPosition;
-}
-
-inline BoundSheet::SheetType
-BoundSheet::sheetType() const
-{
-	return m_sheetType;
-}
-
-inline const std::wstring &
-BoundSheet::sheetName() const
-{
-	return m_sheetName;
-}
-
-inline BoundSheet::SheetType
-BoundSheet::convertSheetType( int16_t type )
-{
-	return ( (SheetType) ( type & 0xFF00 ) );
-}
-
-
-//
-// Sheet
-//
-
-inline
-Sheet::Sheet( const std::wstring & name )
-	:	m_columnsCount( 0 )
-	,	m_name( name )
-{
-}
-
-template< typename Value >
-inline void
-Sheet::setCell( size_t row, size_t column, Value value )
-{
-	initCell( row, column );
-	m_cells[ row ][ column ].setData( value );
-}
-
-inline const std::wstring &
-Sheet::sheetName() const
-{
-	return m_name;
-}
-
-inline void
-Sheet::initCell( size_t row, size_t column )
-{
-	if( m_cells.size() < row + 1 )
-		m_cells.resize( row + 1 );
-
-	if( m_cells[ row ].size() < column + 1 )
-	{
-		bool all = false;
-
-		if( column + 1 > m_columnsCount )
-		{
-			m_columnsCount = column + 1;
-			all = true;
-		}
-
-		if( all )
-		{
-			for( std::vector< std::vector< Cell > >::iterator it = m_cells.begin(),
-				last = m_cells.end(); it != last; ++it )
-			{
-				it->resize( m_columnsCount );
-			}
-		}
-		else
-			m_cells.back().resize( m_columnsCount );
-	}
-}
-
-inline const Cell &
-Sheet::cell( size_t row, size_t column ) const
-{
-	if( m_cells.size() > 0 )
-	{
-		if( m_cells.size() - 1 < row || m_cells[ 0 ].size() - 1 < column )
-			return m_dummyCell;
-		else
-			return m_cells[ row ][ column ];
-	}
-
-	return m_dummyCell;
-}
-
-inline size_t
-Sheet::rowsCount() const
-{
-	return m_cells.size();
-}
-
-inline size_t
-Sheet::columnsCount() const
-{
-	return m_columnsCount;
-}
-
-} /* namespace Excel */
-
-#endif // EXCEL__SHEET_HPP__INCLUDED
-
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef EXCEL__SHEET_HPP__INCLUDED
+#define EXCEL__SHEET_HPP__INCLUDED
+
+// Excel include.
+#include "cell.hpp"
+#include "record.hpp"
+#include "bof.hpp"
+#include "formula.hpp"
+#include "string.hpp"
+#include "exceptions.hpp"
+#include "storage.hpp"
+
+// C++ include.
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <deque>
+#include <unordered_map>
+#include <utility>
+
+
+namespace Excel {
+
+//
+// BoundSheet
+//
+
+//! BoundSheet record.
+class BoundSheet {
+public:
+	//! Sheet's type.
+	enum SheetType {
+		//! Worksheet.
+		WorkSheet = 0x0000,
+		//! Excel 4.0 macro sheet.
+		MacroSheet = 0x0100,
+		//! Chart.
+		Chart = 0x0200,
+		//! Visual Basic module.
+		VisualBasicModule = 0x0600
+	}; // enum SheetType
+
+	BoundSheet( int32_t pos,
+		SheetType type, const std::wstring & name );
+
+	//! \return BOF position.
+	int32_t BOFPosition() const;
+
+	//! \return Sheet's type.
+	SheetType sheetType() const;
+
+	//! \return Sheet's name.
+	const std::wstring & sheetName() const;
+
+	//! Convert 2-bytes type field to the SheetType.
+	static SheetType convertSheetType( int16_t type );
+
+private:
+	//! BOF position.
+	int32_t m_BOFPosition;
+	//! Sheet's type.
+	SheetType m_sheetType;
+	//! Sheet's name.
+	std::wstring m_sheetName;
+}; // class BoundSheet
+
+
+//
+// Sheet
+//
+
+//! Excel's sheet.
+class Sheet {
+public:
+	//! Storage of cells.
+	enum class StorageMode {
+		//! Table of cells, each cell in the used range takes sizeof( Cell ).
+		Dense,
+		/*!
+			Rows of runs of adjacent cells, each cell takes sizeof( CellValue ),
+			empty cells between runs take nothing. Strings and formulas are
+			kept by the sheet apart from cells, shared strings aren't copied.
+		*/
+		Compact
+	}; // enum class StorageMode
+
+	explicit Sheet( const std::wstring & name,
+		StorageMode mode = StorageMode::Dense );
+	Sheet( const Sheet & other );
+	Sheet( Sheet && other ) = default;
+
+	Sheet & operator = ( const Sheet & other );
+	Sheet & operator = ( Sheet && other ) = default;
+
+	/*!
+		\return Cell.
+
+		In the compact mode the cell is converted from its value into the
+		ring of c_compactCellsCount cells of the calling thread, so the
+		reference is valid until the next c_compactCellsCount calls of
+		cell() in this thread and it doesn't follow changes of the cell.
+		This method may be called concurrently, but not with setCell().
+	*/
+	const Cell & cell( size_t row, size_t column ) const;
+
+	/*!
+		\return Value of the cell, it's valid until the cell is changed.
+
+		It's the accessor without any cost in the compact mode.
+	*/
+	CellValue value( size_t row, size_t column ) const;
+
+	//! \return Row's count.
+	size_t rowsCount() const;
+
+	//! \return Column's count.
+	size_t columnsCount() const;
+
+	/*!
+		\return Count of cells allocated for each row in the dense mode,
+		it's at most columnsCount() + c_maxColumnsSlack if the sheet
+		wasn't reserved.
+	*/
+	size_t allocatedColumnsCount() const;
+
+	//! \return Storage mode.
+	StorageMode storageMode() const;
+
+	//! Set cell.
+	template< typename Value >
+	void setCell( size_t row, size_t column, Value value );
+
+	/*!
+		Set cell with the string from the shared string table. Only the
+		pointer to the string is stored, so the string should outlive
+		the sheet.
+	*/
+	void setSharedString( size_t row, size_t column, const std::wstring & sharedString );
+
+	/*!
+		Allocate cells for \a rowsCount rows and \a columnsCount columns
+		at once, so setting cells in this range doesn't reallocate.
+		Counts of rows and columns of the sheet are not changed.
+	*/
+	void reserve( size_t rowsCount, size_t columnsCount );
+
+	//! \return Name of the sheet.
+	const std::wstring & sheetName() const;
+
+private:
+	//! Init cell's table with given cell.
+	void initCell( size_t row, size_t column );
+
+	//! \return Compact cell, add it if there is no such cell.
+	CellValue & compactCell( size_t row, size_t column );
+
+	//! \return Compact cell or nullptr if there is no such cell.
+	const CellValue * findCompactCell( size_t row, size_t column ) const;
+
+	//! Set compact cell.
+	void setCompactCell( size_t row, size_t column, const CellValue & value );
+
+	//! Store data of the cell in the sheet. \return Value of the cell.
+	CellValue storeValue( double value );
+	CellValue storeValue( std::wstring && value );
+	CellValue storeValue( Formula && value );
+
+private:
+	//! Run of adjacent cells in the row.
+	struct CellRun {
+		//! Column of the first cell.
+		size_t firstColumn;
+		//! Cells.
+		std::vector< CellValue > cells;
+	}; // struct CellRun
+
+	//! Runs of the row ordered by columns.
+	typedef std::vector< CellRun > CellRuns;
+
+	//! Storage mode.
+	StorageMode m_mode;
+	//! Cells, row by row with m_stride cells in each row.
+	std::vector< Cell > m_cells;
+	//! Count of allocated cells in each row.
+	size_t m_stride;
+	//! Rows of the compact mode.
+	std::vector< CellRuns > m_rows;
+	//! Strings of the compact mode.
+	std::deque< std::wstring > m_strings;
+	//! Formulas of the compact mode.
+	std::deque< Formula > m_formulas;
+	//! Dummy cell.
+	Cell m_dummyCell;
+	//! Row's count.
+	size_t m_rowsCount;
+	//! Column's count;
+	size_t m_columnsCount;
+	//! Name of the sheet.
+	std::wstring m_name;
+}; // class Sheet
+
+
+//! Maximum count of cells allocated at once by Sheet::reserve().
+static const size_t c_maxReservedCells = 4 * 1024 * 1024;
+
+//! Maximum count of columns allocated ahead by Sheet::setCell() in the dense mode.
+static const size_t c_maxColumnsSlack = 16;
+
+//! Maximum count of empty cells stored to join runs of cells in the compact mode.
+static const size_t c_maxEmptyCellsInRun = 2;
+
+//! Count of cells returned by Sheet::cell() in the compact mode kept by each thread.
+static const size_t c_compactCellsCount = 16;
+
+//
+// BoundSheet
+//
+
+//! Sheet's type.
+enum SheetType {
+	//! Worksheet.
+	WorkSheet = 0x0000,
+	//! Excel 4.0 macro sheet.
+	MacroSheet = 0x0100,
+	//! Chart.
+	Chart = 0x0200,
+	//! Visual Basic module.
+	VisualBasicModule = 0x0600
+}; // enum SheetType
+
+inline
+BoundSheet::BoundSheet( int32_t pos,
+	SheetType type, const std::wstring & name )
+	:	m_BOFPosition( pos )
+	,	m_sheetType( type )
+	,	m_sheetName( name )
+{
+}
+
+inline int32_t
+BoundSheet::BOFPosition() const
+{
+	return m_BOFPosition;
+}
+
+inline BoundSheet::SheetType
+BoundSheet::sheetType() const
+{
+	return m_sheetType;
+}
+
+inline const std::wstring &
+BoundSheet::sheetName() const
+{
+	return m_sheetName;
+}
+
+inline BoundSheet::SheetType
+BoundSheet::convertSheetType( int16_t type )
+{
+	return ( (SheetType) ( type & 0xFF00 ) );
+}
+
+
+//
+// Sheet
+//
+
+inline
+Sheet::Sheet( const std::wstring & name, StorageMode mode )
+	:	m_mode( mode )
+	,	m_stride( 0 )
+	,	m_rowsCount( 0 )
+	,	m_columnsCount( 0 )
+	,	m_name( name )
+{
+}
+
+inline
+Sheet::Sheet( const Sheet & other )
+	:	m_mode( other.m_mode )
+	,	m_cells( other.m_cells )
+	,	m_stride( other.m_stride )
+	,	m_rows( other.m_rows )
+	,	m_strings( other.m_strings )
+	,	m_formulas( other.m_formulas )
+	,	m_rowsCount( other.m_rowsCount )
+	,	m_columnsCount( other.m_columnsCount )
+	,	m_name( other.m_name )
+{
+	if( m_strings.empty() && m_formulas.empty() )
+		return;
+
+	// Compact cells point to strings and formulas of the other sheet,
+	// shared strings are left as is.
+	std::unordered_map< const std::wstring *, const std::wstring * > strings;
+	std::unordered_map< const Formula *, const Formula * > formulas;
+
+	for( size_t i = 0; i < m_strings.size(); ++i )
+		strings.emplace( &other.m_strings[ i ], &m_strings[ i ] );
+
+	for( size_t i = 0; i < m_formulas.size(); ++i )
+		formulas.emplace( &other.m_formulas[ i ], &m_formulas[ i ] );
+
+	for( CellRuns & runs : m_rows )
+	{
+		for( CellRun & run : runs )
+		{
+			for( CellValue & value : run.cells )
+			{
+				if( value.dataType() == Cell::DataType::String )
+				{
+					auto it = strings.find( &value.getString() );
+
+					if( it != strings.end() )
+						value = CellValue( it->second );
+				}
+				else if( value.dataType() == Cell::DataType::Formula )
+					value = CellValue( formulas.at( &value.getFormula() ) );
+			}
+		}
+	}
+}
+
+inline Sheet &
+Sheet::operator = ( const Sheet & other )
+{
+	if( this != &other )
+	{
+		Sheet copy( other );
+		*this = std::move( copy );
+	}
+
+	return *this;
+}
+
+template< typename Value >
+inline void
+Sheet::setCell( size_t row, size_t column, Value value )
+{
+	if( m_mode == StorageMode::Compact )
+		setCompactCell( row, column, storeValue( std::move( value ) ) );
+	else
+	{
+		initCell( row, column );
+		m_cells[ row * m_stride + column ].setData( value );
+	}
+}
+
+inline void
+Sheet::setSharedString( size_t row, size_t column, const std::wstring & sharedString )
+{
+	if( m_mode == StorageMode::Compact )
+		setCompactCell( row, column, CellValue( &sharedString ) );
+	else
+	{
+		initCell( row, column );
+		m_cells[ row * m_stride + column ].setSharedString( sharedString );
+	}
+}
+
+inline const std::wstring &
+Sheet::sheetName() const
+{
+	return m_name;
+}
+
+inline Sheet::StorageMode
+Sheet::storageMode() const
+{
+	return m_mode;
+}
+
+inline void
+Sheet::reserve( size_t rowsCount, size_t columnsCount )
+{
+	if( rowsCount == 0 || columnsCount == 0 ||
+		rowsCount > c_maxReservedCells / columnsCount )
+			return;
+
+	if( m_mode == StorageMode::Compact )
+	{
+		m_rows.reserve( rowsCount );
+
+		return;
+	}
+
+	if( columnsCount > m_stride )
+	{
+		std::vector< Cell > cells;
+		cells.reserve( rowsCount * columnsCount );
+		cells.resize( m_rowsCount * columnsCount );
+
+		for( size_t row = 0; row < m_rowsCount; ++row )
+			std::move( m_cells.begin() + row * m_stride,
+				m_cells.begin() + row * m_stride + m_columnsCount,
+				cells.begin() + row * columnsCount );
+
+		m_cells.swap( cells );
+		m_stride = columnsCount;
+	}
+	else
+		m_cells.reserve( rowsCount * m_stride );
+}
+
+inline void
+Sheet::initCell( size_t row, size_t column )
+{
+	if( column >= m_stride )
+	{
+		// Some slack to not reallocate on each column of the row filled
+		// from left to right, bounded to not keep empty columns.
+		const size_t stride = column + 1 + std::min( column + 1, c_maxColumnsSlack );
+		const size_t rows = std::max( row + 1, m_rowsCount );
+
+		std::vector< Cell > cells;
+		cells.reserve( std::max( m_cells.capacity() / ( m_stride ? m_stride : 1 ), rows ) *
+			stride );
+		cells.resize( rows * stride );
+
+		for( size_t r = 0; r < m_rowsCount; ++r )
+			std::move( m_cells.begin() + r * m_stride,
+				m_cells.begin() + r * m_stride + m_columnsCount,
+				cells.begin() + r * stride );
+
+		m_cells.swap( cells );
+		m_stride = stride;
+	}
+	else if( m_cells.size() < ( row + 1 ) * m_stride )
+		m_cells.resize( ( row + 1 ) * m_stride );
+
+	m_rowsCount = std::max( m_rowsCount, row + 1 );
+	m_columnsCount = std::max( m_columnsCount, column + 1 );
+}
+
+inline CellValue
+Sheet::storeValue( double value )
+{
+	return CellValue( value );
+}
+
+inline CellValue
+Sheet::storeValue( std::wstring && value )
+{
+	m_strings.push_back( std::move( value ) );
+
+	return CellValue( &m_strings.back() );
+}
+
+inline CellValue
+Sheet::storeValue( Formula && value )
+{
+	m_formulas.push_back( std::move( value ) );
+
+	return CellValue( &m_formulas.back() );
+}
+
+inline void
+Sheet::setCompactCell( size_t row, size_t column, const CellValue & value )
+{
+	compactCell( row, column ) = value;
+
+	m_rowsCount = std::max( m_rowsCount, row + 1 );
+	m_columnsCount = std::max( m_columnsCount, column + 1 );
+}
+
+inline CellValue &
+Sheet::compactCell( size_t row, size_t column )
+{
+	if( m_rows.size() <= row )
+		m_rows.resize( row + 1 );
+
+	CellRuns & runs = m_rows[ row ];
+
+	// Cells usually come from left to right, so most likely the cell
+	// is at the end of the last run.
+	auto next = ( runs.empty() || column >= runs.back().firstColumn ? runs.end() :
+		std::upper_bound( runs.begin(), runs.end(), column,
+			[] ( size_t c, const CellRun & run ) { return c < run.firstColumn; } ) );
+
+	if( next != runs.begin() )
+	{
+		CellRun & prev = *( next - 1 );
+		const size_t end = prev.firstColumn + prev.cells.size();
+
+		if( column < end )
+			return prev.cells[ column - prev.firstColumn ];
+
+		if( column - end <= c_maxEmptyCellsInRun )
+		{
+			if( next != runs.end() && next->firstColumn - column - 1 <= c_maxEmptyCellsInRun )
+			{
+				prev.cells.resize( next->firstColumn - prev.firstColumn );
+				prev.cells.insert( prev.cells.end(), next->cells.cbegin(), next->cells.cend() );
+				runs.erase( next );
+			}
+			else
+				prev.cells.resize( column - prev.firstColumn + 1 );
+
+			return prev.cells[ column - prev.firstColumn ];
+		}
+	}
+
+	if( next != runs.end() && next->firstColumn - column - 1 <= c_maxEmptyCellsInRun )
+	{
+		next->cells.insert( next->cells.begin(), next->firstColumn - column, CellValue() );
+		next->firstColumn = column;
+
+		return next->cells.front();
+	}
+
+	return runs.insert( next, CellRun{ column, std::vector< CellValue > ( 1 ) } )->cells.front();
+}
+
+inline const CellValue *
+Sheet::findCompactCell( size_t row, size_t column ) const
+{
+	if( row >= m_rows.size() )
+		return nullptr;
+
+	const CellRuns & runs = m_rows[ row ];
+
+	auto next = std::upper_bound( runs.cbegin(), runs.cend(), column,
+		[] ( size_t c, const CellRun & run ) { return c < run.firstColumn; } );
+
+	if( next == runs.cbegin() )
+		return nullptr;
+
+	--next;
+
+	if( column < next->firstColumn + next->cells.size() )
+		return &next->cells[ column - next->firstColumn ];
+
+	return nullptr;
+}
+
+inline const Cell &
+Sheet::cell( size_t row, size_t column ) const
+{
+	if( row >= m_rowsCount || column >= m_columnsCount )
+		return m_dummyCell;
+
+	if( m_mode == StorageMode::Dense )
+		return m_cells[ row * m_stride + column ];
+
+	const CellValue * value = findCompactCell( row, column );
+
+	if( !value || value->isNull() )
+		return m_dummyCell;
+
+	// The ring of the thread needs neither locks nor memory per read cell.
+	static thread_local Cell cells[ c_compactCellsCount ];
+	static thread_local size_t next = 0;
+
+	Cell & cell = cells[ next ];
+	next = ( next + 1 ) % c_compactCellsCount;
+	cell = value->toCell();
+
+	return cell;
+}
+
+inline CellValue
+Sheet::value( size_t row, size_t column ) const
+{
+	if( row >= m_rowsCount || column >= m_columnsCount )
+		return CellValue();
+
+	if( m_mode == StorageMode::Compact )
+	{
+		const CellValue * value = findCompactCell( row, column );
+
+		return ( value ? *value : CellValue() );
+	}
+
+	const Cell & cell = m_cells[ row * m_stride + column ];
+
+	switch( cell.dataType() )
+	{
+		case Cell::DataType::String :
+			return CellValue( &cell.getString() );
+
+		case Cell::DataType::Double :
+			return CellValue( cell.getDouble() );
+
+		case Cell::DataType::Formula :
+			return CellValue( &cell.getFormula() );
+
+		default :
+			return CellValue();
+	}
+}
+
+inline size_t
+Sheet::rowsCount() const
+{
+	return m_rowsCount;
+}
+
+inline size_t
+Sheet::columnsCount() const
+{
+	return m_columnsCount;
+}
+
+inline size_t
+Sheet::allocatedColumnsCount() const
+{
+	return m_stride;
+}
+
+} /* namespace Excel */
+
+#endif // EXCEL__SHEET_HPP__INCLUDED
+
@@ -0,0 +1,27 @@
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef EXCEL__SIMD_HPP__INCLUDED
+#define EXCEL__SIMD_HPP__INCLUDED
+
+/*
+	SIMD instructions are used if the compiler targets them: SSE2 on
+	x86-64 always, AVX2 if it's enabled (e.g. -mavx2 or /arch:AVX2).
+	Define EXCEL_NO_SIMD to use only scalar code.
+*/
+
+#if !defined( EXCEL_NO_SIMD ) && ( defined( __SSE2__ ) || defined( _M_X64 ) || \
+	( defined( _M_IX86_FP ) && _M_IX86_FP >= 2 ) )
+	#define EXCEL__SSE2
+	#include <emmintrin.h>
+#endif
+
+#if defined( EXCEL__SSE2 ) && defined( __AVX2__ )
+	#define EXCEL__AVX2
+	#include <immintrin.h>
+#endif
+
+#endif // EXCEL__SIMD_HPP__INCLUDED
@@ -0,0 +1,267 @@
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef EXCEL__SST_HPP__INCLUDED
+#define EXCEL__SST_HPP__INCLUDED
+
+// C++ include.
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <algorithm>
+
+
+namespace Excel {
+
+//
+// StringView
+//
+
+//! Non-owning view of the wide string.
+class StringView {
+public:
+	StringView();
+	StringView( const wchar_t * data, size_t size );
+
+	//! \return Characters, not null-terminated.
+	const wchar_t * data() const;
+
+	//! \return Count of characters.
+	size_t size() const;
+
+	//! \return Is the string empty.
+	bool empty() const;
+
+	//! \return Character.
+	wchar_t operator [] ( size_t idx ) const;
+
+	const wchar_t * begin() const;
+	const wchar_t * end() const;
+
+	//! \return Copy of the string.
+	std::wstring str() const;
+
+private:
+	//! Characters.
+	const wchar_t * m_data;
+	//! Count of characters.
+	size_t m_size;
+}; // class StringView
+
+inline
+StringView::StringView()
+	:	m_data( nullptr )
+	,	m_size( 0 )
+{
+}
+
+inline
+StringView::StringView( const wchar_t * data, size_t size )
+	:	m_data( data )
+	,	m_size( size )
+{
+}
+
+inline const wchar_t *
+StringView::data() const
+{
+	return m_data;
+}
+
+inline size_t
+StringView::size() const
+{
+	return m_size;
+}
+
+inline bool
+StringView::empty() const
+{
+	return ( m_size == 0 );
+}
+
+inline wchar_t
+StringView::operator [] ( size_t idx ) const
+{
+	return m_data[ idx ];
+}
+
+inline const wchar_t *
+StringView::begin() const
+{
+	return m_data;
+}
+
+inline const wchar_t *
+StringView::end() const
+{
+	return m_data + m_size;
+}
+
+inline std::wstring
+StringView::str() const
+{
+	return std::wstring( m_data, m_size );
+}
+
+inline bool
+operator == ( const StringView & a, const StringView & b )
+{
+	return ( a.size() == b.size() && std::equal( a.begin(), a.end(), b.begin() ) );
+}
+
+inline bool
+operator != ( const StringView & a, const StringView & b )
+{
+	return !( a == b );
+}
+
+inline bool
+operator == ( const StringView & a, const std::wstring & b )
+{
+	return ( a == StringView( b.data(), b.size() ) );
+}
+
+inline bool
+operator == ( const std::wstring & a, const StringView & b )
+{
+	return ( b == a );
+}
+
+inline bool
+operator != ( const StringView & a, const std::wstring & b )
+{
+	return !( a == b );
+}
+
+inline bool
+operator != ( const std::wstring & a, const StringView & b )
+{
+	return !( b == a );
+}
+
+
+//
+// SharedStringTable
+//
+
+/*!
+	Shared string table stored in one arena: characters of all strings
+	are in one buffer and each string is the offset in it, so there is
+	no allocation per string. Strings are added in the order of SST.
+*/
+class SharedStringTable {
+public:
+	SharedStringTable();
+
+	//! \return Count of strings.
+	size_t size() const;
+
+	//! \return Is the table empty.
+	bool empty() const;
+
+	//! \return View of the string, it's valid until the next change of the table.
+	StringView view( size_t idx ) const;
+
+	//! \return View of the string.
+	StringView operator [] ( size_t idx ) const;
+
+	//! Allocate \a count strings with \a charsCount characters in all.
+	void reserve( size_t count, size_t charsCount = 0 );
+
+	//! Add string to the end of the table.
+	void append( const std::wstring & value );
+
+	/*!
+		Add string to the end of the table, \a load appends characters
+		of the string to the given std::vector< wchar_t >, e.g. with
+		appendString(), so there is no copy of the string.
+	*/
+	template< typename Load >
+	void appendWith( Load load );
+
+	//! Free characters allocated by reserve() and not used.
+	void shrinkToFit();
+
+	//! Clear the table.
+	void clear();
+
+private:
+	//! Characters of all strings.
+	std::vector< wchar_t > m_chars;
+	//! Offsets of strings in m_chars, with the end of the last string.
+	std::vector< size_t > m_offsets;
+}; // class SharedStringTable
+
+inline
+SharedStringTable::SharedStringTable()
+	:	m_offsets( 1, 0 )
+{
+}
+
+inline size_t
+SharedStringTable::size() const
+{
+	return m_offsets.size() - 1;
+}
+
+inline bool
+SharedStringTable::empty() const
+{
+	return ( size() == 0 );
+}
+
+inline StringView
+SharedStringTable::view( size_t idx ) const
+{
+	return StringView( m_chars.data() + m_offsets[ idx ],
+		m_offsets[ idx + 1 ] - m_offsets[ idx ] );
+}
+
+inline StringView
+SharedStringTable::operator [] ( size_t idx ) const
+{
+	return view( idx );
+}
+
+inline void
+SharedStringTable::reserve( size_t count, size_t charsCount )
+{
+	m_offsets.reserve( count + 1 );
+	m_chars.reserve( charsCount );
+}
+
+inline void
+SharedStringTable::append( const std::wstring & value )
+{
+	m_chars.insert( m_chars.end(), value.cbegin(), value.cend() );
+	m_offsets.push_back( m_chars.size() );
+}
+
+template< typename Load >
+inline void
+SharedStringTable::appendWith( Load load )
+{
+	load( m_chars );
+	m_offsets.push_back( m_chars.size() );
+}
+
+inline void
+SharedStringTable::shrinkToFit()
+{
+	m_chars.shrink_to_fit();
+}
+
+inline void
+SharedStringTable::clear()
+{
+	m_chars.clear();
+	m_offsets.assign( 1, 0 );
+}
+
+} /* namespace Excel */
+
+#endif // EXCEL__SST_HPP__INCLUDED
@@ -1,55 +1,107 @@
-
-/*
-	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
-	SPDX-License-Identifier: MIT
-*/
-
-#pragma once
-
-// C++ include.
-#include <string>
-
-// Excel include.
-#include "formula.hpp"
-
-namespace Excel {
-
-//
-// IStorage
-//
-
-//! Excel storage interface.
-struct IStorage {
-	virtual ~IStorage() = default;
-
-protected:
-	friend class Parser;
-
-	//! Handler of SST.
-	virtual void onSharedString( size_t sstSize, size_t idx, const std::wstring & value ) = 0;
-	//! Handler of date mode.
-	virtual void onDateMode( uint16_t mode ) = 0;
-	//! Handler of sheet.
-	virtual void onSheet( size_t idx, const std::wstring & value ) = 0;
-	//! Handler of cell with text from SST.
-	virtual void onCellSharedString( size_t sheetIdx, size_t row, size_t column, size_t sstIndex ) = 0;
-	//! Handler of cell with text.
-	virtual void onCell( size_t sheetIdx, size_t row, size_t column, const std::wstring & value ) = 0;
-	//! Handler of cell with double.
-	virtual void onCell( size_t sheetIdx, size_t row, size_t column, double value ) = 0;
-	//! Handler of cell with formula.
-	virtual void onCell( size_t sheetIdx, const Formula & value ) = 0;
-}; // struct IStorage
-
-struct EmptyStorage : public IStorage {
-protected:
-	void onSharedString( size_t sstSize, size_t idx, const std::wstring & value ) override {}
-	void onDateMode( uint16_t mode ) override {}
-	void onSheet( size_t idx, const std::wstring & value ) override {}
-	void onCellSharedString( size_t sheetIdx, size_t row, size_t column, size_t sstIndex ) override {}
-	void onCell( size_t sheetIdx, size_t row, size_t column, const std::wstring & value ) override {}
-	void onCell( size_t sheetIdx, size_t row, size_t column, double value ) override {}
-	void onCell( size_t sheetIdx, const Formula & value ) override {}
-}; // struct EmptyStorage
-
-} /* namespace Excel */
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#pragma once
+
+// C++ include.
+#include <string>
+
+// Excel include.
+#include "formula.hpp"
+#include "dimension.hpp"
+#include "record.hpp"
+#include "sst.hpp"
+
+namespace Excel {
+
+//
+// IStorage
+//
+
+/*!
+	Excel storage interface.
+
+	onSharedString(), onDateMode() and onSheet() are always called from
+	the thread that loads the book, before any cell of the sheets. If
+	worksheets are loaded in parallel (see LoadOptions::threadsCount) then
+	cell and dimension handlers of different sheets may be called
+	concurrently, each sheet is parsed by one thread, so handlers of one
+	sheet are never called concurrently and come in the order of the file.
+*/
+struct IStorage {
+	virtual ~IStorage() = default;
+
+protected:
+	friend class Parser;
+
+	//! Handler of SST.
+	virtual void onSharedString( size_t sstSize, size_t idx, const std::wstring & value ) = 0;
+	//! Handler of date mode.
+	virtual void onDateMode( uint16_t mode ) = 0;
+	//! Handler of sheet.
+	virtual void onSheet( size_t idx, const std::wstring & value ) = 0;
+	//! Handler of cell with text from SST.
+	virtual void onCellSharedString( size_t sheetIdx, size_t row, size_t column, size_t sstIndex ) = 0;
+	//! Handler of cell with text.
+	virtual void onCell( size_t sheetIdx, size_t row, size_t column, const std::wstring & value ) = 0;
+	//! Handler of cell with double.
+	virtual void onCell( size_t sheetIdx, size_t row, size_t column, double value ) = 0;
+	//! Handler of cell with formula.
+	virtual void onCell( size_t sheetIdx, const Formula & value ) = 0;
+	/*!
+		Handler of the used range of the sheet, it's called before cells
+		of the sheet if the sheet has DIMENSION record. It's the sheet's
+		handler as cell's ones. The range may be larger than the range of
+		the cells, for example, because of formatted empty cells.
+	*/
+	virtual void onSheetDimension( size_t /*sheetIdx*/, const Dimension & /*dimension*/ ) {}
+	/*!
+		Handler of the run of cells with doubles in the row, \a values
+		are the values of \a count cells starting from \a firstColumn.
+		It's called for MULRK records. The array is valid only during
+		the call. By default it calls onCell() for each cell.
+	*/
+	virtual void onCells( size_t sheetIdx, size_t row, size_t firstColumn,
+		const double * values, size_t count )
+	{
+		for( size_t i = 0; i < count; ++i )
+			onCell( sheetIdx, row, firstColumn + i, values[ i ] );
+	}
+	/*!
+		\return Types of the records the storage wants, e.g. only XL_NUMBER,
+		XL_RK, XL_RK2 and XL_MULRK for numbers. Data of other records with
+		cells, SST and DATEMODE is skipped without reading and their handlers
+		are not called. It's called once for the globals and once for each
+		sheet. All records by default.
+	*/
+	virtual RecordFilter recordFilter() const
+	{
+		return RecordFilter::all();
+	}
+	/*!
+		\return Table to load SST into or nullptr. If the storage has the
+		table, strings of SST are loaded straight into its buffer, there
+		is no std::wstring per string and onSharedString() isn't called.
+		nullptr by default.
+	*/
+	virtual SharedStringTable * sharedStringTable()
+	{
+		return nullptr;
+	}
+}; // struct IStorage
+
+struct EmptyStorage : public IStorage {
+protected:
+	void onSharedString( size_t sstSize, size_t idx, const std::wstring & value ) override {}
+	void onDateMode( uint16_t mode ) override {}
+	void onSheet( size_t idx, const std::wstring & value ) override {}
+	void onCellSharedString( size_t sheetIdx, size_t row, size_t column, size_t sstIndex ) override {}
+	void onCell( size_t sheetIdx, size_t row, size_t column, const std::wstring & value ) override {}
+	void onCell( size_t sheetIdx, size_t row, size_t column, double value ) override {}
+	void onCell( size_t sheetIdx, const Formula & value ) override {}
+}; // struct EmptyStorage
+
+} /* namespace Excel */
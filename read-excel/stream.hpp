@@ -1,126 +1,246 @@
-
-/*
-	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
-	SPDX-License-Identifier: MIT
-*/
-
-#ifndef EXCEL__STREAM_HPP__INCLUDED
-#define EXCEL__STREAM_HPP__INCLUDED
-
-// C++ include.
-#include <cstdint>
-
-// read-excel include.
-#include "exceptions.hpp"
-
-namespace Excel {
-
-//
-// Stream
-//
-
-//! Stream interface.
-class Stream {
-public:
-	//! Byte order identifier.
-	enum ByteOrder {
-		//! Big-Endian.
-		BigEndian,
-		//! Little-Endian.
-		LittleEndian
-	}; // enum ByteOrder
-
-private:
-
-	//
-	// SystemByteOrder
-	//
-
-	//! System's byte order.
-	class SystemByteOrder {
-	public:
-		static ByteOrder byteOrder()
-		{
-			static const int16_t word = 0x0001;
-			static const char * byte = (const char *) &word;
-
-			return ( byte[ 0 ] ? LittleEndian : BigEndian );
-		}
-	}; // class SystemByteOrder
-
-public:
-
-	explicit Stream( ByteOrder byteOrder );
-	virtual ~Stream();
-
-	//! \return Byte order in the stream.
-	ByteOrder byteOrder() const;
-
-	//! Read one byte from the stream.
-	virtual char getByte() = 0;
-
-	//! \return true if EOF reached.
-	virtual bool eof() const = 0;
-
-	//! Seek type.
-	enum SeekType {
-		//! Seek from the beginning of the stream.
-		FromBeginning,
-		//! Seek from the current position in the stream.
-		FromCurrent,
-		//! Seek from the end of the stream.
-		FromEnd
-	}; // enum SeekType
-
-	//! Seek stream to new position.
-	virtual void seek( int32_t pos, SeekType type = FromBeginning ) = 0;
-
-	//! \return Position in the stream.
-	virtual int32_t pos() = 0;
-
-	//! Read data from the stream.
-	template< typename Type >
-	void read( Type & retVal, int32_t bytes = 0 )
-	{
-		retVal = Type(0);
-		if( bytes == 0 ) bytes = sizeof( Type );
-
-		for( int32_t i = 0; i < bytes; ++i )
-		{
-			Type c = (Type)(unsigned char) getByte();
-
-			if( eof() )
-				throw Exception( L"Unexpected end of file." );
-
-			if( SystemByteOrder::byteOrder() != m_byteOrder )
-				retVal |= ( c << 8 * ( bytes - i - 1 ) );
-			else
-				retVal |= ( c << 8 * i );
-		}
-	}
-
-private:
-	//! Byte order.
-	ByteOrder m_byteOrder;
-}; // class Stream
-
-inline
-Stream::Stream( ByteOrder byteOrder )
-	:	m_byteOrder( byteOrder )
-{
-}
-
-inline
-Stream::~Stream()
-{
-}
-
-inline Stream::ByteOrder
-Stream::byteOrder() const
-{
-	return m_byteOrder;
-}
-
-} /* namespace Excel */
-
-#endif // EXCEL__STREAM_HPP__INCLUDED
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef EXCEL__STREAM_HPP__INCLUDED
+#define EXCEL__STREAM_HPP__INCLUDED
+
+// C++ include.
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+
+// read-excel include.
+#include "exceptions.hpp"
+
+namespace Excel {
+
+//
+// Stream
+//
+
+//! Stream interface.
+class Stream {
+public:
+	//! Byte order identifier.
+	enum ByteOrder {
+		//! Big-Endian.
+		BigEndian,
+		//! Little-Endian.
+		LittleEndian
+	}; // enum ByteOrder
+
+private:
+
+	//
+	// SystemByteOrder
+	//
+
+	//! System's byte order.
+	class SystemByteOrder {
+	public:
+		static ByteOrder byteOrder()
+		{
+			static const int16_t word = 0x0001;
+			static const char * byte = (const char *) &word;
+
+			return ( byte[ 0 ] ? LittleEndian : BigEndian );
+		}
+	}; // class SystemByteOrder
+
+public:
+
+	explicit Stream( ByteOrder byteOrder );
+	virtual ~Stream();
+
+	//! \return Byte order in the stream.
+	ByteOrder byteOrder() const;
+
+	//! \return Is byte order of the stream the same as system's one.
+	bool isSystemByteOrder() const;
+
+	//! Read one byte from the stream.
+	virtual char getByte() = 0;
+
+	//! \return true if EOF reached.
+	virtual bool eof() const = 0;
+
+	//! Seek type.
+	enum SeekType {
+		//! Seek from the beginning of the stream.
+		FromBeginning,
+		//! Seek from the current position in the stream.
+		FromCurrent,
+		//! Seek from the end of the stream.
+		FromEnd
+	}; // enum SeekType
+
+	//! Seek stream to new position.
+	virtual void seek( int32_t pos, SeekType type = FromBeginning ) = 0;
+
+	//! \return Position in the stream.
+	virtual int32_t pos() = 0;
+
+	/*!
+		Read \a size bytes from the stream into \a data.
+
+		\throw Exception if there is not enough data in the stream.
+	*/
+	void read( char * data, size_t size );
+
+	/*!
+		Read \a size bytes from the stream into \a data without exceptions.
+
+		\return false if there is not enough data in the stream, EOF is
+		reached then.
+
+		Default implementation reads byte by byte with getByte(),
+		streams should override it with a bulk copy.
+	*/
+	virtual bool tryRead( char * data, size_t size );
+
+	/*!
+		Skip \a size bytes of the stream.
+
+		\return false if there is not enough data in the stream, EOF is
+		reached then.
+
+		Default implementation reads the bytes with tryRead(), streams
+		should override it with moving of the position.
+	*/
+	virtual bool skip( size_t size );
+
+	/*!
+		Read \a size bytes in place.
+
+		\return Pointer to the data if the stream holds these bytes
+		contiguously in memory that stays valid while the stream is
+		alive, position in the stream is moved then. Otherwise nullptr
+		is returned and position in the stream is not changed.
+
+		Default implementation returns nullptr.
+	*/
+	virtual const char * readInPlace( size_t size );
+
+	//! Read data from the stream.
+	template< typename Type,
+		typename = typename std::enable_if< std::is_integral< Type >::value >::type >
+	void read( Type & retVal, int32_t bytes = 0 )
+	{
+		if( bytes <= 0 || bytes > static_cast< int32_t > ( sizeof( Type ) ) )
+			bytes = sizeof( Type );
+
+		char data[ sizeof( Type ) ];
+
+		read( data, static_cast< size_t > ( bytes ) );
+
+		retVal = fromBytes< Type >( data, bytes );
+	}
+
+	//! \return Integer from \a bytes bytes of \a data in the byte order of the stream.
+	template< typename Type,
+		typename = typename std::enable_if< std::is_integral< Type >::value >::type >
+	Type fromBytes( const char * data, int32_t bytes = 0 ) const
+	{
+		if( bytes <= 0 || bytes > static_cast< int32_t > ( sizeof( Type ) ) )
+			bytes = sizeof( Type );
+
+		const unsigned char * bytesData = reinterpret_cast< const unsigned char * > ( data );
+
+		Type retVal = Type(0);
+
+		if( !m_isSystemByteOrder )
+		{
+			for( int32_t i = 0; i < bytes; ++i )
+				retVal |= ( (Type) bytesData[ i ] << 8 * ( bytes - i - 1 ) );
+		}
+		else
+		{
+			for( int32_t i = 0; i < bytes; ++i )
+				retVal |= ( (Type) bytesData[ i ] << 8 * i );
+		}
+
+		return retVal;
+	}
+
+private:
+	//! Byte order.
+	ByteOrder m_byteOrder;
+	//! Is byte order of the stream the same as system's one.
+	bool m_isSystemByteOrder;
+}; // class Stream
+
+inline
+Stream::Stream( ByteOrder byteOrder )
+	:	m_byteOrder( byteOrder )
+	,	m_isSystemByteOrder( SystemByteOrder::byteOrder() == byteOrder )
+{
+}
+
+inline const char *
+Stream::readInPlace( size_t )
+{
+	return nullptr;
+}
+
+inline void
+Stream::read( char * data, size_t size )
+{
+	if( !tryRead( data, size ) )
+		throw Exception( L"Unexpected end of file." );
+}
+
+inline bool
+Stream::tryRead( char * data, size_t size )
+{
+	for( size_t i = 0; i < size; ++i )
+	{
+		data[ i ] = getByte();
+
+		if( eof() )
+			return false;
+	}
+
+	return true;
+}
+
+inline bool
+Stream::skip( size_t size )
+{
+	char data[ 512 ];
+
+	while( size > 0 )
+	{
+		const size_t count = ( size < sizeof( data ) ? size : sizeof( data ) );
+
+		if( !tryRead( data, count ) )
+			return false;
+
+		size -= count;
+	}
+
+	return true;
+}
+
+inline
+Stream::~Stream()
+{
+}
+
+inline Stream::ByteOrder
+Stream::byteOrder() const
+{
+	return m_byteOrder;
+}
+
+inline bool
+Stream::isSystemByteOrder() const
+{
+	return m_isSystemByteOrder;
+}
+
+} /* namespace Excel */
+
+#endif // EXCEL__STREAM_HPP__INCLUDED
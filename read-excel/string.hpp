@@ -1,156 +1,347 @@
-
-/*
-	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
-	SPDX-License-Identifier: MIT
-*/
-
-#ifndef EXCEL__STRING_HPP__INCLUDED
-#define EXCEL__STRING_HPP__INCLUDED
-
-// C++ include.
-#include <vector>
-#include <string>
-#include <cstdint>
-#include <algorithm>
-
-// Excel include.
-#include "stream.hpp"
-#include "bof.hpp"
-
-
-namespace Excel {
-
-//! Is high byte present in character.
-static const char IsHighByte = 0x01;
-
-//! Is extended string follows.
-static const char IsExtString = 0x04;
-
-//! Is rich string follows.
-static const char IsRichString = 0x08;
-
-
-//
-// isHighByte
-//
-
-inline bool
-isHighByte( char options )
-{
-	return ( options & IsHighByte );
-} // isHighByte
-
-
-//
-// isExtString
-//
-
-inline bool
-isExtString( char options )
-{
-	return ( options & IsExtString );
-} // isExtString
-
-
-//
-// isRichString
-//
-
-inline bool
-isRichString( char options )
-{
-	return ( options & IsRichString );
-} // isRichString
-
-
-//
-// isSkipByte
-//
-
-/*!
-	If string spleated between two or more records
-	there is one byte on the border wich should be
-	skipped.
-*/
-
-inline bool
-isSkipByte( int32_t pos, const std::vector< int32_t > & borders )
-{
-	return( std::find( borders.begin(), borders.end(), pos ) != borders.end() );
-} // isSkipByte
-
-
-//
-// loadString
-//
-
-//! Load string from the stream.
-inline std::wstring
-loadString( Stream & stream,
-	const std::vector< int32_t > & borders,
-	int32_t lengthFieldSize = 2,
-	BOF::BiffVersion biffVer = BOF::BIFF8 )
-{
-	int16_t charactersCount = 0;
-	char options = 0;
-	int16_t formattingRuns = 0;
-	int32_t extStringLength = 0;
-
-	stream.read( charactersCount, lengthFieldSize );
-
-	if( biffVer == BOF::BIFF7 && charactersCount > 255 )
-		throw Exception( L"Wrong format of XLS file." );
-
-	if( biffVer == BOF::BIFF8 )
-	{
-		stream.read( options, 1 );
-
-		if( isRichString( options ) )
-			stream.read( formattingRuns, 2 );
-
-		if( isExtString( options ) )
-			stream.read( extStringLength, 4 );
-	}
-
-	int16_t bytesPerChar = ( biffVer == BOF::BIFF8 ? ( isHighByte( options ) ? 2 : 1 ) : 1 );
-
-	std::vector< uint16_t > stringData( charactersCount );
-
-	for( int16_t i = 0; i < charactersCount; ++i )
-	{
-		if( isSkipByte( stream.pos(), borders ) )
-		{
-			stream.read( options, 1 );
-			bytesPerChar = ( biffVer == BOF::BIFF8 ? ( isHighByte( options ) ? 2 : 1 ) : 1 );
-		}
-
-		stream.read( stringData[ i ], bytesPerChar );
-	}
-
-	if( formattingRuns > 0 )
-	{
-		const size_t dummySize = formattingRuns * 4;
-		std::vector< char > dummy( dummySize );
-
-		for( size_t i = 0; i < dummySize; ++i )
-			stream.read( dummy[ i ], 1 );
-	}
-
-	if( extStringLength > 0 )
-	{
-		const size_t dummySize = extStringLength;
-		std::vector< char > dummy( dummySize );
-
-		for( size_t i = 0; i < dummySize; ++i )
-			stream.read( dummy[ i ], 1 );
-	}
-
-	std::wstring str;
-	str.assign( stringData.begin(), stringData.end() );
-
-	return str;
-}
-
-} /* namespace Excel */
-
-#endif // EXCEL__STRING_HPP__INCLUDED
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+#ifndef EXCEL__STRING_HPP__INCLUDED
+#define EXCEL__STRING_HPP__INCLUDED
+
+// C++ include.
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <algorithm>
+
+// Excel include.
+#include "simd.hpp"
+#include "stream.hpp"
+#include "bof.hpp"
+
+
+namespace Excel {
+
+//! Is high byte present in character.
+static const char IsHighByte = 0x01;
+
+//! Is extended string follows.
+static const char IsExtString = 0x04;
+
+//! Is rich string follows.
+static const char IsRichString = 0x08;
+
+
+//
+// isHighByte
+//
+
+inline bool
+isHighByte( char options )
+{
+	return ( options & IsHighByte );
+} // isHighByte
+
+
+//
+// isExtString
+//
+
+inline bool
+isExtString( char options )
+{
+	return ( options & IsExtString );
+} // isExtString
+
+
+//
+// isRichString
+//
+
+inline bool
+isRichString( char options )
+{
+	return ( options & IsRichString );
+} // isRichString
+
+
+//
+// isSkipByte
+//
+
+/*!
+	If string spleated between two or more records
+	there is one byte on the border wich should be
+	skipped.
+*/
+
+inline bool
+isSkipByte( int32_t pos, const std::vector< int32_t > & borders )
+{
+	return( std::find( borders.begin(), borders.end(), pos ) != borders.end() );
+} // isSkipByte
+
+
+//
+// widenLatin1Scalar
+//
+
+//! Widen \a count 1-byte characters to \a str one by one.
+inline void
+widenLatin1Scalar( const char * data, size_t count, wchar_t * str )
+{
+	for( size_t i = 0; i < count; ++i )
+		str[ i ] = static_cast< wchar_t > ( static_cast< unsigned char > ( data[ i ] ) );
+} // widenLatin1Scalar
+
+
+//
+// widenUtf16Scalar
+//
+
+/*!
+	Widen \a count 2-bytes characters to \a str one by one, low byte
+	goes first if \a lowByteFirst.
+*/
+inline void
+widenUtf16Scalar( const char * data, size_t count, bool lowByteFirst, wchar_t * str )
+{
+	const size_t low = ( lowByteFirst ? 0 : 1 );
+
+	for( size_t i = 0; i < count; ++i )
+		str[ i ] = static_cast< wchar_t > (
+			static_cast< unsigned char > ( data[ i * 2 + low ] ) |
+			( static_cast< unsigned char > ( data[ i * 2 + 1 - low ] ) << 8 ) );
+} // widenUtf16Scalar
+
+
+//
+// widenLatin1
+//
+
+//! Append \a count 1-byte characters to \a str, std::wstring or std::vector< wchar_t >.
+template< typename Chars >
+inline void
+widenLatin1( const char * data, size_t count, Chars & str )
+{
+	const size_t offset = str.size();
+
+	str.resize( offset + count );
+
+	if( !count )
+		return;
+
+	wchar_t * out = &str[ offset ];
+	size_t i = 0;
+
+#ifdef EXCEL__SSE2
+	const __m128i zero = _mm_setzero_si128();
+
+	for( ; i + 16 <= count; i += 16 )
+	{
+		const __m128i bytes = _mm_loadu_si128( reinterpret_cast< const __m128i * > ( data + i ) );
+		const __m128i low = _mm_unpacklo_epi8( bytes, zero );
+		const __m128i high = _mm_unpackhi_epi8( bytes, zero );
+
+		if( sizeof( wchar_t ) == 2 )
+		{
+			_mm_storeu_si128( reinterpret_cast< __m128i * > ( out + i ), low );
+			_mm_storeu_si128( reinterpret_cast< __m128i * > ( out + i + 8 ), high );
+		}
+		else
+		{
+			_mm_storeu_si128( reinterpret_cast< __m128i * > ( out + i ),
+				_mm_unpacklo_epi16( low, zero ) );
+			_mm_storeu_si128( reinterpret_cast< __m128i * > ( out + i + 4 ),
+				_mm_unpackhi_epi16( low, zero ) );
+			_mm_storeu_si128( reinterpret_cast< __m128i * > ( out + i + 8 ),
+				_mm_unpacklo_epi16( high, zero ) );
+			_mm_storeu_si128( reinterpret_cast< __m128i * > ( out + i + 12 ),
+				_mm_unpackhi_epi16( high, zero ) );
+		}
+	}
+#endif
+
+	widenLatin1Scalar( data + i, count - i, out + i );
+} // widenLatin1
+
+
+//
+// widenUtf16
+//
+
+/*!
+	Append \a count 2-bytes characters to \a str, std::wstring or
+	std::vector< wchar_t >, low byte goes first if \a lowByteFirst.
+*/
+template< typename Chars >
+inline void
+widenUtf16( const char * data, size_t count, bool lowByteFirst, Chars & str )
+{
+	const size_t offset = str.size();
+
+	str.resize( offset + count );
+
+	if( !count )
+		return;
+
+	wchar_t * out = &str[ offset ];
+	size_t i = 0;
+
+#ifdef EXCEL__SSE2
+	// x86 is little-endian, so UTF-16LE characters are 16-bit integers.
+	if( lowByteFirst )
+	{
+		const __m128i zero = _mm_setzero_si128();
+
+		for( ; i + 8 <= count; i += 8 )
+		{
+			const __m128i chars = _mm_loadu_si128(
+				reinterpret_cast< const __m128i * > ( data + i * 2 ) );
+
+			if( sizeof( wchar_t ) == 2 )
+				_mm_storeu_si128( reinterpret_cast< __m128i * > ( out + i ), chars );
+			else
+			{
+				_mm_storeu_si128( reinterpret_cast< __m128i * > ( out + i ),
+					_mm_unpacklo_epi16( chars, zero ) );
+				_mm_storeu_si128( reinterpret_cast< __m128i * > ( out + i + 4 ),
+					_mm_unpackhi_epi16( chars, zero ) );
+			}
+		}
+	}
+#endif
+
+	widenUtf16Scalar( data + i * 2, count - i, lowByteFirst, out + i );
+} // widenUtf16
+
+
+//
+// appendString
+//
+
+/*!
+	Load string from the stream and append its characters to \a str,
+	std::wstring or std::vector< wchar_t >, so strings may be loaded
+	one after another into one buffer.
+
+	Characters are read fragment by fragment between the borders of
+	CONTINUE records, each fragment at once. The first byte of each
+	fragment is the options byte with the size of characters in it.
+*/
+template< typename Chars >
+inline void
+appendString( Stream & stream,
+	const std::vector< int32_t > & borders,
+	Chars & str,
+	int32_t lengthFieldSize = 2,
+	BOF::BiffVersion biffVer = BOF::BIFF8 )
+{
+	int16_t charactersCount = 0;
+	char options = 0;
+	int16_t formattingRuns = 0;
+	int32_t extStringLength = 0;
+
+	stream.read( charactersCount, lengthFieldSize );
+
+	if( biffVer == BOF::BIFF7 && charactersCount > 255 )
+		throw Exception( L"Wrong format of XLS file." );
+
+	if( biffVer == BOF::BIFF8 )
+	{
+		stream.read( options, 1 );
+
+		if( isRichString( options ) )
+			stream.read( formattingRuns, 2 );
+
+		if( isExtString( options ) )
+			stream.read( extStringLength, 4 );
+	}
+
+	int16_t bytesPerChar = ( biffVer == BOF::BIFF8 ? ( isHighByte( options ) ? 2 : 1 ) : 1 );
+
+	size_t remaining = ( charactersCount > 0 ? static_cast< size_t > ( charactersCount ) : 0 );
+
+	// Borders go in ascending order.
+	auto border = std::lower_bound( borders.cbegin(), borders.cend(), stream.pos() );
+	std::vector< char > buffer;
+
+	while( remaining > 0 )
+	{
+		if( border != borders.cend() && *border == stream.pos() )
+		{
+			stream.read( options, 1 );
+			bytesPerChar = ( biffVer == BOF::BIFF8 ? ( isHighByte( options ) ? 2 : 1 ) : 1 );
+
+			// Empty CONTINUE records give the same border more than once.
+			while( border != borders.cend() && *border <= stream.pos() )
+				++border;
+		}
+
+		size_t count = remaining;
+
+		// At least one character is read, even if it's split by the border.
+		if( border != borders.cend() )
+			count = std::min( remaining, std::max< size_t > ( 1,
+				static_cast< size_t > ( *border - stream.pos() + bytesPerChar - 1 ) /
+					bytesPerChar ) );
+
+		const size_t bytes = count * bytesPerChar;
+		const char * data = stream.readInPlace( bytes );
+
+		if( !data )
+		{
+			buffer.resize( bytes );
+			stream.read( &buffer[ 0 ], bytes );
+			data = &buffer[ 0 ];
+		}
+
+		if( bytesPerChar == 1 )
+			widenLatin1( data, count, str );
+		else
+			widenUtf16( data, count, stream.isSystemByteOrder(), str );
+
+		remaining -= count;
+
+		while( border != borders.cend() && *border < stream.pos() )
+			++border;
+	}
+
+	if( formattingRuns > 0 )
+	{
+		const size_t dummySize = formattingRuns * 4;
+		std::vector< char > dummy( dummySize );
+
+		stream.read( &dummy[ 0 ], dummySize );
+	}
+
+	if( extStringLength > 0 )
+	{
+		const size_t dummySize = extStringLength;
+		std::vector< char > dummy( dummySize );
+
+		stream.read( &dummy[ 0 ], dummySize );
+	}
+} // appendString
+
+
+//
+// loadString
+//
+
+//! Load string from the stream, see appendString().
+inline std::wstring
+loadString( Stream & stream,
+	const std::vector< int32_t > & borders,
+	int32_t lengthFieldSize = 2,
+	BOF::BiffVersion biffVer = BOF::BIFF8 )
+{
+	std::wstring str;
+
+	appendString( stream, borders, str, lengthFieldSize, biffVer );
+
+	return str;
+} // loadString
+
+} /* namespace Excel */
+
+#endif // EXCEL__STRING_HPP__INCLUDED
@@ -0,0 +1,128 @@
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+
+// Excel include.
+#include <read-excel/parser.hpp>
+#include <read-excel/exceptions.hpp>
+
+// C++ include.
+#include <iostream>
+#include <chrono>
+#include <string>
+
+
+//
+// sheetTypeName
+//
+
+static const wchar_t *
+sheetTypeName( Excel::BoundSheet::SheetType type )
+{
+	switch( type )
+	{
+		case Excel::BoundSheet::WorkSheet :
+			return L"worksheet";
+
+		case Excel::BoundSheet::MacroSheet :
+			return L"macro sheet";
+
+		case Excel::BoundSheet::Chart :
+			return L"chart";
+
+		case Excel::BoundSheet::VisualBasicModule :
+			return L"VB module";
+
+		default :
+			return L"unknown";
+	}
+}
+
+
+//
+// dateModeName
+//
+
+static const wchar_t *
+dateModeName( int32_t mode )
+{
+	switch( mode )
+	{
+		case 0 :
+			return L"1899-Dec-31";
+
+		case 1 :
+			return L"1904-Jan-01";
+
+		default :
+			return L"unknown";
+	}
+}
+
+
+int main( int argc, char ** argv )
+{
+	if( argc < 2 )
+	{
+		std::wcout << L"Usage: inspect <file.xls> [<file.xls> ...]" << std::endl
+			<< L"Prints sheets, their types and used ranges, and date mode "
+				L"of the Excel files without loading cells." << std::endl;
+
+		return 1;
+	}
+
+	int result = 0;
+
+	for( int i = 1; i < argc; ++i )
+	{
+		const std::string fileName( argv[ i ] );
+
+		std::wcout << std::wstring( fileName.cbegin(), fileName.cend() ) << L":" << std::endl;
+
+		try {
+			const auto start = std::chrono::steady_clock::now();
+
+			const Excel::BookInfo info = Excel::Parser::inspectBook( fileName );
+
+			const auto duration = std::chrono::duration_cast< std::chrono::microseconds > (
+				std::chrono::steady_clock::now() - start );
+
+			std::wcout << L"\tdate mode: " << dateModeName( info.dateMode ) << std::endl;
+
+			for( size_t idx = 0; idx < info.sheets.size(); ++idx )
+			{
+				const Excel::SheetInfo & sheet = info.sheets[ idx ];
+
+				std::wcout << L"\t" << idx << L" \"" << sheet.boundSheet.sheetName()
+					<< L"\" " << sheetTypeName( sheet.boundSheet.sheetType() );
+
+				if( sheet.dimension.isValid() )
+					std::wcout << L" rows [" << sheet.dimension.firstRow() << L", "
+						<< sheet.dimension.rowsCount() << L") columns ["
+						<< sheet.dimension.firstColumn() << L", "
+						<< sheet.dimension.columnsCount() << L")";
+
+				std::wcout << std::endl;
+			}
+
+			std::wcout << L"\tinspected in " << duration.count() << L" us" << std::endl;
+		}
+		catch( const Excel::Exception & x )
+		{
+			std::wcout << L"\terror: " << x.whatAsWString() << std::endl;
+
+			result = 1;
+		}
+		catch( const std::exception & )
+		{
+			std::wcout << L"\terror: can't open file." << std::endl;
+
+			result = 1;
+		}
+	}
+
+	return result;
+}
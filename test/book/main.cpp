@@ -1,106 +1,607 @@
-
-/*
-	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
-	SPDX-License-Identifier: MIT
-*/
-
-// Excel include.
-#include <read-excel/book.hpp>
-
-// C++ include.
-#include <cmath>
-
-// unit test helper.
-#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
-#include <test/doctest/doctest.h>
-
-
-TEST_CASE( "test_book" )
-{
-	Excel::Book book( "test/data/test.xls" );
-
-	REQUIRE( book.sheetsCount() == 1 );
-
-	Excel::Sheet * sheet = book.sheet( 0 );
-
-	REQUIRE( sheet->rowsCount() == 3 );
-	REQUIRE( sheet->columnsCount() == 4 );
-
-	REQUIRE( sheet->cell( 0, 0 ).getString() == L"String #1" );
-	REQUIRE( sheet->cell( 1, 0 ).getString() == L"String #2" );
-	REQUIRE( sheet->cell( 2, 0 ).getString() == L"String #3" );
-
-	REQUIRE( std::fabs( sheet->cell( 0, 1 ).getDouble() - 1.0 ) < 1E-9 );
-	REQUIRE( std::fabs( sheet->cell( 1, 1 ).getDouble() - 2.0 ) < 1E-9 );
-	REQUIRE( std::fabs( sheet->cell( 2, 1 ).getDouble() - 3.0 ) < 1E-9 );
-
-	REQUIRE( std::fabs( sheet->cell( 0, 2 ).getDouble() - 0.1 ) < 1E-9 );
-	REQUIRE( std::fabs( sheet->cell( 1, 2 ).getDouble() - 0.2 ) < 1E-9 );
-	REQUIRE( std::fabs( sheet->cell( 2, 2 ).getDouble() - 0.3 ) < 1E-9 );
-
-	REQUIRE( std::fabs( sheet->cell( 0, 3 ).getFormula().getDouble() - 1.1 ) < 1E-9 );
-	REQUIRE( std::fabs( sheet->cell( 1, 3 ).getFormula().getDouble() - 2.2 ) < 1E-9 );
-	REQUIRE( std::fabs( sheet->cell( 2, 3 ).getFormula().getDouble() - 3.3 ) < 1E-9 );
-
-	book.clear();
-
-	REQUIRE( book.sheetsCount() == 0 );
-}
-
-TEST_CASE( "test_book_via_stream" )
-{
-	std::ifstream fileStream( "test/data/strange.xls", std::ios::in | std::ios::binary );
-	Excel::Book book( fileStream );
-
-	REQUIRE( book.sheetsCount() == 3 );
-
-	Excel::Sheet * sheet = book.sheet( 0 );
-	const auto text = sheet->cell( 0, 0 ).getString();
-	REQUIRE( text.find( L"Somefile" ) != std::wstring::npos );
-	REQUIRE( text.find( L"abcd" ) == 0 );
-	REQUIRE( text.length() == 255 );
-}
-
-struct CustomStorage : public Excel::EmptyStorage {
-	std::wstring m_text;
-	std::wstring m_sheetName;
-	void onSharedString( size_t sstSize, size_t idx, const std::wstring & value ) override;
-	void onSheet( size_t idx, const std::wstring & value ) override;
-}; // struct CustomStorage
-
-inline void
-CustomStorage::onSharedString( size_t , size_t , const std::wstring & value )
-{
-	m_text += value;
-}
-
-inline void
-CustomStorage::onSheet( size_t , const std::wstring & value )
-{
-	m_sheetName = value;
-}
-
-TEST_CASE( "test_book_custom_storage" )
-{
-	std::ifstream fileStream( "test/data/test.xls", std::ios::in | std::ios::binary );
-	CustomStorage storage;
-	Excel::Parser::loadBook( fileStream, storage );
-
-	REQUIRE( storage.m_text.find( L"String #1" ) != std::wstring::npos );
-	REQUIRE( storage.m_sheetName == L"Sheet" );
-}
-
-TEST_CASE( "test_book_empty_storage" )
-{
-	std::ifstream fileStream( "test/data/test.xls", std::ios::in | std::ios::binary );
-	Excel::EmptyStorage emptyStorage;
-	Excel::Parser::loadBook( fileStream, emptyStorage );
-}
-
-TEST_CASE( "test_very_small_book" )
-{
-	Excel::Book book( "test/data/MiscOperatorTests.xls" );
-
-	REQUIRE( book.sheetsCount() == 3 );
-	REQUIRE( book.sheet( 0 )->sheetName() == L"Sheet1" );
-}
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// Excel include.
+#include <read-excel/book.hpp>
+#include <read-excel/columnar.hpp>
+
+// C++ include.
+#include <cmath>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <cstring>
+
+// unit test helper.
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <test/doctest/doctest.h>
+
+
+TEST_CASE( "test_book" )
+{
+	Excel::Book book( "test/data/test.xls" );
+
+	REQUIRE( book.sheetsCount() == 1 );
+
+	Excel::Sheet * sheet = book.sheet( 0 );
+
+	REQUIRE( sheet->rowsCount() == 3 );
+	REQUIRE( sheet->columnsCount() == 4 );
+
+	REQUIRE( sheet->cell( 0, 0 ).getString() == L"String #1" );
+	REQUIRE( sheet->cell( 1, 0 ).getString() == L"String #2" );
+	REQUIRE( sheet->cell( 2, 0 ).getString() == L"String #3" );
+
+	REQUIRE( std::fabs( sheet->cell( 0, 1 ).getDouble() - 1.0 ) < 1E-9 );
+	REQUIRE( std::fabs( sheet->cell( 1, 1 ).getDouble() - 2.0 ) < 1E-9 );
+	REQUIRE( std::fabs( sheet->cell( 2, 1 ).getDouble() - 3.0 ) < 1E-9 );
+
+	REQUIRE( std::fabs( sheet->cell( 0, 2 ).getDouble() - 0.1 ) < 1E-9 );
+	REQUIRE( std::fabs( sheet->cell( 1, 2 ).getDouble() - 0.2 ) < 1E-9 );
+	REQUIRE( std::fabs( sheet->cell( 2, 2 ).getDouble() - 0.3 ) < 1E-9 );
+
+	REQUIRE( std::fabs( sheet->cell( 0, 3 ).getFormula().getDouble() - 1.1 ) < 1E-9 );
+	REQUIRE( std::fabs( sheet->cell( 1, 3 ).getFormula().getDouble() - 2.2 ) < 1E-9 );
+	REQUIRE( std::fabs( sheet->cell( 2, 3 ).getFormula().getDouble() - 3.3 ) < 1E-9 );
+
+	book.clear();
+
+	REQUIRE( book.sheetsCount() == 0 );
+}
+
+TEST_CASE( "test_book_via_stream" )
+{
+	std::ifstream fileStream( "test/data/strange.xls", std::ios::in | std::ios::binary );
+	Excel::Book book( fileStream );
+
+	REQUIRE( book.sheetsCount() == 3 );
+
+	Excel::Sheet * sheet = book.sheet( 0 );
+	const auto text = sheet->cell( 0, 0 ).getString();
+	REQUIRE( text.find( L"Somefile" ) != std::wstring::npos );
+	REQUIRE( text.find( L"abcd" ) == 0 );
+	REQUIRE( text.length() == 255 );
+}
+
+TEST_CASE( "test_book_via_memory" )
+{
+	std::vector< char > data;
+
+	{
+		std::ifstream fileStream( "test/data/strange.xls", std::ios::in | std::ios::binary );
+		data.assign( std::istreambuf_iterator< char > ( fileStream ),
+			std::istreambuf_iterator< char > () );
+	}
+
+	Excel::Book book( data.data(), data.size() );
+
+	// Book doesn't refer to the data after loading.
+	std::fill( data.begin(), data.end(), 0 );
+
+	REQUIRE( book.sheetsCount() == 3 );
+
+	Excel::Sheet * sheet = book.sheet( 0 );
+	const auto text = sheet->cell( 0, 0 ).getString();
+	REQUIRE( text.find( L"Somefile" ) != std::wstring::npos );
+	REQUIRE( text.find( L"abcd" ) == 0 );
+	REQUIRE( text.length() == 255 );
+
+	REQUIRE_THROWS_AS( Excel::Book( data.data(), data.size() ), Excel::Exception );
+	REQUIRE_THROWS_AS( Excel::Book( nullptr, 0 ), Excel::Exception );
+}
+
+//! Files in test/data that are loaded in every way and compared with Book.
+static const std::vector< std::string > c_testFiles = {
+	"test/data/test.xls", "test/data/big.xls", "test/data/strange.xls",
+	"test/data/sample.xls", "test/data/stringformula.xls",
+	"test/data/datetime.xls", "test/data/MiscOperatorTests.xls" };
+
+
+//
+// forEachTestFile
+//
+
+//! Call \a test with the name of each file of c_testFiles and the Book loaded from it.
+template< typename Test >
+static void
+forEachTestFile( Test test )
+{
+	for( const auto & fileName : c_testFiles )
+	{
+		const Excel::Book expected( fileName );
+
+		test( fileName, expected );
+	}
+}
+
+
+//
+// requireEqualSheets
+//
+
+/*!
+	Check the name and the size of \a sheet and call \a requireEqualCell
+	with the row, the column and the cell of \a expected for each cell.
+*/
+template< typename Sheet, typename RequireEqualCell >
+static void
+requireEqualSheets( const Excel::Sheet & expected, const Sheet & sheet,
+	RequireEqualCell requireEqualCell )
+{
+	REQUIRE( sheet.sheetName() == expected.sheetName() );
+	REQUIRE( sheet.rowsCount() == expected.rowsCount() );
+	REQUIRE( sheet.columnsCount() == expected.columnsCount() );
+
+	for( size_t row = 0; row < sheet.rowsCount(); ++row )
+	{
+		for( size_t column = 0; column < sheet.columnsCount(); ++column )
+			requireEqualCell( row, column, expected.cell( row, column ) );
+	}
+}
+
+
+//
+// requireEqualBooks
+//
+
+static void
+requireEqualBooks( const Excel::Book & expected, const Excel::Book & book )
+{
+	REQUIRE( book.dateMode() == expected.dateMode() );
+	REQUIRE( book.sheetsCount() == expected.sheetsCount() );
+
+	for( size_t i = 0; i < expected.sheetsCount(); ++i )
+	{
+		const Excel::Sheet * expectedSheet = expected.sheet( i );
+		const Excel::Sheet * sheet = book.sheet( i );
+
+		REQUIRE( ( sheet == nullptr ) == ( expectedSheet == nullptr ) );
+
+		if( !sheet )
+			continue;
+
+		requireEqualSheets( *expectedSheet, *sheet,
+			[ sheet ] ( size_t row, size_t column, const Excel::Cell & expectedCell )
+			{
+				const Excel::Cell & cell = sheet->cell( row, column );
+
+				REQUIRE( cell.dataType() == expectedCell.dataType() );
+
+				switch( cell.dataType() )
+				{
+					case Excel::Cell::DataType::String :
+						REQUIRE( cell.getString() == expectedCell.getString() );
+						break;
+
+					case Excel::Cell::DataType::Double :
+						REQUIRE( std::memcmp( &cell.getDouble(),
+							&expectedCell.getDouble(), sizeof( double ) ) == 0 );
+						break;
+
+					case Excel::Cell::DataType::Formula :
+						REQUIRE( cell.getFormula().valueType() ==
+							expectedCell.getFormula().valueType() );
+						REQUIRE( cell.getFormula().getString() ==
+							expectedCell.getFormula().getString() );
+						break;
+
+					default :
+						break;
+				}
+			} );
+	}
+}
+
+TEST_CASE( "test_book_parallel" )
+{
+	forEachTestFile( [] ( const std::string & fileName, const Excel::Book & expected )
+	{
+		for( const size_t threadsCount : { 0, 2, 4, 16 } )
+		{
+			Excel::LoadOptions options;
+			options.threadsCount = threadsCount;
+
+			{
+				Excel::Book book( fileName, options );
+
+				requireEqualBooks( expected, book );
+			}
+
+			{
+				std::ifstream fileStream( fileName, std::ios::in | std::ios::binary );
+				const std::vector< char > data( ( std::istreambuf_iterator< char > ( fileStream ) ),
+					std::istreambuf_iterator< char > () );
+
+				Excel::Book book( data.data(), data.size(), options );
+
+				requireEqualBooks( expected, book );
+			}
+
+			{
+				std::ifstream fileStream( fileName, std::ios::in | std::ios::binary );
+				Excel::Book book( fileStream, options );
+
+				requireEqualBooks( expected, book );
+			}
+		}
+	} );
+}
+
+TEST_CASE( "test_book_compact_sheets" )
+{
+	forEachTestFile( [] ( const std::string & fileName, const Excel::Book & expected )
+	{
+		for( const size_t threadsCount : { 1, 4 } )
+		{
+			Excel::LoadOptions options;
+			options.threadsCount = threadsCount;
+			options.compactSheets = true;
+
+			const Excel::Book book( fileName, options );
+
+			requireEqualBooks( expected, book );
+
+			for( size_t i = 0; i < book.sheetsCount(); ++i )
+			{
+				const Excel::Sheet * sheet = book.sheet( i );
+
+				REQUIRE( sheet->storageMode() == Excel::Sheet::StorageMode::Compact );
+
+				requireEqualSheets( *expected.sheet( i ), *sheet,
+					[ sheet ] ( size_t row, size_t column, const Excel::Cell & expectedCell )
+					{
+						const Excel::CellValue value = sheet->value( row, column );
+
+						REQUIRE( value.dataType() == expectedCell.dataType() );
+						REQUIRE( value.getString() == expectedCell.getString() );
+					} );
+			}
+		}
+	} );
+}
+
+TEST_CASE( "test_columnar_book" )
+{
+	forEachTestFile( [] ( const std::string & fileName, const Excel::Book & expected )
+	{
+		for( const size_t threadsCount : { 1, 4 } )
+		{
+			Excel::LoadOptions options;
+			options.threadsCount = threadsCount;
+
+			const Excel::ColumnarBook book( fileName, options );
+
+			REQUIRE( book.dateMode() == expected.dateMode() );
+			REQUIRE( book.sheetsCount() == expected.sheetsCount() );
+
+			for( size_t i = 0; i < book.sheetsCount(); ++i )
+			{
+				const Excel::ColumnarSheet * sheet = book.sheet( i );
+
+				for( size_t column = 0; column < sheet->columnsCount(); ++column )
+					REQUIRE( sheet->column( column ).size() <= sheet->rowsCount() );
+
+				requireEqualSheets( *expected.sheet( i ), *sheet,
+					[ & ] ( size_t row, size_t column, const Excel::Cell & expectedCell )
+					{
+						const Excel::Column & data = sheet->column( column );
+
+						REQUIRE( data.isValid( row ) == !expectedCell.isNull() );
+
+						switch( data.type( row ) )
+						{
+							case Excel::Column::Type::Empty :
+								REQUIRE( expectedCell.isNull() );
+								break;
+
+							case Excel::Column::Type::Double :
+								REQUIRE( expectedCell.dataType() == Excel::Cell::DataType::Double );
+								REQUIRE( data.getDouble( row ) == expectedCell.getDouble() );
+								break;
+
+							case Excel::Column::Type::SharedString :
+								REQUIRE( expectedCell.dataType() == Excel::Cell::DataType::String );
+								REQUIRE( book.sharedStrings()[ data.index( row ) ] ==
+									expectedCell.getString() );
+								break;
+
+							case Excel::Column::Type::String :
+								REQUIRE( expectedCell.dataType() == Excel::Cell::DataType::String );
+								REQUIRE( sheet->strings()[ data.index( row ) ] ==
+									expectedCell.getString() );
+								break;
+
+							case Excel::Column::Type::Formula :
+							{
+								REQUIRE( expectedCell.dataType() == Excel::Cell::DataType::Formula );
+
+								const Excel::Formula & formula = sheet->formulas()[ data.index( row ) ];
+
+								REQUIRE( formula.valueType() ==
+									expectedCell.getFormula().valueType() );
+								REQUIRE( formula.getString() == expectedCell.getFormula().getString() );
+							}
+								break;
+						}
+					} );
+			}
+		}
+	} );
+}
+
+TEST_CASE( "test_book_selected_sheets" )
+{
+	const Excel::Book full( "test/data/strange.xls" );
+
+	REQUIRE( full.sheetsCount() == 3 );
+
+	for( const size_t threadsCount : { 1, 4 } )
+	{
+		{
+			Excel::LoadOptions options;
+			options.threadsCount = threadsCount;
+			options.sheetFilter = Excel::sheetsWithIndexes( { 1 } );
+
+			const Excel::Book book( "test/data/strange.xls", options );
+
+			REQUIRE( book.sheetsCount() == 2 );
+			REQUIRE( book.sheet( 0 ) == nullptr );
+			REQUIRE( book.sheet( 1 )->sheetName() == full.sheet( 1 )->sheetName() );
+			REQUIRE( book.sheet( 1 )->rowsCount() == full.sheet( 1 )->rowsCount() );
+			REQUIRE( book.sheet( 1 )->columnsCount() == full.sheet( 1 )->columnsCount() );
+		}
+
+		{
+			Excel::LoadOptions options;
+			options.threadsCount = threadsCount;
+			options.sheetFilter = Excel::sheetsWithNames(
+				{ full.sheet( 0 )->sheetName(), full.sheet( 2 )->sheetName() } );
+
+			const Excel::Book book( "test/data/strange.xls", options );
+
+			REQUIRE( book.sheetsCount() == 3 );
+			REQUIRE( book.sheet( 0 )->sheetName() == full.sheet( 0 )->sheetName() );
+			REQUIRE( book.sheet( 0 )->cell( 0, 0 ).getString() ==
+				full.sheet( 0 )->cell( 0, 0 ).getString() );
+			REQUIRE( book.sheet( 1 ) == nullptr );
+			REQUIRE( book.sheet( 2 )->sheetName() == full.sheet( 2 )->sheetName() );
+		}
+
+		{
+			Excel::LoadOptions options;
+			options.threadsCount = threadsCount;
+			options.sheetFilter = Excel::sheetsWithNames( { L"ThereIsNoSuchSheet" } );
+
+			const Excel::Book book( "test/data/strange.xls", options );
+
+			REQUIRE( book.sheetsCount() == 0 );
+		}
+	}
+}
+
+TEST_CASE( "test_inspect_book" )
+{
+	forEachTestFile( [] ( const std::string & fileName, const Excel::Book & book )
+	{
+		const Excel::BookInfo info = Excel::Parser::inspectBook( fileName );
+
+		REQUIRE( info.dateMode == static_cast< int32_t > ( book.dateMode() ) );
+		REQUIRE( info.sheets.size() == book.sheetsCount() );
+
+		for( size_t i = 0; i < info.sheets.size(); ++i )
+		{
+			const Excel::SheetInfo & sheetInfo = info.sheets[ i ];
+
+			REQUIRE( sheetInfo.boundSheet.sheetType() == Excel::BoundSheet::WorkSheet );
+			REQUIRE( sheetInfo.boundSheet.sheetName() == book.sheet( i )->sheetName() );
+			REQUIRE( sheetInfo.dimension.isValid() );
+			REQUIRE( sheetInfo.dimension.rowsCount() >= book.sheet( i )->rowsCount() );
+			REQUIRE( sheetInfo.dimension.columnsCount() >= book.sheet( i )->columnsCount() );
+		}
+	} );
+
+	const Excel::BookInfo info = Excel::Parser::inspectBook( "test/data/test.xls" );
+
+	REQUIRE( info.sheets.front().dimension.firstRow() == 0 );
+	REQUIRE( info.sheets.front().dimension.rowsCount() == 3 );
+	REQUIRE( info.sheets.front().dimension.firstColumn() == 0 );
+	REQUIRE( info.sheets.front().dimension.columnsCount() == 4 );
+
+	REQUIRE_THROWS_AS( Excel::Parser::inspectBook( "test/data/ThereIsNoSuchFile.xls" ),
+		Excel::Exception );
+}
+
+struct CustomStorage : public Excel::EmptyStorage {
+	std::wstring m_text;
+	std::wstring m_sheetName;
+	void onSharedString( size_t sstSize, size_t idx, const std::wstring & value ) override;
+	void onSheet( size_t idx, const std::wstring & value ) override;
+}; // struct CustomStorage
+
+inline void
+CustomStorage::onSharedString( size_t , size_t , const std::wstring & value )
+{
+	m_text += value;
+}
+
+inline void
+CustomStorage::onSheet( size_t , const std::wstring & value )
+{
+	m_sheetName = value;
+}
+
+TEST_CASE( "test_book_custom_storage" )
+{
+	std::ifstream fileStream( "test/data/test.xls", std::ios::in | std::ios::binary );
+	CustomStorage storage;
+	Excel::Parser::loadBook( fileStream, storage );
+
+	REQUIRE( storage.m_text.find( L"String #1" ) != std::wstring::npos );
+	REQUIRE( storage.m_sheetName == L"Sheet" );
+}
+
+TEST_CASE( "test_book_empty_storage" )
+{
+	std::ifstream fileStream( "test/data/test.xls", std::ios::in | std::ios::binary );
+	Excel::EmptyStorage emptyStorage;
+	Excel::Parser::loadBook( fileStream, emptyStorage );
+}
+
+//! Storage with non-virtual handlers, counts cells.
+struct StaticStorage final {
+	size_t m_sharedStrings = 0;
+	size_t m_sheets = 0;
+	size_t m_cells = 0;
+	size_t m_strings = 0;
+	size_t m_formulas = 0;
+	double m_sum = 0.0;
+
+	void onSharedString( size_t , size_t , const std::wstring & ) { ++m_sharedStrings; }
+	void onDateMode( uint16_t ) {}
+	void onSheet( size_t , const std::wstring & ) { ++m_sheets; }
+	void onCellSharedString( size_t , size_t , size_t , size_t ) { ++m_cells; ++m_strings; }
+	void onCell( size_t , size_t , size_t , const std::wstring & ) { ++m_cells; ++m_strings; }
+	void onCell( size_t , size_t , size_t , double value ) { ++m_cells; m_sum += value; }
+	void onCell( size_t , const Excel::Formula & ) { ++m_cells; ++m_formulas; }
+	void onSheetDimension( size_t , const Excel::Dimension & ) {}
+	void onCells( size_t sheetIdx, size_t row, size_t firstColumn, const double * values,
+		size_t count )
+	{
+		for( size_t i = 0; i < count; ++i )
+			onCell( sheetIdx, row, firstColumn + i, values[ i ] );
+	}
+}; // struct StaticStorage
+
+//! The same storage with virtual handlers.
+struct VirtualStorage : public Excel::IStorage {
+	StaticStorage m_storage;
+
+	void onSharedString( size_t sstSize, size_t idx, const std::wstring & value ) override
+		{ m_storage.onSharedString( sstSize, idx, value ); }
+	void onDateMode( uint16_t mode ) override { m_storage.onDateMode( mode ); }
+	void onSheet( size_t idx, const std::wstring & value ) override
+		{ m_storage.onSheet( idx, value ); }
+	void onCellSharedString( size_t sheetIdx, size_t row, size_t column, size_t sstIndex ) override
+		{ m_storage.onCellSharedString( sheetIdx, row, column, sstIndex ); }
+	void onCell( size_t sheetIdx, size_t row, size_t column, const std::wstring & value ) override
+		{ m_storage.onCell( sheetIdx, row, column, value ); }
+	void onCell( size_t sheetIdx, size_t row, size_t column, double value ) override
+		{ m_storage.onCell( sheetIdx, row, column, value ); }
+	void onCell( size_t sheetIdx, const Excel::Formula & value ) override
+		{ m_storage.onCell( sheetIdx, value ); }
+}; // struct VirtualStorage
+
+TEST_CASE( "test_book_static_storage" )
+{
+	for( const char * fileName : { "test/data/big.xls", "test/data/test.xls",
+		"test/data/strange.xls" } )
+	{
+		VirtualStorage expected;
+		Excel::Parser::loadBook( fileName, expected );
+
+		StaticStorage storage;
+		Excel::Parser::loadBook< StaticStorage >( fileName, storage );
+
+		REQUIRE( storage.m_sharedStrings == expected.m_storage.m_sharedStrings );
+		REQUIRE( storage.m_sheets == expected.m_storage.m_sheets );
+		REQUIRE( storage.m_cells == expected.m_storage.m_cells );
+		REQUIRE( storage.m_strings == expected.m_storage.m_strings );
+		REQUIRE( storage.m_formulas == expected.m_storage.m_formulas );
+		REQUIRE( storage.m_sum == expected.m_storage.m_sum );
+		REQUIRE( storage.m_cells > 0 );
+	}
+}
+
+//! Storage that wants only numbers.
+struct NumbersStorage : public VirtualStorage {
+	Excel::RecordFilter recordFilter() const override
+	{
+		return { Excel::XL_NUMBER, Excel::XL_RK, Excel::XL_RK2, Excel::XL_MULRK };
+	}
+}; // struct NumbersStorage
+
+TEST_CASE( "test_book_record_filter" )
+{
+	for( const char * fileName : { "test/data/big.xls", "test/data/test.xls",
+		"test/data/strange.xls" } )
+	{
+		VirtualStorage expected;
+		Excel::Parser::loadBook( fileName, expected );
+
+		NumbersStorage storage;
+		Excel::Parser::loadBook( fileName, storage );
+
+		REQUIRE( storage.m_storage.m_sharedStrings == 0 );
+		REQUIRE( storage.m_storage.m_sheets == expected.m_storage.m_sheets );
+		REQUIRE( storage.m_storage.m_strings == 0 );
+		REQUIRE( storage.m_storage.m_formulas == 0 );
+		REQUIRE( storage.m_storage.m_cells == expected.m_storage.m_cells -
+			expected.m_storage.m_strings - expected.m_storage.m_formulas );
+		REQUIRE( storage.m_storage.m_sum == expected.m_storage.m_sum );
+	}
+}
+
+//! Storage that gets MULRK records as runs of cells.
+struct BatchStorage : public Excel::EmptyStorage {
+	size_t m_batches = 0;
+	size_t m_batchedCells = 0;
+	size_t m_cells = 0;
+	double m_sum = 0.0;
+
+	void onCell( size_t , size_t , size_t , double value ) override
+	{
+		++m_cells;
+		m_sum += value;
+	}
+
+	void onCells( size_t , size_t , size_t , const double * values, size_t count ) override
+	{
+		++m_batches;
+		m_batchedCells += count;
+
+		for( size_t i = 0; i < count; ++i )
+			m_sum += values[ i ];
+	}
+}; // struct BatchStorage
+
+TEST_CASE( "test_book_batched_cells" )
+{
+	const Excel::Book book( "test/data/big.xls" );
+
+	size_t doubles = 0;
+	double sum = 0.0;
+
+	for( size_t row = 0; row < book.sheet( 0 )->rowsCount(); ++row )
+	{
+		for( size_t column = 0; column < book.sheet( 0 )->columnsCount(); ++column )
+		{
+			const Excel::Cell & cell = book.sheet( 0 )->cell( row, column );
+
+			if( cell.dataType() == Excel::Cell::DataType::Double )
+			{
+				++doubles;
+				sum += cell.getDouble();
+			}
+		}
+	}
+
+	BatchStorage storage;
+	Excel::Parser::loadBook( "test/data/big.xls", storage );
+
+	REQUIRE( storage.m_batches > 0 );
+	REQUIRE( storage.m_batchedCells + storage.m_cells == doubles );
+	REQUIRE( std::fabs( storage.m_sum - sum ) <= 1E-6 * std::fabs( sum ) );
+}
+
+TEST_CASE( "test_very_small_book" )
+{
+	Excel::Book book( "test/data/MiscOperatorTests.xls" );
+
+	REQUIRE( book.sheetsCount() == 3 );
+	REQUIRE( book.sheet( 0 )->sheetName() == L"Sheet1" );
+}
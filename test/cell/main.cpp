@@ -1,35 +1,217 @@
-
-/*
-	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
-	SPDX-License-Identifier: MIT
-*/
-
-// Excel include.
-#include <read-excel/cell.hpp>
-
-// unit test helper.
-#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
-#include <test/doctest/doctest.h>
-
-
-TEST_CASE( "test_cell" )
-{
-	Excel::Cell cell;
-
-	cell.setData( 0.123456789 );
-
-	REQUIRE( cell.getDouble() == 0.123456789 );
-
-	cell.setData( L"1234567890" );
-
-	REQUIRE( cell.getString() == L"1234567890" );
-
-	cell.setData( 1234.0 );
-
-	REQUIRE( cell.getDouble() == 1234.0 );
-
-	cell.setData( L"qwerty" );
-
-	REQUIRE( cell.getString() == L"qwerty" );
-
-}
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// Excel include.
+#include <read-excel/cell.hpp>
+#include <read-excel/sheet.hpp>
+
+// C++ include.
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// unit test helper.
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <test/doctest/doctest.h>
+
+
+TEST_CASE( "test_cell" )
+{
+	Excel::Cell cell;
+
+	cell.setData( 0.123456789 );
+
+	REQUIRE( cell.getDouble() == 0.123456789 );
+
+	cell.setData( L"1234567890" );
+
+	REQUIRE( cell.getString() == L"1234567890" );
+
+	cell.setData( 1234.0 );
+
+	REQUIRE( cell.getDouble() == 1234.0 );
+
+	cell.setData( L"qwerty" );
+
+	REQUIRE( cell.getString() == L"qwerty" );
+
+	const std::wstring shared = L"shared";
+
+	cell.setSharedString( shared );
+
+	REQUIRE( cell.dataType() == Excel::Cell::DataType::String );
+	REQUIRE( &cell.getString() == &shared );
+
+	const Excel::Cell copy = cell;
+
+	REQUIRE( &copy.getString() == &shared );
+
+	cell.setData( L"own" );
+
+	REQUIRE( cell.getString() == L"own" );
+	REQUIRE( shared == L"shared" );
+}
+
+
+TEST_CASE( "test_sheet" )
+{
+	for( const auto mode : { Excel::Sheet::StorageMode::Dense, Excel::Sheet::StorageMode::Compact } )
+	for( const bool reserve : { false, true } )
+	{
+		Excel::Sheet sheet( L"Sheet", mode );
+
+		if( reserve )
+			sheet.reserve( 100, 10 );
+
+		REQUIRE( sheet.rowsCount() == 0 );
+		REQUIRE( sheet.columnsCount() == 0 );
+		REQUIRE( sheet.cell( 0, 0 ).isNull() );
+
+		sheet.setCell( 0, 0, 1.0 );
+		sheet.setCell( 5, 1, std::wstring( L"qwerty" ) );
+
+		// Left to right filling of the wide row.
+		for( size_t column = 2; column < 300; ++column )
+			sheet.setCell( 1, column, static_cast< double > ( column ) );
+
+		sheet.setCell( 200, 3, 3.0 );
+
+		const std::wstring shared = L"shared";
+		sheet.setSharedString( 7, 0, shared );
+
+		REQUIRE( sheet.rowsCount() == 201 );
+		REQUIRE( sheet.columnsCount() == 300 );
+
+		REQUIRE( sheet.cell( 0, 0 ).getDouble() == 1.0 );
+		REQUIRE( sheet.cell( 5, 1 ).getString() == L"qwerty" );
+		REQUIRE( sheet.cell( 200, 3 ).getDouble() == 3.0 );
+		REQUIRE( &sheet.cell( 7, 0 ).getString() == &shared );
+
+		for( size_t column = 2; column < 300; ++column )
+			REQUIRE( sheet.cell( 1, column ).getDouble() == static_cast< double > ( column ) );
+
+		REQUIRE( sheet.cell( 2, 0 ).isNull() );
+		REQUIRE( sheet.cell( 5, 299 ).isNull() );
+		REQUIRE( sheet.cell( 201, 0 ).isNull() );
+		REQUIRE( sheet.cell( 0, 300 ).isNull() );
+
+		REQUIRE( sheet.value( 0, 0 ).getDouble() == 1.0 );
+		REQUIRE( sheet.value( 5, 1 ).getString() == L"qwerty" );
+		REQUIRE( sheet.value( 5, 2 ).isNull() );
+		REQUIRE( sheet.value( 201, 0 ).isNull() );
+	}
+}
+
+
+TEST_CASE( "test_sheet_without_dimension" )
+{
+	Excel::Sheet sheet( L"Sheet" );
+
+	// Rows get wider and wider as in the sheet without DIMENSION record.
+	for( size_t row = 0; row < 1000; ++row )
+		for( size_t column = 0; column <= row / 4; ++column )
+			sheet.setCell( row, column, static_cast< double > ( column ) );
+
+	REQUIRE( sheet.rowsCount() == 1000 );
+	REQUIRE( sheet.columnsCount() == 250 );
+	REQUIRE( sheet.allocatedColumnsCount() >= sheet.columnsCount() );
+	REQUIRE( sheet.allocatedColumnsCount() <=
+		sheet.columnsCount() + Excel::c_maxColumnsSlack );
+
+	for( size_t row = 0; row < 1000; ++row )
+		for( size_t column = 0; column < 250; ++column )
+		{
+			if( column <= row / 4 )
+				REQUIRE( sheet.cell( row, column ).getDouble() == static_cast< double > ( column ) );
+			else
+				REQUIRE( sheet.cell( row, column ).isNull() );
+		}
+}
+
+
+TEST_CASE( "test_compact_sheet" )
+{
+	Excel::Sheet sheet( L"Sheet", Excel::Sheet::StorageMode::Compact );
+
+	const std::wstring shared = L"shared";
+
+	// Runs of cells in any order: separate, joined by the gap, adjacent.
+	const size_t columns[] = { 100, 10, 50, 12, 11, 52, 9, 200, 199, 201, 0 };
+
+	for( const size_t column : columns )
+		sheet.setCell( 3, column, static_cast< double > ( column ) );
+
+	sheet.setSharedString( 3, 51, shared );
+	sheet.setCell( 3, 150, std::wstring( L"string" ) );
+
+	Excel::Formula formula;
+	formula.setString( L"formula" );
+	sheet.setCell( 3, 160, formula );
+
+	REQUIRE( sheet.rowsCount() == 4 );
+	REQUIRE( sheet.columnsCount() == 202 );
+
+	for( size_t column = 0; column < 202; ++column )
+	{
+		if( column == 51 )
+		{
+			REQUIRE( sheet.value( 3, column ).dataType() == Excel::Cell::DataType::String );
+			REQUIRE( &sheet.value( 3, column ).getString() == &shared );
+			REQUIRE( sheet.cell( 3, column ).getString() == shared );
+		}
+		else if( column == 150 )
+			REQUIRE( sheet.cell( 3, column ).getString() == L"string" );
+		else if( column == 160 )
+			REQUIRE( sheet.cell( 3, column ).getFormula().getString() == L"formula" );
+		else if( std::find( std::begin( columns ), std::end( columns ), column ) !=
+			std::end( columns ) )
+		{
+			REQUIRE( sheet.value( 3, column ).getDouble() == static_cast< double > ( column ) );
+			REQUIRE( sheet.cell( 3, column ).getDouble() == static_cast< double > ( column ) );
+		}
+		else
+		{
+			REQUIRE( sheet.value( 3, column ).isNull() );
+			REQUIRE( sheet.cell( 3, column ).isNull() );
+		}
+
+		REQUIRE( sheet.cell( 2, column ).isNull() );
+	}
+
+	sheet.setCell( 3, 10, 20.0 );
+
+	REQUIRE( sheet.cell( 3, 10 ).getDouble() == 20.0 );
+	REQUIRE( sheet.value( 3, 10 ).getDouble() == 20.0 );
+
+	// References returned by cell() stay valid for the ring of cells.
+	std::vector< const Excel::Cell * > cells;
+
+	for( size_t column = 0; column < Excel::c_compactCellsCount; ++column )
+		sheet.setCell( 4, column, static_cast< double > ( column ) );
+
+	for( size_t column = 0; column < Excel::c_compactCellsCount; ++column )
+		cells.push_back( &sheet.cell( 4, column ) );
+
+	for( size_t column = 0; column < Excel::c_compactCellsCount; ++column )
+		REQUIRE( cells[ column ]->getDouble() == static_cast< double > ( column ) );
+
+	// Copy has its own strings and formulas, moved sheet keeps them.
+	Excel::Sheet copy( sheet );
+	sheet = Excel::Sheet( L"Empty", Excel::Sheet::StorageMode::Compact );
+
+	REQUIRE( sheet.rowsCount() == 0 );
+	REQUIRE( copy.sheetName() == L"Sheet" );
+	REQUIRE( &copy.value( 3, 51 ).getString() == &shared );
+	REQUIRE( copy.value( 3, 150 ).getString() == L"string" );
+	REQUIRE( copy.value( 3, 160 ).getFormula().getString() == L"formula" );
+
+	Excel::Sheet moved( std::move( copy ) );
+
+	REQUIRE( moved.value( 3, 150 ).getString() == L"string" );
+	REQUIRE( moved.cell( 3, 160 ).getFormula().getString() == L"formula" );
+	REQUIRE( moved.cell( 3, 10 ).getDouble() == 20.0 );
+}
@@ -0,0 +1,243 @@
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// Excel include.
+#include <read-excel/compoundfile/compoundfile.hpp>
+#include <read-excel/book.hpp>
+
+// C++ include.
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// unit test helper.
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <test/doctest/doctest.h>
+
+using namespace std::chrono;
+
+
+//
+// putInt32
+//
+
+static void
+putInt32( std::string & data, size_t offset, int32_t value )
+{
+	for( size_t i = 0; i < 4; ++i )
+		data[ offset + i ] = static_cast< char > ( ( value >> ( 8 * i ) ) & 0xFF );
+}
+
+
+//
+// putDirEntry
+//
+
+static void
+putDirEntry( std::string & data, size_t offset, const std::wstring & name,
+	char type, int32_t child, int32_t secID, int32_t size )
+{
+	for( size_t i = 0; i < name.size(); ++i )
+	{
+		data[ offset + i * 2 ] = static_cast< char > ( name[ i ] & 0xFF );
+		data[ offset + i * 2 + 1 ] = static_cast< char > ( ( name[ i ] >> 8 ) & 0xFF );
+	}
+
+	data[ offset + 64 ] = static_cast< char > ( ( name.size() + 1 ) * 2 );
+	data[ offset + 66 ] = type;
+	putInt32( data, offset + 68, -1 );
+	putInt32( data, offset + 72, -1 );
+	putInt32( data, offset + 76, child );
+	putInt32( data, offset + 116, secID );
+	putInt32( data, offset + 120, size );
+}
+
+
+//
+// makeCompoundFile
+//
+
+/*!
+	Make compound file with one "Workbook" stream of \a dataSectors sectors.
+	Only the header, the directory, SAT and MSAT sectors are written,
+	the data of the stream is not needed to open the file.
+*/
+static std::string
+makeCompoundFile( int32_t dataSectors )
+{
+	const int32_t sectorSize = 512;
+	const int32_t idsInSector = sectorSize / 4;
+
+	int32_t satSectors = 1;
+	int32_t msatSectors = 0;
+
+	while( true )
+	{
+		msatSectors = ( satSectors > 109 ?
+			( satSectors - 109 + idsInSector - 2 ) / ( idsInSector - 1 ) : 0 );
+
+		const int32_t total = 1 + satSectors + msatSectors + dataSectors;
+		const int32_t needed = ( total + idsInSector - 1 ) / idsInSector;
+
+		if( needed <= satSectors )
+			break;
+
+		satSectors = needed;
+	}
+
+	const int32_t firstSAT = 1;
+	const int32_t firstMSAT = firstSAT + satSectors;
+	const int32_t firstData = firstMSAT + msatSectors;
+
+	std::string data( static_cast< size_t > ( 1 + firstData ) * sectorSize, '\0' );
+
+	// Header.
+	const unsigned char id[] = { 0xD0, 0xCF, 0x11, 0xE0, 0xA1, 0xB1, 0x1A, 0xE1 };
+	std::memcpy( &data[ 0 ], id, sizeof( id ) );
+	data[ 24 ] = 0x3E;
+	data[ 26 ] = 0x03;
+	data[ 28 ] = static_cast< char > ( 0xFE );
+	data[ 29 ] = static_cast< char > ( 0xFF );
+	data[ 30 ] = 9;
+	data[ 32 ] = 6;
+	putInt32( data, 44, satSectors );
+	putInt32( data, 48, 0 );
+	putInt32( data, 56, 4096 );
+	putInt32( data, 60, CompoundFile::SecID::EndOfChain );
+	putInt32( data, 64, 0 );
+	putInt32( data, 68, msatSectors ? firstMSAT : CompoundFile::SecID::EndOfChain );
+	putInt32( data, 72, msatSectors );
+
+	std::vector< int32_t > msat;
+
+	for( int32_t i = 0; i < satSectors; ++i )
+		msat.push_back( firstSAT + i );
+
+	for( int32_t i = 0; i < 109; ++i )
+		putInt32( data, 76 + i * 4, i < satSectors ? msat[ i ] : CompoundFile::SecID::FreeSecID );
+
+	auto sectorOffset = [ & ]( int32_t id ) { return 512 + static_cast< size_t > ( id ) * sectorSize; };
+
+	// MSAT sectors.
+	for( int32_t i = 0; i < msatSectors; ++i )
+	{
+		const size_t offset = sectorOffset( firstMSAT + i );
+
+		for( int32_t j = 0; j < idsInSector - 1; ++j )
+		{
+			const size_t idx = 109 + static_cast< size_t > ( i ) * ( idsInSector - 1 ) + j;
+
+			putInt32( data, offset + j * 4, idx < msat.size() ? msat[ idx ] :
+				CompoundFile::SecID::FreeSecID );
+		}
+
+		putInt32( data, offset + ( idsInSector - 1 ) * 4, i + 1 < msatSectors ?
+			firstMSAT + i + 1 : CompoundFile::SecID::EndOfChain );
+	}
+
+	// SAT sectors.
+	const int32_t total = satSectors * idsInSector;
+
+	for( int32_t id = 0; id < total; ++id )
+	{
+		int32_t value = CompoundFile::SecID::FreeSecID;
+
+		if( id == 0 )
+			value = CompoundFile::SecID::EndOfChain;
+		else if( id < firstMSAT )
+			value = CompoundFile::SecID::SATSecID;
+		else if( id < firstData )
+			value = CompoundFile::SecID::MSATSecID;
+		else if( id < firstData + dataSectors )
+			value = ( id + 1 < firstData + dataSectors ? id + 1 :
+				CompoundFile::SecID::EndOfChain );
+
+		putInt32( data, sectorOffset( firstSAT + id / idsInSector ) +
+			( id % idsInSector ) * 4, value );
+	}
+
+	// Directory.
+	putDirEntry( data, sectorOffset( 0 ), L"Root Entry", 0x05, 1,
+		CompoundFile::SecID::EndOfChain, 0 );
+	putDirEntry( data, sectorOffset( 0 ) + 128, L"Workbook", 0x02, -1,
+		firstData, dataSectors * sectorSize );
+
+	return data;
+}
+
+
+TEST_CASE( "test_open_latency" )
+{
+	// ~1 GB of the workbook stream, ~2M entries in SAT.
+	const int32_t dataSectors = 2 * 1024 * 1024 - 8192;
+	const char * fileName = "synthetic.cfb";
+	const int iterations = 20;
+
+	{
+		const std::string data = makeCompoundFile( dataSectors );
+
+		std::ofstream out( fileName, std::ios::out | std::ios::binary );
+		out.write( data.data(), data.size() );
+	}
+
+	{
+		const auto start = high_resolution_clock::now();
+
+		for( int i = 0; i < iterations; ++i )
+		{
+			CompoundFile::File file( fileName );
+
+			REQUIRE( file.directory( L"Workbook" ).streamSize() == dataSectors * 512 );
+		}
+
+		const auto duration = duration_cast< microseconds > (
+			high_resolution_clock::now() - start );
+
+		std::cout << "Open of the synthetic 1 GB file (memory mapped) takes "
+			<< duration.count() / iterations << " us." << std::endl;
+	}
+
+	{
+		const auto start = high_resolution_clock::now();
+
+		for( int i = 0; i < iterations; ++i )
+		{
+			std::ifstream stream( fileName, std::ios::in | std::ios::binary );
+			CompoundFile::File file( stream );
+
+			REQUIRE( file.directory( L"Workbook" ).streamSize() == dataSectors * 512 );
+		}
+
+		const auto duration = duration_cast< microseconds > (
+			high_resolution_clock::now() - start );
+
+		std::cout << "Open of the synthetic 1 GB file (std::ifstream) takes "
+			<< duration.count() / iterations << " us." << std::endl;
+	}
+
+	std::remove( fileName );
+
+	{
+		const auto start = high_resolution_clock::now();
+
+		for( int i = 0; i < iterations; ++i )
+		{
+			CompoundFile::File file( "test/data/big.xls" );
+
+			REQUIRE( file.hasDirectory( L"Workbook" ) );
+		}
+
+		const auto duration = duration_cast< microseconds > (
+			high_resolution_clock::now() - start );
+
+		std::cout << "Open of the big.xls takes "
+			<< duration.count() / iterations << " us." << std::endl;
+	}
+}
@@ -1,141 +1,472 @@
-
-/*
-	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
-	SPDX-License-Identifier: MIT
-*/
-
-// Excel include.
-#include <read-excel/compoundfile/compoundfile.hpp>
-#include <read-excel/compoundfile/compoundfile_exceptions.hpp>
-
-// unit test helper.
-#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
-#include <test/doctest/doctest.h>
-
-
-//
-// test_directory
-//
-
-TEST_CASE( "test_directory" )
-{
-	CompoundFile::File file( "./test/data/test.xls" );
-
-	{
-		CompoundFile::Directory dir = file.directory( L"Workbook" );
-
-		REQUIRE( dir.name() == L"Workbook" );
-		REQUIRE( dir.type() == CompoundFile::Directory::UserStream );
-		REQUIRE( dir.streamSecID() == 0x02 );
-		REQUIRE( dir.streamSize() == 0x3480 );
-		REQUIRE( dir.rightChild() == 0xFFFFFFFF );
-		REQUIRE( dir.leftChild() == 0x04 );
-		REQUIRE( dir.rootNode() == 0xFFFFFFFF );
-	}
-
-	{
-		const wchar_t data[] = {
-			0x01, 0x43, 0x6F, 0x6D, 0x70, 0x4F, 0x62, 0x6A, 0x00
-		};
-
-		CompoundFile::Directory dir = file.directory( data );
-
-		REQUIRE( dir.name() == data );
-		REQUIRE( dir.type() == CompoundFile::Directory::UserStream );
-		REQUIRE( dir.streamSecID() == 0x08 );
-		REQUIRE( dir.streamSize() == 0x6D );
-		REQUIRE( dir.rightChild() == 0xFFFFFFFF );
-		REQUIRE( dir.leftChild() == 0xFFFFFFFF );
-		REQUIRE( dir.rootNode() == 0xFFFFFFFF );
-	}
-
-	{
-		const wchar_t data[] = {
-			0x05, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E,
-			0x74, 0x53, 0x75, 0x6D, 0x6D, 0x61, 0x72, 0x79,
-			0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74,
-			0x69, 0x6F, 0x6E, 0x00
-		};
-
-		CompoundFile::Directory dir = file.directory( data );
-
-		REQUIRE( dir.name() == data );
-		REQUIRE( dir.type() == CompoundFile::Directory::UserStream );
-		REQUIRE( dir.streamSecID() == 0x04 );
-		REQUIRE( dir.streamSize() == 0xEC );
-		REQUIRE( dir.rightChild() == 0xFFFFFFFF );
-		REQUIRE( dir.leftChild() == 0xFFFFFFFF );
-		REQUIRE( dir.rootNode() == 0xFFFFFFFF );
-	}
-
-	{
-		const wchar_t data[] = {
-			0x05, 0x53, 0x75, 0x6D, 0x6D, 0x61, 0x72, 0x79,
-			0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74,
-			0x69, 0x6F, 0x6E, 0x00
-		};
-
-		CompoundFile::Directory dir = file.directory( data );
-
-		REQUIRE( dir.name() == data );
-		REQUIRE( dir.type() == CompoundFile::Directory::UserStream );
-		REQUIRE( dir.streamSecID() == 0x00 );
-		REQUIRE( dir.streamSize() == 0xE0 );
-		REQUIRE( dir.rightChild() == 0x03 );
-		REQUIRE( dir.leftChild() == 0x01 );
-		REQUIRE( dir.rootNode() == 0xFFFFFFFF );
-	}
-
-	REQUIRE_THROWS_AS( file.directory( L"ThereIsNoSuchDir" ),
-		CompoundFile::Exception );
-}
-
-
-//
-// test_stream
-//
-
-TEST_CASE( "test_stream" )
-{
-	CompoundFile::File file( "./test/data/test.xls" );
-
-	std::unique_ptr< Excel::Stream > stream( file.stream(
-		file.directory( L"Workbook" ) ) );
-
-	stream->seek( 512, Excel::Stream::FromBeginning );
-
-	REQUIRE( stream->getByte() == (char) 0x01 );
-	REQUIRE( stream->getByte() == (char) 0x00 );
-	REQUIRE( stream->getByte() == (char) 0x3F );
-	REQUIRE( stream->getByte() == (char) 0x00 );
-
-	stream->seek( -6, Excel::Stream::FromCurrent );
-
-	REQUIRE( stream->getByte() == (char) 0xDC );
-	REQUIRE( stream->getByte() == (char) 0x00 );
-
-	stream->seek( 128, Excel::Stream::FromEnd );
-
-	REQUIRE( stream->getByte() == (char) 0x66 );
-	REQUIRE( stream->getByte() == (char) 0x0A );
-	REQUIRE( stream->getByte() == (char) 0x40 );
-	REQUIRE( stream->getByte() == (char) 0x08 );
-}
-
-
-//
-// test_stream
-//
-
-TEST_CASE( "test_stream_name" )
-{
-	std::ifstream fileStream( "./test/data/test.xls", std::ios::in | std::ios::binary );
-	CompoundFile::File file( fileStream );
-
-	std::unique_ptr< Excel::Stream > stream( file.stream(
-		file.directory( L"Workbook" ) ) );
-
-	stream->seek( 512, Excel::Stream::FromBeginning );
-
-	REQUIRE( stream->getByte() == (char) 0x01 );
-}
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// Excel include.
+#include <read-excel/compoundfile/compoundfile.hpp>
+#include <read-excel/compoundfile/compoundfile_exceptions.hpp>
+
+// unit test helper.
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <test/doctest/doctest.h>
+
+// C++ include.
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <iterator>
+
+
+//
+// test_directory
+//
+
+TEST_CASE( "test_directory" )
+{
+	CompoundFile::File file( "./test/data/test.xls" );
+
+	{
+		CompoundFile::Directory dir = file.directory( L"Workbook" );
+
+		REQUIRE( dir.name() == L"Workbook" );
+		REQUIRE( dir.type() == CompoundFile::Directory::UserStream );
+		REQUIRE( dir.streamSecID() == 0x02 );
+		REQUIRE( dir.streamSize() == 0x3480 );
+		REQUIRE( dir.rightChild() == 0xFFFFFFFF );
+		REQUIRE( dir.leftChild() == 0x04 );
+		REQUIRE( dir.rootNode() == 0xFFFFFFFF );
+	}
+
+	{
+		const wchar_t data[] = {
+			0x01, 0x43, 0x6F, 0x6D, 0x70, 0x4F, 0x62, 0x6A, 0x00
+		};
+
+		CompoundFile::Directory dir = file.directory( data );
+
+		REQUIRE( dir.name() == data );
+		REQUIRE( dir.type() == CompoundFile::Directory::UserStream );
+		REQUIRE( dir.streamSecID() == 0x08 );
+		REQUIRE( dir.streamSize() == 0x6D );
+		REQUIRE( dir.rightChild() == 0xFFFFFFFF );
+		REQUIRE( dir.leftChild() == 0xFFFFFFFF );
+		REQUIRE( dir.rootNode() == 0xFFFFFFFF );
+	}
+
+	{
+		const wchar_t data[] = {
+			0x05, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E,
+			0x74, 0x53, 0x75, 0x6D, 0x6D, 0x61, 0x72, 0x79,
+			0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74,
+			0x69, 0x6F, 0x6E, 0x00
+		};
+
+		CompoundFile::Directory dir = file.directory( data );
+
+		REQUIRE( dir.name() == data );
+		REQUIRE( dir.type() == CompoundFile::Directory::UserStream );
+		REQUIRE( dir.streamSecID() == 0x04 );
+		REQUIRE( dir.streamSize() == 0xEC );
+		REQUIRE( dir.rightChild() == 0xFFFFFFFF );
+		REQUIRE( dir.leftChild() == 0xFFFFFFFF );
+		REQUIRE( dir.rootNode() == 0xFFFFFFFF );
+	}
+
+	{
+		const wchar_t data[] = {
+			0x05, 0x53, 0x75, 0x6D, 0x6D, 0x61, 0x72, 0x79,
+			0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74,
+			0x69, 0x6F, 0x6E, 0x00
+		};
+
+		CompoundFile::Directory dir = file.directory( data );
+
+		REQUIRE( dir.name() == data );
+		REQUIRE( dir.type() == CompoundFile::Directory::UserStream );
+		REQUIRE( dir.streamSecID() == 0x00 );
+		REQUIRE( dir.streamSize() == 0xE0 );
+		REQUIRE( dir.rightChild() == 0x03 );
+		REQUIRE( dir.leftChild() == 0x01 );
+		REQUIRE( dir.rootNode() == 0xFFFFFFFF );
+	}
+
+	REQUIRE_THROWS_AS( file.directory( L"ThereIsNoSuchDir" ),
+		CompoundFile::Exception );
+}
+
+
+//
+// test_directory_names
+//
+
+TEST_CASE( "test_directory_names" )
+{
+	CompoundFile::File file( "./test/data/test.xls" );
+
+	const std::vector< std::wstring > names = file.directoryNames();
+
+	REQUIRE( names.size() == 4 );
+	REQUIRE( std::find( names.cbegin(), names.cend(), L"Workbook" ) != names.cend() );
+
+	for( const auto & name : names )
+	{
+		const CompoundFile::Directory * dir = file.findDirectory( name );
+
+		REQUIRE( dir != nullptr );
+		REQUIRE( dir->name() == name );
+		REQUIRE( file.hasDirectory( name ) );
+	}
+
+	REQUIRE( file.findDirectory( L"ThereIsNoSuchDir" ) == nullptr );
+	REQUIRE( !file.hasDirectory( L"ThereIsNoSuchDir" ) );
+
+	std::unique_ptr< Excel::Stream > byName( file.stream( L"Workbook" ) );
+	std::unique_ptr< Excel::Stream > byDir( file.stream( file.directory( L"Workbook" ) ) );
+
+	while( !byDir->eof() )
+	{
+		const char c = byDir->getByte();
+
+		if( byDir->eof() )
+			break;
+
+		REQUIRE( byName->getByte() == c );
+	}
+
+	REQUIRE_THROWS_AS( file.stream( L"ThereIsNoSuchDir" ),
+		CompoundFile::Exception );
+}
+
+
+//
+// test_corrupted_directory_tree
+//
+
+TEST_CASE( "test_corrupted_directory_tree" )
+{
+	std::ifstream in( "./test/data/test.xls", std::ios::in | std::ios::binary );
+	const std::string data( ( std::istreambuf_iterator< char > ( in ) ),
+		std::istreambuf_iterator< char > () );
+
+	// Left child of the "Workbook" entry (DirID 1 in the directory at SecID 1).
+	const size_t leftChildOffset = 512 + 512 + 128 + 68;
+
+	auto withLeftChild = [ & ]( int32_t dirID )
+	{
+		std::string corrupted = data;
+
+		for( size_t i = 0; i < 4; ++i )
+			corrupted[ leftChildOffset + i ] =
+				static_cast< char > ( ( dirID >> ( 8 * i ) ) & 0xFF );
+
+		return corrupted;
+	};
+
+	{
+		std::istringstream stream( withLeftChild( 4 ) );
+
+		REQUIRE_NOTHROW( CompoundFile::File( stream, "corrupted.xls" ) );
+	}
+
+	{
+		std::istringstream stream( withLeftChild( 2 ) );
+
+		REQUIRE_THROWS_AS( CompoundFile::File( stream, "corrupted.xls" ), CompoundFile::Exception );
+	}
+
+	{
+		std::istringstream stream( withLeftChild( 100000 ) );
+
+		REQUIRE_THROWS_AS( CompoundFile::File( stream, "corrupted.xls" ), CompoundFile::Exception );
+	}
+
+	{
+		std::istringstream stream( withLeftChild( -5 ) );
+
+		REQUIRE_THROWS_AS( CompoundFile::File( stream, "corrupted.xls" ), CompoundFile::Exception );
+	}
+}
+
+
+//
+// test_sat_chains
+//
+
+TEST_CASE( "test_sat_chains" )
+{
+	using CompoundFile::SecID;
+
+	{
+		const CompoundFile::SAT sat( { 1, 2, SecID::EndOfChain, SecID::FreeSecID } );
+
+		const std::vector< SecID > chain = sat.sectors( 0 );
+
+		REQUIRE( chain.size() == 3 );
+		REQUIRE( chain[ 0 ] == 0 );
+		REQUIRE( chain[ 1 ] == 1 );
+		REQUIRE( chain[ 2 ] == 2 );
+
+		REQUIRE( sat.sectors( 2 ).size() == 1 );
+
+		REQUIRE_THROWS_AS( sat.sectors( 4 ), CompoundFile::Exception );
+		REQUIRE_THROWS_AS( sat.sectors( SecID::EndOfChain ), CompoundFile::Exception );
+
+		CompoundFile::ChainsCache cache( sat );
+
+		const std::vector< SecID > & cached = cache.sectors( 0 );
+
+		REQUIRE( cached.size() == 3 );
+		REQUIRE( &cache.sectors( 1 ) != &cached );
+		REQUIRE( &cache.sectors( 0 ) == &cached );
+	}
+
+	{
+		const CompoundFile::SAT sat( { 1, 2, 0 } );
+
+		REQUIRE_THROWS_AS( sat.sectors( 0 ), CompoundFile::Exception );
+		REQUIRE_THROWS_AS( sat.sectors( 2 ), CompoundFile::Exception );
+	}
+
+	{
+		const CompoundFile::SAT sat( { 1, 1 } );
+
+		REQUIRE_THROWS_AS( sat.sectors( 0 ), CompoundFile::Exception );
+	}
+
+	{
+		const CompoundFile::SAT sat( { 1, 100 } );
+
+		REQUIRE_THROWS_AS( sat.sectors( 0 ), CompoundFile::Exception );
+	}
+}
+
+
+//
+// test_stream
+//
+
+TEST_CASE( "test_stream" )
+{
+	CompoundFile::File file( "./test/data/test.xls" );
+
+	std::unique_ptr< Excel::Stream > stream( file.stream(
+		file.directory( L"Workbook" ) ) );
+
+	stream->seek( 512, Excel::Stream::FromBeginning );
+
+	REQUIRE( stream->getByte() == (char) 0x01 );
+	REQUIRE( stream->getByte() == (char) 0x00 );
+	REQUIRE( stream->getByte() == (char) 0x3F );
+	REQUIRE( stream->getByte() == (char) 0x00 );
+
+	stream->seek( -6, Excel::Stream::FromCurrent );
+
+	REQUIRE( stream->getByte() == (char) 0xDC );
+	REQUIRE( stream->getByte() == (char) 0x00 );
+
+	stream->seek( 128, Excel::Stream::FromEnd );
+
+	REQUIRE( stream->getByte() == (char) 0x66 );
+	REQUIRE( stream->getByte() == (char) 0x0A );
+	REQUIRE( stream->getByte() == (char) 0x40 );
+	REQUIRE( stream->getByte() == (char) 0x08 );
+}
+
+
+//
+// test_stream
+//
+
+TEST_CASE( "test_stream_name" )
+{
+	std::ifstream fileStream( "./test/data/test.xls", std::ios::in | std::ios::binary );
+	CompoundFile::File file( fileStream );
+
+	std::unique_ptr< Excel::Stream > stream( file.stream(
+		file.directory( L"Workbook" ) ) );
+
+	stream->seek( 512, Excel::Stream::FromBeginning );
+
+	REQUIRE( stream->getByte() == (char) 0x01 );
+}
+
+
+//
+// test_mapped_file
+//
+
+TEST_CASE( "test_mapped_file" )
+{
+	CompoundFile::File mapped( "./test/data/big.xls" );
+
+	std::ifstream fileStream( "./test/data/big.xls", std::ios::in | std::ios::binary );
+	CompoundFile::File file( fileStream );
+
+	REQUIRE( mapped.isMapped() );
+	REQUIRE( !file.isMapped() );
+
+	std::unique_ptr< Excel::Stream > mappedStream( mapped.stream(
+		mapped.directory( L"Workbook" ) ) );
+	std::unique_ptr< Excel::Stream > stream( file.stream(
+		file.directory( L"Workbook" ) ) );
+
+	while( true )
+	{
+		const char ch = stream->getByte();
+
+		REQUIRE( mappedStream->getByte() == ch );
+		REQUIRE( mappedStream->eof() == stream->eof() );
+
+		if( stream->eof() )
+			break;
+	}
+
+	mappedStream->seek( 1000, Excel::Stream::FromBeginning );
+	stream->seek( 1000, Excel::Stream::FromBeginning );
+
+	REQUIRE( mappedStream->getByte() == stream->getByte() );
+	REQUIRE( mappedStream->pos() == stream->pos() );
+}
+
+
+//
+// test_stream_bulk_read
+//
+
+TEST_CASE( "test_stream_bulk_read" )
+{
+	CompoundFile::File file( "./test/data/big.xls" );
+
+	const CompoundFile::Directory dir = file.directory( L"Workbook" );
+
+	std::unique_ptr< Excel::Stream > byteStream( file.stream( dir ) );
+	std::unique_ptr< Excel::Stream > bulkStream( file.stream( dir ) );
+
+	std::vector< char > expected( dir.streamSize() );
+
+	for( auto & ch : expected )
+		ch = byteStream->getByte();
+
+	std::vector< char > data( dir.streamSize() );
+
+	const size_t chunk = 1000;
+
+	for( size_t i = 0; i < data.size(); i += chunk )
+		bulkStream->read( &data[ i ], std::min( chunk, data.size() - i ) );
+
+	REQUIRE( data == expected );
+
+	char ch = 0;
+
+	REQUIRE_THROWS_AS( bulkStream->read( &ch, 1 ), Excel::Exception );
+	REQUIRE( bulkStream->eof() );
+
+	bulkStream->seek( 3, Excel::Stream::FromBeginning );
+
+	uint32_t value = 0;
+	bulkStream->read( value, 4 );
+
+	REQUIRE( value == ( (uint32_t) (unsigned char) expected[ 3 ] |
+		( (uint32_t) (unsigned char) expected[ 4 ] << 8 ) |
+		( (uint32_t) (unsigned char) expected[ 5 ] << 16 ) |
+		( (uint32_t) (unsigned char) expected[ 6 ] << 24 ) ) );
+}
+
+
+//
+// test_stream_seek_over_runs
+//
+
+TEST_CASE( "test_stream_seek_over_runs" )
+{
+	CompoundFile::File mapped( "./test/data/big.xls" );
+
+	std::ifstream fileStream( "./test/data/big.xls", std::ios::in | std::ios::binary );
+	CompoundFile::File file( fileStream );
+
+	const CompoundFile::Directory dir = file.directory( L"Workbook" );
+
+	std::unique_ptr< Excel::Stream > mappedStream( mapped.stream( dir ) );
+	std::unique_ptr< Excel::Stream > stream( file.stream( dir ) );
+
+	const int32_t positions[] = { 0, 511, 512, 1000, 300000, 4095, 100, 130000,
+		dir.streamSize() - 700, 7, 513 * 64 };
+
+	for( const auto pos : positions )
+	{
+		mappedStream->seek( pos, Excel::Stream::FromBeginning );
+		stream->seek( pos, Excel::Stream::FromBeginning );
+
+		REQUIRE( mappedStream->pos() == pos );
+		REQUIRE( stream->pos() == pos );
+
+		std::vector< char > mappedData( 600 );
+		std::vector< char > data( 600 );
+
+		mappedStream->read( &mappedData[ 0 ], mappedData.size() );
+		stream->read( &data[ 0 ], data.size() );
+
+		REQUIRE( mappedData == data );
+		REQUIRE( stream->pos() == pos + 600 );
+
+		stream->seek( -300, Excel::Stream::FromCurrent );
+
+		REQUIRE( stream->getByte() == data[ 300 ] );
+	}
+}
+
+
+//
+// test_short_stream
+//
+
+TEST_CASE( "test_short_stream" )
+{
+	const wchar_t name[] = {
+		0x05, 0x53, 0x75, 0x6D, 0x6D, 0x61, 0x72, 0x79,
+		0x49, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74,
+		0x69, 0x6F, 0x6E, 0x00
+	};
+
+	CompoundFile::File mapped( "./test/data/test.xls" );
+
+	std::ifstream fileStream( "./test/data/test.xls", std::ios::in | std::ios::binary );
+	CompoundFile::File file( fileStream );
+
+	const CompoundFile::Directory dir = file.directory( name );
+
+	REQUIRE( dir.streamSize() == 0xE0 );
+
+	std::unique_ptr< Excel::Stream > mappedStream( mapped.stream( dir ) );
+	std::unique_ptr< Excel::Stream > stream( file.stream( dir ) );
+
+	std::vector< char > mappedData( dir.streamSize() );
+	std::vector< char > data( dir.streamSize() );
+
+	mappedStream->read( &mappedData[ 0 ], mappedData.size() );
+	stream->read( &data[ 0 ], data.size() );
+
+	REQUIRE( mappedData == data );
+
+	// Byte order mark of the property set stream.
+	REQUIRE( data[ 0 ] == (char) 0xFE );
+	REQUIRE( data[ 1 ] == (char) 0xFF );
+
+	REQUIRE( !stream->eof() );
+	stream->getByte();
+	REQUIRE( stream->eof() );
+
+	stream->seek( 65, Excel::Stream::FromBeginning );
+
+	REQUIRE( stream->pos() == 65 );
+	REQUIRE( stream->getByte() == data[ 65 ] );
+
+	stream->seek( 0, Excel::Stream::FromBeginning );
+
+	const char * inPlace = stream->readInPlace( 64 );
+
+	REQUIRE( inPlace != nullptr );
+	REQUIRE( std::equal( inPlace, inPlace + 64, data.begin() ) );
+}
@@ -1,150 +1,452 @@
-
-/*
-	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
-	SPDX-License-Identifier: MIT
-*/
-
-// Excel include.
-#include <read-excel/record.hpp>
-
-// unit test helper.
-#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
-#include <test/doctest/doctest.h>
-#include <test/stream/stream.hpp>
-#include <test/helper/helper.hpp>
-
-
-const auto data = make_data(
-	0xFCu, 0x00u, 0x13u, 0x00u,
-	0x03u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u,
-	0x10u, 0x00u, 0x00u,
-	0x53u, 0x54u, 0x53u, 0x54u, 0x53u, 0x54u, 0x53u, 0x54u,
-
-	0x3Cu, 0x00u, 0x11u, 0x00u,
-	0x01u,
-	0x53u, 0x00u, 0x54u, 0x00u, 0x53u, 0x00u, 0x54u, 0x00u,
-	0x53u, 0x00u, 0x54u, 0x00u, 0x53u, 0x00u, 0x54u, 0x00u,
-
-	0x3Cu, 0x00u, 0x13u, 0x00u,
-	0x10u, 0x00u, 0x00u,
-	0x51u, 0x52u, 0x51u, 0x52u, 0x51u, 0x52u, 0x51u, 0x52u,
-	0x51u, 0x52u, 0x51u, 0x52u, 0x51u, 0x52u, 0x51u, 0x52u,
-
-	0x3Cu, 0x00u, 0x23u, 0x00u,
-	0x10u, 0x00u, 0x01u,
-	0x51u, 0x00u, 0x52u, 0x00u, 0x51u, 0x00u, 0x52u, 0x00u,
-	0x51u, 0x00u, 0x52u, 0x00u, 0x51u, 0x00u, 0x52u, 0x00u,
-	0x51u, 0x00u, 0x52u, 0x00u, 0x51u, 0x00u, 0x52u, 0x00u,
-	0x51u, 0x00u, 0x52u, 0x00u, 0x51u, 0x00u, 0x52u, 0x00u
-);
-
-
-TEST_CASE( "test_record" )
-{
-	TestStream teststream( &data[ 0 ], 106 );
-
-	Excel::Record record( teststream );
-
-	REQUIRE( record.code() == 0xFC );
-	REQUIRE( record.length() == 0x5A );
-
-	const std::vector< int32_t > & borders = record.borders();
-
-	REQUIRE( borders[ 0 ] == 0x13 );
-	REQUIRE( borders[ 1 ] == 0x24 );
-	REQUIRE( borders[ 2 ] == 0x37 );
-	REQUIRE( borders.size() == 3 );
-
-	Excel::Stream & stream = record.dataStream();
-
-	REQUIRE( stream.getByte() == (char) 0x03u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x03u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x10u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x53u );
-	REQUIRE( stream.getByte() == (char) 0x54u );
-	REQUIRE( stream.getByte() == (char) 0x53u );
-	REQUIRE( stream.getByte() == (char) 0x54u );
-	REQUIRE( stream.getByte() == (char) 0x53u );
-	REQUIRE( stream.getByte() == (char) 0x54u );
-	REQUIRE( stream.getByte() == (char) 0x53u );
-	REQUIRE( stream.getByte() == (char) 0x54u );
-	REQUIRE( stream.getByte() == (char) 0x01u );
-	REQUIRE( stream.getByte() == (char) 0x53u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x54u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x53u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x54u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x53u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x54u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x53u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x54u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x10u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x51u );
-	REQUIRE( stream.getByte() == (char) 0x52u );
-	REQUIRE( stream.getByte() == (char) 0x51u );
-	REQUIRE( stream.getByte() == (char) 0x52u );
-	REQUIRE( stream.getByte() == (char) 0x51u );
-	REQUIRE( stream.getByte() == (char) 0x52u );
-	REQUIRE( stream.getByte() == (char) 0x51u );
-	REQUIRE( stream.getByte() == (char) 0x52u );
-	REQUIRE( stream.getByte() == (char) 0x51u );
-	REQUIRE( stream.getByte() == (char) 0x52u );
-	REQUIRE( stream.getByte() == (char) 0x51u );
-	REQUIRE( stream.getByte() == (char) 0x52u );
-	REQUIRE( stream.getByte() == (char) 0x51u );
-	REQUIRE( stream.getByte() == (char) 0x52u );
-	REQUIRE( stream.getByte() == (char) 0x51u );
-	REQUIRE( stream.getByte() == (char) 0x52u );
-	REQUIRE( stream.getByte() == (char) 0x10u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x01u );
-	REQUIRE( stream.getByte() == (char) 0x51u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x52u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x51u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x52u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x51u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x52u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x51u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x52u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x51u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x52u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x51u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x52u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x51u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x52u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x51u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-	REQUIRE( stream.getByte() == (char) 0x52u );
-	REQUIRE( stream.getByte() == (char) 0x00u );
-}
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// Excel include.
+#include <read-excel/record.hpp>
+#include <read-excel/parser.hpp>
+
+// unit test helper.
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <test/doctest/doctest.h>
+#include <test/stream/stream.hpp>
+#include <test/helper/helper.hpp>
+
+
+const auto data = make_data(
+	0xFCu, 0x00u, 0x13u, 0x00u,
+	0x03u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u,
+	0x10u, 0x00u, 0x00u,
+	0x53u, 0x54u, 0x53u, 0x54u, 0x53u, 0x54u, 0x53u, 0x54u,
+
+	0x3Cu, 0x00u, 0x11u, 0x00u,
+	0x01u,
+	0x53u, 0x00u, 0x54u, 0x00u, 0x53u, 0x00u, 0x54u, 0x00u,
+	0x53u, 0x00u, 0x54u, 0x00u, 0x53u, 0x00u, 0x54u, 0x00u,
+
+	0x3Cu, 0x00u, 0x13u, 0x00u,
+	0x10u, 0x00u, 0x00u,
+	0x51u, 0x52u, 0x51u, 0x52u, 0x51u, 0x52u, 0x51u, 0x52u,
+	0x51u, 0x52u, 0x51u, 0x52u, 0x51u, 0x52u, 0x51u, 0x52u,
+
+	0x3Cu, 0x00u, 0x23u, 0x00u,
+	0x10u, 0x00u, 0x01u,
+	0x51u, 0x00u, 0x52u, 0x00u, 0x51u, 0x00u, 0x52u, 0x00u,
+	0x51u, 0x00u, 0x52u, 0x00u, 0x51u, 0x00u, 0x52u, 0x00u,
+	0x51u, 0x00u, 0x52u, 0x00u, 0x51u, 0x00u, 0x52u, 0x00u,
+	0x51u, 0x00u, 0x52u, 0x00u, 0x51u, 0x00u, 0x52u, 0x00u
+);
+
+
+TEST_CASE( "test_record" )
+{
+	TestStream teststream( &data[ 0 ], 106 );
+
+	Excel::Record record( teststream );
+
+	REQUIRE( record.code() == 0xFC );
+	REQUIRE( record.length() == 0x5A );
+
+	const std::vector< int32_t > & borders = record.borders();
+
+	REQUIRE( borders[ 0 ] == 0x13 );
+	REQUIRE( borders[ 1 ] == 0x24 );
+	REQUIRE( borders[ 2 ] == 0x37 );
+	REQUIRE( borders.size() == 3 );
+
+	Excel::Stream & stream = record.dataStream();
+
+	REQUIRE( stream.getByte() == (char) 0x03u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x03u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x10u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x53u );
+	REQUIRE( stream.getByte() == (char) 0x54u );
+	REQUIRE( stream.getByte() == (char) 0x53u );
+	REQUIRE( stream.getByte() == (char) 0x54u );
+	REQUIRE( stream.getByte() == (char) 0x53u );
+	REQUIRE( stream.getByte() == (char) 0x54u );
+	REQUIRE( stream.getByte() == (char) 0x53u );
+	REQUIRE( stream.getByte() == (char) 0x54u );
+	REQUIRE( stream.getByte() == (char) 0x01u );
+	REQUIRE( stream.getByte() == (char) 0x53u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x54u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x53u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x54u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x53u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x54u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x53u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x54u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x10u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x51u );
+	REQUIRE( stream.getByte() == (char) 0x52u );
+	REQUIRE( stream.getByte() == (char) 0x51u );
+	REQUIRE( stream.getByte() == (char) 0x52u );
+	REQUIRE( stream.getByte() == (char) 0x51u );
+	REQUIRE( stream.getByte() == (char) 0x52u );
+	REQUIRE( stream.getByte() == (char) 0x51u );
+	REQUIRE( stream.getByte() == (char) 0x52u );
+	REQUIRE( stream.getByte() == (char) 0x51u );
+	REQUIRE( stream.getByte() == (char) 0x52u );
+	REQUIRE( stream.getByte() == (char) 0x51u );
+	REQUIRE( stream.getByte() == (char) 0x52u );
+	REQUIRE( stream.getByte() == (char) 0x51u );
+	REQUIRE( stream.getByte() == (char) 0x52u );
+	REQUIRE( stream.getByte() == (char) 0x51u );
+	REQUIRE( stream.getByte() == (char) 0x52u );
+	REQUIRE( stream.getByte() == (char) 0x10u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x01u );
+	REQUIRE( stream.getByte() == (char) 0x51u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x52u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x51u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x52u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x51u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x52u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x51u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x52u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x51u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x52u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x51u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x52u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x51u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x52u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x51u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+	REQUIRE( stream.getByte() == (char) 0x52u );
+	REQUIRE( stream.getByte() == (char) 0x00u );
+}
+
+
+const auto twoRecords = make_data(
+	0x7Eu, 0x02u, 0x04u, 0x00u,
+	0x01u, 0x02u, 0x03u, 0x04u,
+
+	0xFCu, 0x00u, 0x02u, 0x00u,
+	0x05u, 0x06u,
+
+	0x3Cu, 0x00u, 0x01u, 0x00u,
+	0x07u,
+
+	0x0Au, 0x00u, 0x00u, 0x00u
+);
+
+
+TEST_CASE( "test_record_with_buffer" )
+{
+	TestStream teststream( &twoRecords[ 0 ], 23 );
+
+	std::vector< char > buffer;
+
+	{
+		Excel::Record record( teststream, buffer );
+
+		REQUIRE( record.code() == 0x27E );
+		REQUIRE( record.length() == 4 );
+		REQUIRE( record.borders().empty() );
+
+		uint32_t value = 0;
+		record.dataStream().read( value, 4 );
+
+		REQUIRE( value == 0x04030201u );
+		REQUIRE( !record.dataStream().eof() );
+		REQUIRE_THROWS_AS( record.dataStream().read( value, 1 ), Excel::Exception );
+		REQUIRE( record.dataStream().eof() );
+	}
+
+	{
+		Excel::Record record( teststream, buffer );
+
+		REQUIRE( record.code() == 0xFC );
+		REQUIRE( record.length() == 3 );
+		REQUIRE( record.borders().size() == 1 );
+		REQUIRE( record.borders()[ 0 ] == 2 );
+
+		Excel::Stream & stream = record.dataStream();
+
+		REQUIRE( stream.getByte() == (char) 0x05u );
+		REQUIRE( stream.getByte() == (char) 0x06u );
+		REQUIRE( stream.getByte() == (char) 0x07u );
+
+		stream.seek( -2, Excel::Stream::FromEnd );
+
+		REQUIRE( stream.pos() == 1 );
+		REQUIRE( stream.getByte() == (char) 0x06u );
+	}
+
+	{
+		Excel::Record record( teststream, buffer );
+
+		REQUIRE( record.code() == 0x0A );
+		REQUIRE( record.length() == 0 );
+	}
+}
+
+TEST_CASE( "test_record_read_without_exceptions" )
+{
+	TestStream teststream( &twoRecords[ 0 ], 23 );
+
+	std::vector< char > buffer;
+	std::vector< uint16_t > codes;
+	std::vector< uint32_t > lengths;
+
+	Excel::Record record( teststream.byteOrder() );
+
+	while( record.read( teststream, buffer ) )
+	{
+		codes.push_back( record.code() );
+		lengths.push_back( record.length() );
+
+		if( record.code() == 0xFC )
+			REQUIRE( record.borders().size() == 1 );
+		else
+			REQUIRE( record.borders().empty() );
+	}
+
+	REQUIRE( codes == std::vector< uint16_t > { 0x27E, 0xFC, 0x0A } );
+	REQUIRE( lengths == std::vector< uint32_t > { 4, 3, 0 } );
+	REQUIRE( teststream.eof() );
+
+	// Read from the stream after its end.
+	REQUIRE( !record.read( teststream, buffer ) );
+	REQUIRE_THROWS_AS( Excel::Record( teststream, buffer ), Excel::Exception );
+}
+
+TEST_CASE( "test_truncated_record" )
+{
+	// Record's data is cut.
+	{
+		TestStream teststream( &twoRecords[ 0 ], 6 );
+
+		std::vector< char > buffer;
+		Excel::Record record( teststream.byteOrder() );
+
+		REQUIRE( !record.read( teststream, buffer ) );
+	}
+
+	// CONTINUE record is cut.
+	{
+		TestStream teststream( &twoRecords[ 8 ], 9 );
+
+		std::vector< char > buffer;
+		Excel::Record record( teststream.byteOrder() );
+
+		REQUIRE( !record.read( teststream, buffer ) );
+	}
+
+	// Header is cut.
+	{
+		TestStream teststream( &twoRecords[ 0 ], 3 );
+
+		std::vector< char > buffer;
+		Excel::Record record( teststream.byteOrder() );
+
+		REQUIRE( !record.read( teststream, buffer ) );
+	}
+
+	// Stream's read() still throws.
+	{
+		TestStream teststream( &twoRecords[ 0 ], 3 );
+
+		char data[ 4 ];
+
+		REQUIRE( !teststream.tryRead( data, 4 ) );
+		REQUIRE( teststream.eof() );
+		REQUIRE_THROWS_AS( teststream.read( data, 4 ), Excel::Exception );
+	}
+}
+
+TEST_CASE( "test_record_filter" )
+{
+	Excel::RecordFilter filter = { Excel::XL_RK2, Excel::XL_EOF };
+
+	REQUIRE( filter.contains( Excel::XL_RK2 ) );
+	REQUIRE( filter.contains( Excel::XL_EOF ) );
+	REQUIRE( !filter.contains( Excel::XL_SST ) );
+
+	filter.add( Excel::XL_SST );
+	filter.remove( Excel::XL_EOF );
+
+	REQUIRE( filter.contains( Excel::XL_SST ) );
+	REQUIRE( !filter.contains( Excel::XL_EOF ) );
+
+	filter &= Excel::RecordFilter{ Excel::XL_SST, Excel::XL_NUMBER };
+
+	REQUIRE( filter.contains( Excel::XL_SST ) );
+	REQUIRE( !filter.contains( Excel::XL_RK2 ) );
+	REQUIRE( !filter.contains( Excel::XL_NUMBER ) );
+
+	filter |= Excel::RecordFilter{ Excel::XL_UNKNOWN };
+
+	REQUIRE( filter.contains( Excel::XL_UNKNOWN ) );
+	REQUIRE( Excel::RecordFilter::all().contains( 0x1234 ) );
+	REQUIRE( !Excel::RecordFilter().contains( Excel::XL_EOF ) );
+}
+
+TEST_CASE( "test_record_skipped_by_filter" )
+{
+	TestStream teststream( &twoRecords[ 0 ], 23 );
+
+	std::vector< char > buffer;
+	const Excel::RecordFilter filter = { Excel::XL_RK2 };
+
+	Excel::Record record( teststream.byteOrder() );
+
+	REQUIRE( record.read( teststream, buffer, filter ) );
+	REQUIRE( record.code() == 0x27E );
+	REQUIRE( record.length() == 4 );
+
+	uint32_t value = 0;
+	record.dataStream().read( value, 4 );
+
+	REQUIRE( value == 0x04030201u );
+
+	// SST with CONTINUE is skipped as a whole.
+	REQUIRE( record.read( teststream, buffer, filter ) );
+	REQUIRE( record.code() == 0xFC );
+	REQUIRE( record.length() == 3 );
+	REQUIRE( record.borders().empty() );
+	REQUIRE( !record.dataStream().readInPlace( 1 ) );
+
+	REQUIRE( record.read( teststream, buffer, filter ) );
+	REQUIRE( record.code() == 0x0A );
+
+	REQUIRE( !record.read( teststream, buffer, filter ) );
+
+	// Skipped data is cut.
+	{
+		TestStream cut( &twoRecords[ 8 ], 9 );
+
+		REQUIRE( !record.read( cut, buffer, Excel::RecordFilter() ) );
+	}
+}
+
+//! Storage that keeps cells of MULRK records.
+struct MulRKStorage : public Excel::EmptyStorage {
+	std::vector< double > m_values;
+	size_t m_firstColumn = 0;
+
+	void onCells( size_t , size_t , size_t firstColumn, const double * values,
+		size_t count ) override
+	{
+		m_firstColumn = firstColumn;
+		m_values.assign( values, values + count );
+	}
+}; // struct MulRKStorage
+
+TEST_CASE( "test_truncated_mulrk" )
+{
+	// Row 1, columns 2 and 3 with RK numbers 1 and 2.
+	const auto mulRK = make_data(
+		0xBDu, 0x00u, 0x12u, 0x00u,
+		0x01u, 0x00u, 0x02u, 0x00u,
+		0x00u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u,
+		0x00u, 0x00u, 0x0Au, 0x00u, 0x00u, 0x00u,
+		0x03u, 0x00u
+	); // mulRK
+
+	{
+		TestStream teststream( &mulRK[ 0 ], 22 );
+		Excel::Record record( teststream );
+		MulRKStorage storage;
+
+		Excel::Parser::handleMULRK( record, 0, storage );
+
+		REQUIRE( storage.m_firstColumn == 2 );
+		REQUIRE( storage.m_values == std::vector< double > { 1.0, 2.0 } );
+	}
+
+	// The same record without the last column, its place is taken by the
+	// last bytes of the last RK number that look like column 3.
+	const auto truncated = make_data(
+		0xBDu, 0x00u, 0x10u, 0x00u,
+		0x01u, 0x00u, 0x02u, 0x00u,
+		0x00u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u,
+		0x00u, 0x00u, 0x0Au, 0x00u, 0x03u, 0x00u
+	); // truncated
+
+	{
+		TestStream teststream( &truncated[ 0 ], 20 );
+		Excel::Record record( teststream );
+		MulRKStorage storage;
+
+		REQUIRE_THROWS_AS( Excel::Parser::handleMULRK( record, 0, storage ), Excel::Exception );
+		REQUIRE( storage.m_values.empty() );
+	}
+}
+
+TEST_CASE( "test_inspect_sheet_wrong_format" )
+{
+	// BOF of the worksheet and the record with unknown code.
+	const auto sheet = make_data(
+		0x09u, 0x08u, 0x10u, 0x00u,
+		0x00u, 0x06u, 0x10u, 0x00u, 0xBBu, 0x0Du, 0xCCu, 0x07u,
+		0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+		0xFFu, 0xFFu, 0x00u, 0x00u,
+		0x0Au, 0x00u, 0x00u, 0x00u
+	); // sheet
+
+	const Excel::BoundSheet boundSheet( 0, Excel::BoundSheet::WorkSheet, L"Sheet1" );
+
+	{
+		TestStream teststream( &sheet[ 0 ], 28 );
+
+		REQUIRE_THROWS_AS( Excel::Parser::inspectSheet( boundSheet, teststream ),
+			Excel::Exception );
+	}
+
+	{
+		TestStream teststream( &sheet[ 0 ], 28 );
+		Excel::EmptyStorage storage;
+
+		REQUIRE_THROWS_AS( Excel::Parser::loadSheet( 0, boundSheet, teststream, storage ),
+			Excel::Exception );
+	}
+
+	// Without the unknown record the sheet has no dimension.
+	{
+		const auto withoutUnknown = make_data(
+			0x09u, 0x08u, 0x10u, 0x00u,
+			0x00u, 0x06u, 0x10u, 0x00u, 0xBBu, 0x0Du, 0xCCu, 0x07u,
+			0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+			0x0Au, 0x00u, 0x00u, 0x00u
+		); // withoutUnknown
+
+		TestStream stream( &withoutUnknown[ 0 ], 24 );
+
+		REQUIRE( !Excel::Parser::inspectSheet( boundSheet, stream ).isValid() );
+	}
+}
@@ -0,0 +1,80 @@
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// Excel include.
+#include <read-excel/rk.hpp>
+
+// C++ include.
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+// unit test helper.
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <test/doctest/doctest.h>
+
+using namespace std::chrono;
+
+
+//
+// measure
+//
+
+//! \return Throughput of \a decode in millions of RK numbers per second.
+template< typename Decode >
+static double
+measure( size_t count, int iterations, Decode decode )
+{
+	const auto start = high_resolution_clock::now();
+
+	for( int i = 0; i < iterations; ++i )
+		decode();
+
+	const auto duration = duration_cast< microseconds > (
+		high_resolution_clock::now() - start ).count();
+
+	return ( duration ? static_cast< double > ( count ) * iterations / duration : 0.0 );
+}
+
+
+TEST_CASE( "test_rk_throughput" )
+{
+	// MULRK records are decoded with chunks of 256 RK numbers.
+	const size_t chunk = 256;
+	const size_t count = chunk * 4096;
+	const int iterations = 50;
+
+	std::mt19937 generator( 42 );
+	std::uniform_int_distribution< uint32_t > random;
+
+	std::vector< char > data( count * 6 );
+
+	for( size_t i = 0; i < count; ++i )
+	{
+		const uint32_t rk = random( generator );
+		std::memcpy( &data[ i * 6 + 2 ], &rk, sizeof( rk ) );
+	}
+
+	std::vector< double > values( chunk );
+	std::vector< double > expected( chunk );
+
+	const double scalar = measure( count, iterations, [ & ] () {
+		for( size_t i = 0; i < count; i += chunk )
+			Excel::doublesFromRKsScalar( &data[ i * 6 ], chunk, true, expected.data() );
+	} );
+
+	const double vectorized = measure( count, iterations, [ & ] () {
+		for( size_t i = 0; i < count; i += chunk )
+			Excel::doublesFromRKs( &data[ i * 6 ], chunk, true, values.data() );
+	} );
+
+	REQUIRE( std::memcmp( values.data(), expected.data(), chunk * sizeof( double ) ) == 0 );
+
+	std::cout << "RK: scalar " << scalar << " M numbers/s, doublesFromRKs() "
+		<< vectorized << " M numbers/s." << std::endl;
+}
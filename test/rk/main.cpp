@@ -0,0 +1,120 @@
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// Excel include.
+#include <read-excel/rk.hpp>
+
+// C++ include.
+#include <cstring>
+#include <random>
+#include <vector>
+
+// unit test helper.
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <test/doctest/doctest.h>
+
+
+//
+// bits
+//
+
+static uint64_t
+bits( double value )
+{
+	uint64_t result = 0;
+	std::memcpy( &result, &value, sizeof( result ) );
+
+	return result;
+}
+
+
+//
+// makeMulRK
+//
+
+//! \return Pairs of XF index and RK number as in MULRK record.
+static std::vector< char >
+makeMulRK( const std::vector< uint32_t > & rks, bool lowByteFirst )
+{
+	std::vector< char > data( rks.size() * 6, 0 );
+
+	for( size_t i = 0; i < rks.size(); ++i )
+	{
+		for( size_t j = 0; j < 4; ++j )
+		{
+			const size_t shift = ( lowByteFirst ? j : 3 - j ) * 8;
+
+			data[ i * 6 + 2 + j ] = static_cast< char > ( ( rks[ i ] >> shift ) & 0xFF );
+		}
+	}
+
+	return data;
+}
+
+
+TEST_CASE( "test_double_from_rk" )
+{
+	// 1 as integer.
+	REQUIRE( Excel::doubleFromRK( 0x00000006u ) == 1.0 );
+	// 1 as IEEE number.
+	REQUIRE( Excel::doubleFromRK( 0x3FF00000u ) == 1.0 );
+	// 1.23 as IEEE number multiplied by 100.
+	REQUIRE( Excel::doubleFromRK( 0x405EC001u ) == 1.23 );
+	// -1 as integer divided by 100.
+	REQUIRE( Excel::doubleFromRK( 0xFFFFFFFFu ) == 1073741823.0 / 100.0 );
+}
+
+TEST_CASE( "test_doubles_from_rks_bit_exact" )
+{
+	std::vector< uint32_t > rks = {
+		0x00000000u, 0x00000001u, 0x00000002u, 0x00000003u,
+		0xFFFFFFFCu, 0xFFFFFFFDu, 0xFFFFFFFEu, 0xFFFFFFFFu,
+		0x7FFFFFFCu, 0x7FFFFFFDu, 0x7FFFFFFEu, 0x7FFFFFFFu,
+		0x80000000u, 0x80000001u, 0x80000002u, 0x80000003u,
+		// Infinities and NaNs.
+		0x7FF00000u, 0xFFF00000u, 0x7FF80000u, 0x7FF80001u, 0xFFF80000u,
+		// Denormals.
+		0x00000004u, 0x000FFFFDu, 0x800FFFFCu,
+		0x3FF00000u, 0x405EC001u, 0x00000006u, 0x0000018Fu
+	};
+
+	std::mt19937 generator( 42 );
+	std::uniform_int_distribution< uint32_t > random;
+
+	for( size_t i = 0; i < 100000; ++i )
+		rks.push_back( random( generator ) );
+
+	for( const bool lowByteFirst : { true, false } )
+	{
+		const auto data = makeMulRK( rks, lowByteFirst );
+
+		// Every count to test all tails after vectorized parts.
+		for( size_t count = 0; count < 20; ++count )
+		{
+			std::vector< double > values( count + 1, 0.0 );
+			values[ count ] = 42.0;
+
+			Excel::doublesFromRKs( data.data() + count * 6, count, lowByteFirst, values.data() );
+
+			for( size_t i = 0; i < count; ++i )
+				REQUIRE( bits( values[ i ] ) == bits( Excel::doubleFromRK( rks[ count + i ] ) ) );
+
+			REQUIRE( values[ count ] == 42.0 );
+		}
+
+		std::vector< double > values( rks.size() );
+		std::vector< double > expected( rks.size() );
+
+		Excel::doublesFromRKs( data.data(), rks.size(), lowByteFirst, values.data() );
+		Excel::doublesFromRKsScalar( data.data(), rks.size(), lowByteFirst, expected.data() );
+
+		for( size_t i = 0; i < rks.size(); ++i )
+		{
+			REQUIRE( bits( expected[ i ] ) == bits( Excel::doubleFromRK( rks[ i ] ) ) );
+			REQUIRE( bits( values[ i ] ) == bits( expected[ i ] ) );
+		}
+	}
+}
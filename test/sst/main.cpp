@@ -1,71 +1,166 @@
-
-/*
-	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
-	SPDX-License-Identifier: MIT
-*/
-
-// Excel include.
-#include <read-excel/parser.hpp>
-
-// unit test helper.
-#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
-#include <test/doctest/doctest.h>
-#include <test/helper/helper.hpp>
-#include <test/stream/stream.hpp>
-
-
-const auto data = make_data(
-	0xFCu, 0x00u, 0x13u, 0x00u,
-	0x03u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u,
-	0x10u, 0x00u, 0x00u,
-	0x53u, 0x54u, 0x53u, 0x54u, 0x53u, 0x54u, 0x53u, 0x54u,
-
-	0x3Cu, 0x00u, 0x11u, 0x00u,
-	0x01u,
-	0x53u, 0x00u, 0x54u, 0x00u, 0x53u, 0x00u, 0x54u, 0x00u,
-	0x53u, 0x00u, 0x54u, 0x00u, 0x53u, 0x00u, 0x54u, 0x00u,
-
-	0x3Cu, 0x00u, 0x13u, 0x00u,
-	0x10u, 0x00u, 0x00u,
-	0x51u, 0x52u, 0x51u, 0x52u, 0x51u, 0x52u, 0x51u, 0x52u,
-	0x51u, 0x52u, 0x51u, 0x52u, 0x51u, 0x52u, 0x51u, 0x52u,
-
-	0x3Cu, 0x00u, 0x23u, 0x00u,
-	0x10u, 0x00u, 0x01u,
-	0x51u, 0x00u, 0x52u, 0x00u, 0x51u, 0x00u, 0x52u, 0x00u,
-	0x51u, 0x00u, 0x52u, 0x00u, 0x51u, 0x00u, 0x52u, 0x00u,
-	0x51u, 0x00u, 0x52u, 0x00u, 0x51u, 0x00u, 0x52u, 0x00u,
-	0x51u, 0x00u, 0x52u, 0x00u, 0x51u, 0x00u, 0x52u, 0x00u
-); // data
-
-
-struct TestSstStorage : public Excel::EmptyStorage {
-	std::vector< std::wstring > m_sst;
-	void onSharedString( size_t sstSize, size_t idx, const std::wstring & value ) override;
-}; // struct TestSstStorage
-
-inline void
-TestSstStorage::onSharedString( size_t sstSize, size_t idx, const std::wstring & value )
-{
-	m_sst.push_back( value );
-}
-
-//
-// test_sst
-//
-
-TEST_CASE( "test_sst" )
-{
-	TestStream testStream( &data[ 0 ], 106 );
-
-	Excel::Record record( testStream );
-
-	TestSstStorage sst;
-	Excel::Parser::parseSST( record, sst );
-
-	REQUIRE( sst.m_sst.size() == 3 );
-
-	REQUIRE( sst.m_sst[ 0 ] == L"STSTSTSTSTSTSTST" );
-	REQUIRE( sst.m_sst[ 1 ] == L"QRQRQRQRQRQRQRQR" );
-	REQUIRE( sst.m_sst[ 2 ] == L"QRQRQRQRQRQRQRQR" );
-}
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// Excel include.
+#include <read-excel/parser.hpp>
+#include <read-excel/sst.hpp>
+
+// unit test helper.
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <test/doctest/doctest.h>
+#include <test/helper/helper.hpp>
+#include <test/stream/stream.hpp>
+
+
+const auto data = make_data(
+	0xFCu, 0x00u, 0x13u, 0x00u,
+	0x03u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u,
+	0x10u, 0x00u, 0x00u,
+	0x53u, 0x54u, 0x53u, 0x54u, 0x53u, 0x54u, 0x53u, 0x54u,
+
+	0x3Cu, 0x00u, 0x11u, 0x00u,
+	0x01u,
+	0x53u, 0x00u, 0x54u, 0x00u, 0x53u, 0x00u, 0x54u, 0x00u,
+	0x53u, 0x00u, 0x54u, 0x00u, 0x53u, 0x00u, 0x54u, 0x00u,
+
+	0x3Cu, 0x00u, 0x13u, 0x00u,
+	0x10u, 0x00u, 0x00u,
+	0x51u, 0x52u, 0x51u, 0x52u, 0x51u, 0x52u, 0x51u, 0x52u,
+	0x51u, 0x52u, 0x51u, 0x52u, 0x51u, 0x52u, 0x51u, 0x52u,
+
+	0x3Cu, 0x00u, 0x23u, 0x00u,
+	0x10u, 0x00u, 0x01u,
+	0x51u, 0x00u, 0x52u, 0x00u, 0x51u, 0x00u, 0x52u, 0x00u,
+	0x51u, 0x00u, 0x52u, 0x00u, 0x51u, 0x00u, 0x52u, 0x00u,
+	0x51u, 0x00u, 0x52u, 0x00u, 0x51u, 0x00u, 0x52u, 0x00u,
+	0x51u, 0x00u, 0x52u, 0x00u, 0x51u, 0x00u, 0x52u, 0x00u
+); // data
+
+
+struct TestSstStorage : public Excel::EmptyStorage {
+	std::vector< std::wstring > m_sst;
+	void onSharedString( size_t sstSize, size_t idx, const std::wstring & value ) override;
+}; // struct TestSstStorage
+
+inline void
+TestSstStorage::onSharedString( size_t sstSize, size_t idx, const std::wstring & value )
+{
+	m_sst.push_back( value );
+}
+
+//
+// test_sst
+//
+
+TEST_CASE( "test_sst" )
+{
+	TestStream testStream( &data[ 0 ], 106 );
+
+	Excel::Record record( testStream );
+
+	TestSstStorage sst;
+	Excel::Parser::parseSST( record, sst );
+
+	REQUIRE( sst.m_sst.size() == 3 );
+
+	REQUIRE( sst.m_sst[ 0 ] == L"STSTSTSTSTSTSTST" );
+	REQUIRE( sst.m_sst[ 1 ] == L"QRQRQRQRQRQRQRQR" );
+	REQUIRE( sst.m_sst[ 2 ] == L"QRQRQRQRQRQRQRQR" );
+}
+
+
+//
+// test_shared_string_table
+//
+
+struct TestSharedStringTableStorage : public Excel::EmptyStorage {
+	Excel::SharedStringTable m_sst;
+	void onSharedString( size_t sstSize, size_t idx, const std::wstring & value ) override;
+}; // struct TestSharedStringTableStorage
+
+inline void
+TestSharedStringTableStorage::onSharedString( size_t sstSize, size_t idx, const std::wstring & value )
+{
+	if( idx == 0 )
+		m_sst.reserve( sstSize );
+
+	m_sst.append( value );
+}
+
+TEST_CASE( "test_shared_string_table" )
+{
+	TestStream testStream( &data[ 0 ], 106 );
+	Excel::Record record( testStream );
+
+	TestSharedStringTableStorage storage;
+	Excel::Parser::parseSST( record, storage );
+
+	const Excel::SharedStringTable & sst = storage.m_sst;
+
+	REQUIRE( sst.size() == 3 );
+
+	REQUIRE( sst[ 0 ] == L"STSTSTSTSTSTSTST" );
+	REQUIRE( sst[ 1 ] == std::wstring( L"QRQRQRQRQRQRQRQR" ) );
+	REQUIRE( sst[ 2 ].str() == L"QRQRQRQRQRQRQRQR" );
+	REQUIRE( sst[ 1 ] == sst[ 2 ] );
+	REQUIRE( sst[ 0 ] != sst[ 1 ] );
+	REQUIRE( sst[ 2 ].data() == sst[ 1 ].data() + sst[ 1 ].size() );
+
+	Excel::SharedStringTable table;
+	table.append( L"" );
+	table.append( L"a" );
+
+	REQUIRE( table.size() == 2 );
+	REQUIRE( table[ 0 ].empty() );
+	REQUIRE( table[ 1 ] == L"a" );
+
+	table.clear();
+
+	REQUIRE( table.empty() );
+}
+
+struct TestArenaStorage : public Excel::EmptyStorage {
+	Excel::SharedStringTable m_sst;
+	size_t m_sharedStringsCount = 0;
+	Excel::SharedStringTable * sharedStringTable() override;
+	void onSharedString( size_t sstSize, size_t idx, const std::wstring & value ) override;
+}; // struct TestArenaStorage
+
+inline Excel::SharedStringTable *
+TestArenaStorage::sharedStringTable()
+{
+	return &m_sst;
+}
+
+inline void
+TestArenaStorage::onSharedString( size_t, size_t, const std::wstring & )
+{
+	++m_sharedStringsCount;
+}
+
+TEST_CASE( "test_sst_into_shared_string_table" )
+{
+	TestStream testStream( &data[ 0 ], 106 );
+	Excel::Record record( testStream );
+
+	TestArenaStorage storage;
+	storage.m_sst.append( L"old" );
+	Excel::Parser::parseSST( record, storage );
+
+	// No std::wstring was passed to the storage.
+	REQUIRE( storage.m_sharedStringsCount == 0 );
+
+	const Excel::SharedStringTable & sst = storage.m_sst;
+
+	REQUIRE( sst.size() == 3 );
+	REQUIRE( sst[ 0 ] == L"STSTSTSTSTSTSTST" );
+	REQUIRE( sst[ 1 ] == L"QRQRQRQRQRQRQRQR" );
+	REQUIRE( sst[ 2 ] == L"QRQRQRQRQRQRQRQR" );
+
+	// All strings are in one buffer filled by the parser.
+	for( size_t i = 1; i < sst.size(); ++i )
+		REQUIRE( sst[ i ].data() == sst[ i - 1 ].data() + sst[ i - 1 ].size() );
+}
@@ -0,0 +1,109 @@
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// Excel include.
+#include <read-excel/string.hpp>
+
+// C++ include.
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+// unit test helper.
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <test/doctest/doctest.h>
+
+using namespace std::chrono;
+
+
+//
+// measure
+//
+
+//! \return Throughput of \a widen in millions of characters per second.
+template< typename Widen >
+static double
+measure( size_t count, int iterations, Widen widen )
+{
+	const auto start = high_resolution_clock::now();
+
+	for( int i = 0; i < iterations; ++i )
+		widen();
+
+	const auto duration = duration_cast< microseconds > (
+		high_resolution_clock::now() - start ).count();
+
+	return ( duration ? static_cast< double > ( count ) * iterations / duration : 0.0 );
+}
+
+
+TEST_CASE( "test_widen_throughput" )
+{
+	// Strings in SST are up to 32767 characters, so widening goes with such chunks.
+	const size_t chunk = 32767;
+	const size_t count = chunk * 256;
+	const int iterations = 20;
+
+	std::mt19937 generator( 42 );
+	std::uniform_int_distribution< int > byte( 0, 255 );
+
+	std::vector< char > data( count * 2 );
+
+	for( auto & c : data )
+		c = static_cast< char > ( byte( generator ) );
+
+	std::wstring str;
+	str.reserve( chunk );
+
+	std::wstring expected( chunk, L'\0' );
+
+	const double latin1Scalar = measure( count, iterations, [ & ] () {
+		for( size_t i = 0; i < count; i += chunk )
+		{
+			str.clear();
+			str.resize( chunk );
+			Excel::widenLatin1Scalar( &data[ i ], chunk, &str[ 0 ] );
+		}
+	} );
+
+	const double latin1 = measure( count, iterations, [ & ] () {
+		for( size_t i = 0; i < count; i += chunk )
+		{
+			str.clear();
+			Excel::widenLatin1( &data[ i ], chunk, str );
+		}
+	} );
+
+	Excel::widenLatin1Scalar( &data[ count - chunk ], chunk, &expected[ 0 ] );
+	REQUIRE( str == expected );
+
+	const double utf16Scalar = measure( count, iterations, [ & ] () {
+		for( size_t i = 0; i < count; i += chunk )
+		{
+			str.clear();
+			str.resize( chunk );
+			Excel::widenUtf16Scalar( &data[ i * 2 ], chunk, true, &str[ 0 ] );
+		}
+	} );
+
+	const double utf16 = measure( count, iterations, [ & ] () {
+		for( size_t i = 0; i < count; i += chunk )
+		{
+			str.clear();
+			Excel::widenUtf16( &data[ i * 2 ], chunk, true, str );
+		}
+	} );
+
+	Excel::widenUtf16Scalar( &data[ ( count - chunk ) * 2 ], chunk, true, &expected[ 0 ] );
+	REQUIRE( str == expected );
+
+	std::cout << "Latin-1: scalar " << latin1Scalar << " M chars/s, widenLatin1() "
+		<< latin1 << " M chars/s." << std::endl;
+	std::cout << "UTF-16LE: scalar " << utf16Scalar << " M chars/s, widenUtf16() "
+		<< utf16 << " M chars/s." << std::endl;
+}
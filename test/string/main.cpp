@@ -1,83 +1,163 @@
-
-/*
-	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
-	SPDX-License-Identifier: MIT
-*/
-
-// Excel include.
-#include <read-excel/string.hpp>
-
-// C++ include.
-#include <vector>
-
-// unit test helper.
-#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
-#include <test/doctest/doctest.h>
-#include <test/helper/helper.hpp>
-#include <test/stream/stream.hpp>
-
-
-const auto data = make_data(
-	0x0Fu, 0x00u, 0x08u, 0x02u, 0x00u, 0x74u, 0x68u, 0x69u,
-	0x73u, 0x20u, 0x69u, 0x73u, 0x20u, 0x72u, 0x65u, 0x64u,
-	0x20u, 0x69u, 0x6Eu, 0x6Bu, 0x08u, 0x00u, 0x06u, 0x00u,
-	0x0Bu, 0x00u, 0x05u, 0x00u,
-
-	0x0Fu, 0x00u, 0x00u, 0x74u, 0x68u, 0x69u, 0x73u, 0x20u,
-	0x69u, 0x73u, 0x20u, 0x72u, 0x65u, 0x64u, 0x20u, 0x69u,
-	0x6Eu, 0x6Bu,
-
-	0x0Fu, 0x00u, 0x01u, 0x74u, 0x00u, 0x68u, 0x00u, 0x69u,
-	0x00u, 0x73u, 0x00u, 0x20u, 0x00u, 0x69u, 0x00u, 0x73u,
-	0x00u, 0x20u, 0x00u, 0x72u, 0x00u, 0x65u, 0x00u, 0x64u,
-	0x00u, 0x20u, 0x00u, 0x69u, 0x00u, 0x6Eu, 0x00u, 0x6Bu,
-	0x00u,
-
-	0x0Fu, 0x00u, 0x04u, 0x04u, 0x00u, 0x00u, 0x00u, 0x74u,
-	0x68u, 0x69u, 0x73u, 0x20u, 0x69u, 0x73u, 0x20u, 0x72u,
-	0x65u, 0x64u, 0x20u, 0x69u, 0x6Eu, 0x6Bu, 0x00u, 0x00u,
-	0x00u, 0x00u,
-
-	0x0Fu, 0x00u, 0x0Cu, 0x02u, 0x00u, 0x04u, 0x00u, 0x00u,
-	0x00u, 0x74u, 0x68u, 0x69u, 0x73u, 0x20u, 0x69u, 0x73u,
-	0x20u, 0x72u, 0x65u, 0x64u, 0x20u, 0x69u, 0x6Eu, 0x6Bu,
-	0x08u, 0x00u, 0x06u, 0x00u, 0x0Bu, 0x00u, 0x05u, 0x00u,
-	0x00u, 0x00u, 0x00u, 0x00u,
-
-	0x0Fu, 0x00u, 0x00u, 0x74u, 0x68u, 0x69u, 0x73u, 0x20u,
-	0x69u, 0x73u, 0x20u, 0x72u, 0x65u, 0x64u, 0x20u, 0x69u,
-	0x6Eu, 0x6Bu
-); // data
-
-
-TEST_CASE( "test_string" )
-{
-	std::vector< int32_t > borders;
-	std::wstring str;
-
-	TestStream stream( &data[ 0 ], 159 );
-
-	str = Excel::loadString( stream, borders );
-
-	REQUIRE( str == L"this is red ink" );
-
-	str = Excel::loadString( stream, borders );
-
-	REQUIRE( str == L"this is red ink" );
-
-	str = Excel::loadString( stream, borders );
-
-	REQUIRE( str == L"this is red ink" );
-
-	str = Excel::loadString( stream, borders );
-
-	REQUIRE( str == L"this is red ink" );
-
-	str = Excel::loadString( stream, borders );
-
-	REQUIRE( str == L"this is red ink" );
-
-	str = Excel::loadString( stream, borders );
-
-	REQUIRE( str == L"this is red ink" );
-}
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// Excel include.
+#include <read-excel/string.hpp>
+
+// C++ include.
+#include <vector>
+#include <random>
+
+// unit test helper.
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <test/doctest/doctest.h>
+#include <test/helper/helper.hpp>
+#include <test/stream/stream.hpp>
+
+
+const auto data = make_data(
+	0x0Fu, 0x00u, 0x08u, 0x02u, 0x00u, 0x74u, 0x68u, 0x69u,
+	0x73u, 0x20u, 0x69u, 0x73u, 0x20u, 0x72u, 0x65u, 0x64u,
+	0x20u, 0x69u, 0x6Eu, 0x6Bu, 0x08u, 0x00u, 0x06u, 0x00u,
+	0x0Bu, 0x00u, 0x05u, 0x00u,
+
+	0x0Fu, 0x00u, 0x00u, 0x74u, 0x68u, 0x69u, 0x73u, 0x20u,
+	0x69u, 0x73u, 0x20u, 0x72u, 0x65u, 0x64u, 0x20u, 0x69u,
+	0x6Eu, 0x6Bu,
+
+	0x0Fu, 0x00u, 0x01u, 0x74u, 0x00u, 0x68u, 0x00u, 0x69u,
+	0x00u, 0x73u, 0x00u, 0x20u, 0x00u, 0x69u, 0x00u, 0x73u,
+	0x00u, 0x20u, 0x00u, 0x72u, 0x00u, 0x65u, 0x00u, 0x64u,
+	0x00u, 0x20u, 0x00u, 0x69u, 0x00u, 0x6Eu, 0x00u, 0x6Bu,
+	0x00u,
+
+	0x0Fu, 0x00u, 0x04u, 0x04u, 0x00u, 0x00u, 0x00u, 0x74u,
+	0x68u, 0x69u, 0x73u, 0x20u, 0x69u, 0x73u, 0x20u, 0x72u,
+	0x65u, 0x64u, 0x20u, 0x69u, 0x6Eu, 0x6Bu, 0x00u, 0x00u,
+	0x00u, 0x00u,
+
+	0x0Fu, 0x00u, 0x0Cu, 0x02u, 0x00u, 0x04u, 0x00u, 0x00u,
+	0x00u, 0x74u, 0x68u, 0x69u, 0x73u, 0x20u, 0x69u, 0x73u,
+	0x20u, 0x72u, 0x65u, 0x64u, 0x20u, 0x69u, 0x6Eu, 0x6Bu,
+	0x08u, 0x00u, 0x06u, 0x00u, 0x0Bu, 0x00u, 0x05u, 0x00u,
+	0x00u, 0x00u, 0x00u, 0x00u,
+
+	0x0Fu, 0x00u, 0x00u, 0x74u, 0x68u, 0x69u, 0x73u, 0x20u,
+	0x69u, 0x73u, 0x20u, 0x72u, 0x65u, 0x64u, 0x20u, 0x69u,
+	0x6Eu, 0x6Bu
+); // data
+
+
+TEST_CASE( "test_string" )
+{
+	std::vector< int32_t > borders;
+	std::wstring str;
+
+	TestStream stream( &data[ 0 ], 159 );
+
+	str = Excel::loadString( stream, borders );
+
+	REQUIRE( str == L"this is red ink" );
+
+	str = Excel::loadString( stream, borders );
+
+	REQUIRE( str == L"this is red ink" );
+
+	str = Excel::loadString( stream, borders );
+
+	REQUIRE( str == L"this is red ink" );
+
+	str = Excel::loadString( stream, borders );
+
+	REQUIRE( str == L"this is red ink" );
+
+	str = Excel::loadString( stream, borders );
+
+	REQUIRE( str == L"this is red ink" );
+
+	str = Excel::loadString( stream, borders );
+
+	REQUIRE( str == L"this is red ink" );
+}
+
+TEST_CASE( "test_string_split_by_continue" )
+{
+	// 10 characters: 3 compressed, border, 4 uncompressed, border, 3 compressed.
+	const auto split = make_data(
+		0x0Au, 0x00u, 0x00u, 0x61u, 0x62u, 0x63u,
+		0x01u, 0x64u, 0x00u, 0x16u, 0x04u, 0x66u, 0x00u, 0x67u, 0x00u,
+		0x00u, 0x68u, 0x69u, 0x6Au,
+		0x01u, 0x00u, 0x00u, 0x6Bu
+	); // split
+
+	const std::vector< int32_t > borders = { 6, 15 };
+
+	TestStream stream( &split[ 0 ], 23 );
+
+	REQUIRE( Excel::loadString( stream, borders ) == L"abcd\x0416" L"fghij" );
+	REQUIRE( stream.pos() == 19 );
+
+	REQUIRE( Excel::loadString( stream, borders ) == L"k" );
+
+	// Empty CONTINUE record gives the same border twice.
+	const auto emptyContinue = make_data(
+		0x06u, 0x00u, 0x00u, 0x61u, 0x62u,
+		0x00u, 0x63u, 0x64u,
+		0x00u, 0x65u, 0x66u
+	); // emptyContinue
+
+	TestStream emptyContinueStream( &emptyContinue[ 0 ], 11 );
+
+	REQUIRE( Excel::loadString( emptyContinueStream, { 5, 5, 8 } ) == L"abcdef" );
+	REQUIRE( emptyContinueStream.pos() == 11 );
+}
+
+TEST_CASE( "test_widen" )
+{
+	std::mt19937 generator( 42 );
+	std::uniform_int_distribution< int > byte( 0, 255 );
+
+	std::vector< char > data( 1024 );
+
+	for( auto & c : data )
+		c = static_cast< char > ( byte( generator ) );
+
+	// All values of bytes.
+	for( size_t i = 0; i < 256; ++i )
+		data[ i ] = static_cast< char > ( i );
+
+	// Unaligned data and lengths around the width of vectors.
+	for( size_t offset = 0; offset < 4; ++offset )
+	{
+		for( size_t count = 0; count < 300; ++count )
+		{
+			std::wstring expected( count, L'\0' );
+			std::wstring str = L"prefix";
+
+			if( count )
+				Excel::widenLatin1Scalar( &data[ offset ], count, &expected[ 0 ] );
+			Excel::widenLatin1( &data[ offset ], count, str );
+
+			REQUIRE( str == L"prefix" + expected );
+
+			for( const bool lowByteFirst : { true, false } )
+			{
+				str = L"prefix";
+
+				if( count )
+					Excel::widenUtf16Scalar( &data[ offset ], count, lowByteFirst, &expected[ 0 ] );
+				Excel::widenUtf16( &data[ offset ], count, lowByteFirst, str );
+
+				REQUIRE( str == L"prefix" + expected );
+			}
+		}
+	}
+
+	std::wstring str;
+	Excel::widenUtf16( "\x16\x04\xFF\x00", 2, true, str );
+
+	REQUIRE( str == L"\x0416\x00FF" );
+}
@@ -1,1305 +1,1305 @@
-
-/*
-	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
-	SPDX-License-Identifier: MIT
-*/
-
-// Test include.
-#include <test/testdocument/document.hpp>
-#include <test/helper/helper.hpp>
-
-
-const auto data = make_data(
-			/* Header. */
-/* 0000 */	/* Compound document file identifier. */
-			0xD0u, 0xCFu, 0x11u, 0xE0u, 0xA1u, 0xB1u, 0x1Au, 0xE1u,
-			/* Unique identifier. */
-			0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 0010 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-			/* Version number and revision number. */
-			0x3Eu, 0x00u, 0x03u, 0x00u,
-			/* Byte order identifier. */
-			0xFEu, 0xFFu,
-			/* Size of sectors. */
-			0x09u, 0x00u,
-/* 0020 */	/* Size of short-sectors. */
-			0x06u, 0x00u,
-			/* Can be skipped. */
-			0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-			/* Number of sectors used by SAT. */
-			0x01u, 0x00u, 0x00u, 0x00u,
-/* 0030 */	/* SecID of first sector used by directory. */
-			0x01u, 0x00u, 0x00u, 0x00u,
-			/* Can be ignored. */
-			0x00u, 0x00u, 0x00u, 0x00u,
-			/* Minimum size of standard stream. */
-			0x00u, 0x10u, 0x00u, 0x00u,
-			/* SecID of the first sector used by SSAT. */
-			0x1Du, 0x00u, 0x00u, 0x00u,
-/* 0040 */	/* Number of sectors used by SSAT. */
-			0x01u, 0x00u, 0x00u, 0x00u,
-			/* SecID of the first sector used by MSAT. */
-			0xFEu, 0xFFu, 0xFFu, 0xFFu,
-			/* Number of sectors used by MSAT. */
-			0x00u, 0x00u, 0x00u, 0x00u,
-			/* First SecID in the MSAT followed by 432 bytes */
-			0x00u, 0x00u, 0x00u, 0x00u,
-/* 0050 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0060 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0070 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0080 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0090 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 00A0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 00B0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 00C0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 00D0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 00E0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 00F0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0100 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0110 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0120 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0130 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0140 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0150 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0160 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0170 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0180 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0190 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 01A0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 01B0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 01C0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 01D0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 01E0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 01F0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-
-			/* 0 sector. SAT. */
-			/* | 00 | 01 | 02 | 03 | 04 | 05 | 06 | 07 | 08 | 09 | 10 | 11 | 12 | 13 | 14 | 15 | */
-			/* | -3 | 31 | 03 | 04 | 05 | 06 | 07 | 08 | 09 | 10 | 11 | 12 | 13 | 14 | 15 | 16 | */
-			/* | 16 | 17 | 18 | 19 | 20 | 21 | 22 | 23 | 24 | 25 | 26 | 27 | 28 | 29 | 30 | 31 | */
-			/* | 17 | 18 | 19 | 20 | 21 | 22 | 23 | 24 | 25 | 26 | 27 | 28 | -2 | -2 | 32 | -2 | */
-/* 0200 */	0xFDu, 0xFFu, 0xFFu, 0xFFu, 0x1Fu, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x04u, 0x00u, 0x00u, 0x00u,
-/* 0210 */	0x05u, 0x00u, 0x00u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0x08u, 0x00u, 0x00u, 0x00u,
-/* 0220 */	0x09u, 0x00u, 0x00u, 0x00u, 0x0Au, 0x00u, 0x00u, 0x00u, 0x0Bu, 0x00u, 0x00u, 0x00u, 0x0Cu, 0x00u, 0x00u, 0x00u,
-/* 0230 */	0x0Du, 0x00u, 0x00u, 0x00u, 0x0Eu, 0x00u, 0x00u, 0x00u, 0x0Fu, 0x00u, 0x00u, 0x00u, 0x10u, 0x00u, 0x00u, 0x00u,
-/* 0240 */	0x11u, 0x00u, 0x00u, 0x00u, 0x12u, 0x00u, 0x00u, 0x00u, 0x13u, 0x00u, 0x00u, 0x00u, 0x14u, 0x00u, 0x00u, 0x00u,
-/* 0250 */	0x15u, 0x00u, 0x00u, 0x00u, 0x16u, 0x00u, 0x00u, 0x00u, 0x17u, 0x00u, 0x00u, 0x00u, 0x18u, 0x00u, 0x00u, 0x00u,
-/* 0260 */	0x19u, 0x00u, 0x00u, 0x00u, 0x1Au, 0x00u, 0x00u, 0x00u, 0x1Bu, 0x00u, 0x00u, 0x00u, 0x1Cu, 0x00u, 0x00u, 0x00u,
-/* 0270 */	0xFEu, 0xFFu, 0xFFu, 0xFFu, 0xFEu, 0xFFu, 0xFFu, 0xFFu, 0x20u, 0x00u, 0x00u, 0x00u, 0xFEu, 0xFFu, 0xFFu, 0xFFu,
-/* 0280 */	0xFEu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0290 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 02A0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 02B0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 02C0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 02D0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 02E0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 02F0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0300 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0310 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0320 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0330 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0340 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0350 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0360 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0370 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0380 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0390 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 03A0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 03B0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 03C0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 03D0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 03E0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 03F0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-
-			/* 1 sector. Directory. */
-/* 0400 */	/* Name of the directory: Root Entry. */
-			0x52u, 0x00u, 0x6Fu, 0x00u, 0x6Fu, 0x00u, 0x74u, 0x00u, 0x20u, 0x00u, 0x45u, 0x00u, 0x6Eu, 0x00u, 0x74u, 0x00u,
-/* 0410 */	0x72u, 0x00u, 0x79u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 0420 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 0430 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 0440 */	/* Size of used area by directory's name: 22. */
-			0x16u, 0x00u,
-			/* Type of the entry: Root storage. */
-			0x05u,
-			/* Node color: Red. */
-			0x00u,
-			/* DirID of the left child: 0xFFFFFFFF. */
-			0xFFu, 0xFFu, 0xFFu, 0xFFu,
-			/* DirID of the right child: 0xFFFFFFFF. */
-			0xFFu, 0xFFu, 0xFFu, 0xFFu,
-			/* DirID of root node entry: 2. */
-			0x02u, 0x00u, 0x00u, 0x00u,
-/* 0450 */	0x20u, 0x08u, 0x02u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x46u,
-/* 0460 */	0x00u, 0x00u, 0x00u, 0x00u, 0x20u, 0x16u, 0x3Du, 0x5Du, 0xD8u, 0xD4u, 0xCBu, 0x01u, 0x00u, 0xEDu, 0x5Bu, 0x71u,
-/* 0470 */	0xDAu, 0xD4u, 0xCBu, 0x01u,
-			/* SecID of first sector: 0x1E. */
-			0x1Eu, 0x00u, 0x00u, 0x00u,
-			/* Total stream size: 640. */
-			0x80u, 0x02u, 0x00u, 0x00u,
-			0x00u, 0x00u, 0x00u, 0x00u,
-/* 0480 */	/* Name of the directory: Workbook. */
-			0x57u, 0x00u, 0x6Fu, 0x00u, 0x72u, 0x00u, 0x6Bu, 0x00u, 0x62u, 0x00u, 0x6Fu, 0x00u, 0x6Fu, 0x00u, 0x6Bu, 0x00u,
-/* 0490 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 04A0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 04B0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 04C0 */	/* Size of used area by directory's name: 18. */
-			0x12u, 0x00u,
-			/* Type of the entry: User stream. */
-			0x02u,
-			/* Node color: Black. */
-			0x01u,
-			/* DirID of the left child: 4. */
-			0x04u, 0x00u, 0x00u, 0x00u,
-			/* DirID of the right child: 0xFFFFFFFF. */
-			0xFFu, 0xFFu, 0xFFu, 0xFFu,
-			/* DirID of the root node entry: 0xFFFFFFFF. */
-			0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 04D0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 04E0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 04F0 */	0x00u, 0x00u, 0x00u, 0x00u,
-			/* SecID of first sector: 2. */
-			0x02u, 0x00u, 0x00u, 0x00u,
-			/* Total stream size: 13440. */
-			0x80u, 0x34u, 0x00u, 0x00u,
-			0x00u, 0x00u, 0x00u, 0x00u,
-/* 0500 */	/* Name of the directory. */
-			0x05u, 0x00u, 0x53u, 0x00u, 0x75u, 0x00u, 0x6Du, 0x00u, 0x6Du, 0x00u, 0x61u, 0x00u, 0x72u, 0x00u, 0x79u, 0x00u,
-/* 0510 */	0x49u, 0x00u, 0x6Eu, 0x00u, 0x66u, 0x00u, 0x6Fu, 0x00u, 0x72u, 0x00u, 0x6Du, 0x00u, 0x61u, 0x00u, 0x74u, 0x00u,
-/* 0520 */	0x69u, 0x00u, 0x6Fu, 0x00u, 0x6Eu, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 0530 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 0540 */	/* Size of used area by directory's name. */
-			0x28u, 0x00u,
-			/* Type of the entry: User stream. */
-			0x02u,
-			/* Node color: Black. */
-			0x01u,
-			/* DirID of the left child: 1. */
-			0x01u, 0x00u, 0x00u, 0x00u,
-			/* DirID of the right child: 3. */
-			0x03u, 0x00u, 0x00u, 0x00u,
-			/* DirID of the root node entry: 0xFFFFFFFF. */
-			0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 0550 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 0560 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 0570 */	0x00u, 0x00u, 0x00u, 0x00u,
-			/* SecID of first sector: 0. */
-			0x00u, 0x00u, 0x00u, 0x00u,
-			/* Total stream size: 224. */
-			0xE0u, 0x00u, 0x00u, 0x00u,
-			0x00u, 0x00u, 0x00u, 0x00u,
-/* 0580 */	/* Name of the directory. */
-			0x05u, 0x00u, 0x44u, 0x00u, 0x6Fu, 0x00u, 0x63u, 0x00u, 0x75u, 0x00u, 0x6Du, 0x00u, 0x65u, 0x00u, 0x6Eu, 0x00u,
-/* 0590 */	0x74u, 0x00u, 0x53u, 0x00u, 0x75u, 0x00u, 0x6Du, 0x00u, 0x6Du, 0x00u, 0x61u, 0x00u, 0x72u, 0x00u, 0x79u, 0x00u,
-/* 05A0 */	0x49u, 0x00u, 0x6Eu, 0x00u, 0x66u, 0x00u, 0x6Fu, 0x00u, 0x72u, 0x00u, 0x6Du, 0x00u, 0x61u, 0x00u, 0x74u, 0x00u,
-/* 05B0 */	0x69u, 0x00u, 0x6Fu, 0x00u, 0x6Eu, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 05C0 */	/* Size of used area by directory's name. */
-			0x38u, 0x00u,
-			/* Type of the entry: User stream. */
-			0x02u,
-			/* Node color: Black. */
-			0x01u,
-			/* DirID of the left child: 0xFFFFFFFF. */
-			0xFFu, 0xFFu, 0xFFu, 0xFFu,
-			/* DirID of the right hild: 0xFFFFFFFF. */
-			0xFFu, 0xFFu, 0xFFu, 0xFFu,
-			/* DirID of the root node entry: 0xFFFFFFFF. */
-			0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 05D0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 05E0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 05F0 */	0x00u, 0x00u, 0x00u, 0x00u,
-			/* SecID of first sector: 4. */
-			0x04u, 0x00u, 0x00u, 0x00u,
-			/* Total stream size: 236. */
-			0xECu, 0x00u, 0x00u, 0x00u,
-			0x00u, 0x00u, 0x00u, 0x00u,
-
-			/* 2 sector. Workbook. */
-/* 0600 */	0x09u, 0x08u, 0x10u, 0x00u, 0x00u, 0x06u, 0x05u, 0x00u, 0xA9u, 0x1Fu, 0xCDu, 0x07u, 0xC9u, 0x00u, 0x01u, 0x00u,
-/* 0610 */	0x06u, 0x04u, 0x00u, 0x00u, 0xE1u, 0x00u, 0x02u, 0x00u, 0xB0u, 0x04u, 0xC1u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u,
-/* 0620 */	0xE2u, 0x00u, 0x00u, 0x00u, 0x5Cu, 0x00u, 0x70u, 0x00u, 0x0Eu, 0x00u, 0x00u, 0x49u, 0x67u, 0x6Fu, 0x72u, 0x20u,
-/* 0630 */	0x4Du, 0x69u, 0x72u, 0x6Fu, 0x6Eu, 0x63u, 0x68u, 0x69u, 0x6Bu, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u,
-/* 0640 */	0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u,
-/* 0650 */	0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u,
-/* 0660 */	0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u,
-/* 0670 */	0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u,
-/* 0680 */	0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u,
-/* 0690 */	0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x42u, 0x00u, 0x02u, 0x00u, 0xB0u, 0x04u, 0x61u, 0x01u,
-/* 06A0 */	0x02u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x01u, 0x00u, 0x00u, 0x3Du, 0x01u, 0x02u, 0x00u, 0x01u, 0x00u, 0x9Cu, 0x00u,
-/* 06B0 */	0x02u, 0x00u, 0x10u, 0x00u, 0x19u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x12u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u,
-/* 06C0 */	0x13u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xAFu, 0x01u, 0x02u, 0x00u, 0x00u, 0x00u, 0xBCu, 0x01u, 0x02u, 0x00u,
-/* 06D0 */	0x00u, 0x00u, 0x3Du, 0x00u, 0x12u, 0x00u, 0x78u, 0x00u, 0x2Du, 0x00u, 0x1Fu, 0x3Bu, 0xC2u, 0x1Fu, 0x38u, 0x00u,
-/* 06E0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x58u, 0x02u, 0x40u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x8Du, 0x00u,
-/* 06F0 */	0x02u, 0x00u, 0x00u, 0x00u, 0x22u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x0Eu, 0x00u, 0x02u, 0x00u, 0x01u, 0x00u,
-/* 0700 */	0xB7u, 0x01u, 0x02u, 0x00u, 0x00u, 0x00u, 0xDAu, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u,
-/* 0710 */	0xDCu, 0x00u, 0x00u, 0x00u, 0x08u, 0x00u, 0x90u, 0x01u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u,
-/* 0720 */	0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u,
-/* 0730 */	0x1Eu, 0x00u, 0xDCu, 0x00u, 0x00u, 0x00u, 0x08u, 0x00u, 0x90u, 0x01u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u,
-/* 0740 */	0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u,
-/* 0750 */	0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u, 0x00u, 0x00u, 0x08u, 0x00u, 0x90u, 0x01u, 0x00u, 0x00u, 0x00u, 0x02u,
-/* 0760 */	0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u,
-/* 0770 */	0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u, 0x00u, 0x00u, 0x08u, 0x00u, 0x90u, 0x01u, 0x00u, 0x00u,
-/* 0780 */	0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u,
-/* 0790 */	0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u, 0x00u, 0x00u, 0x08u, 0x00u, 0x90u, 0x01u,
-/* 07A0 */	0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u,
-/* 07B0 */	0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u, 0x00u, 0x00u, 0x09u, 0x00u,
-/* 07C0 */	0x90u, 0x01u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u,
-/* 07D0 */	0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u, 0x00u, 0x00u,
-/* 07E0 */	0x3Eu, 0x00u, 0x90u, 0x01u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u,
-/* 07F0 */	0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u,
-
-			/* 3 sector. Workbook. */
-/* 0800 */	0x01u, 0x00u, 0x3Fu, 0x00u, 0xBCu, 0x02u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u,
-/* 0810 */	0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u,
-/* 0820 */	0xDCu, 0x00u, 0x01u, 0x00u, 0x34u, 0x00u, 0xBCu, 0x02u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u,
-/* 0830 */	0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u,
-/* 0840 */	0x1Eu, 0x00u, 0x2Cu, 0x01u, 0x01u, 0x00u, 0x38u, 0x00u, 0xBCu, 0x02u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u,
-/* 0850 */	0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u,
-/* 0860 */	0x31u, 0x00u, 0x1Eu, 0x00u, 0x04u, 0x01u, 0x01u, 0x00u, 0x38u, 0x00u, 0xBCu, 0x02u, 0x00u, 0x00u, 0x00u, 0x02u,
-/* 0870 */	0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u,
-/* 0880 */	0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u, 0x01u, 0x00u, 0x38u, 0x00u, 0xBCu, 0x02u, 0x00u, 0x00u,
-/* 0890 */	0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u,
-/* 08A0 */	0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u, 0x01u, 0x00u, 0x08u, 0x00u, 0xBCu, 0x02u,
-/* 08B0 */	0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u,
-/* 08C0 */	0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u, 0x01u, 0x00u, 0x09u, 0x00u,
-/* 08D0 */	0xBCu, 0x02u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u,
-/* 08E0 */	0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0x68u, 0x01u, 0x01u, 0x00u,
-/* 08F0 */	0x38u, 0x00u, 0xBCu, 0x02u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u,
-/* 0900 */	0x6Du, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x61u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u,
-/* 0910 */	0x00u, 0x00u, 0x3Cu, 0x00u, 0x90u, 0x01u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u,
-/* 0920 */	0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u,
-/* 0930 */	0xDCu, 0x00u, 0x00u, 0x00u, 0x14u, 0x00u, 0x90u, 0x01u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u,
-/* 0940 */	0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u,
-/* 0950 */	0x1Eu, 0x00u, 0xDCu, 0x00u, 0x02u, 0x00u, 0x17u, 0x00u, 0x90u, 0x01u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u,
-/* 0960 */	0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u,
-/* 0970 */	0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u, 0x00u, 0x00u, 0x34u, 0x00u, 0x90u, 0x01u, 0x00u, 0x00u, 0x00u, 0x02u,
-/* 0980 */	0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u,
-/* 0990 */	0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u, 0x00u, 0x00u, 0x0Au, 0x00u, 0x90u, 0x01u, 0x00u, 0x00u,
-/* 09A0 */	0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u,
-/* 09B0 */	0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u, 0x00u, 0x00u, 0x11u, 0x00u, 0x90u, 0x01u,
-/* 09C0 */	0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u,
-/* 09D0 */	0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x1Eu, 0x04u, 0x2Fu, 0x00u, 0x05u, 0x00u, 0x15u, 0x00u, 0x01u, 0x23u,
-/* 09E0 */	0x00u, 0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x22u, 0x00u, 0x40u, 0x04u, 0x2Eu, 0x00u, 0x22u,
-/* 09F0 */	0x00u, 0x3Bu, 0x00u, 0x5Cu, 0x00u, 0x2Du, 0x00u, 0x23u, 0x00u, 0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u,
-
-			/* 4 sector. Workbook. */
-/* 0A00 */	0x00u, 0x22u, 0x00u, 0x40u, 0x04u, 0x2Eu, 0x00u, 0x22u, 0x00u, 0x1Eu, 0x04u, 0x39u, 0x00u, 0x06u, 0x00u, 0x1Au,
-/* 0A10 */	0x00u, 0x01u, 0x23u, 0x00u, 0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x22u, 0x00u, 0x40u, 0x04u,
-/* 0A20 */	0x2Eu, 0x00u, 0x22u, 0x00u, 0x3Bu, 0x00u, 0x5Bu, 0x00u, 0x52u, 0x00u, 0x65u, 0x00u, 0x64u, 0x00u, 0x5Du, 0x00u,
-/* 0A30 */	0x5Cu, 0x00u, 0x2Du, 0x00u, 0x23u, 0x00u, 0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x22u, 0x00u,
-/* 0A40 */	0x40u, 0x04u, 0x2Eu, 0x00u, 0x22u, 0x00u, 0x1Eu, 0x04u, 0x3Bu, 0x00u, 0x07u, 0x00u, 0x1Bu, 0x00u, 0x01u, 0x23u,
-/* 0A50 */	0x00u, 0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x30u, 0x00u, 0x22u,
-/* 0A60 */	0x00u, 0x40u, 0x04u, 0x2Eu, 0x00u, 0x22u, 0x00u, 0x3Bu, 0x00u, 0x5Cu, 0x00u, 0x2Du, 0x00u, 0x23u, 0x00u, 0x2Cu,
-/* 0A70 */	0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x30u, 0x00u, 0x22u, 0x00u, 0x40u,
-/* 0A80 */	0x04u, 0x2Eu, 0x00u, 0x22u, 0x00u, 0x1Eu, 0x04u, 0x45u, 0x00u, 0x08u, 0x00u, 0x20u, 0x00u, 0x01u, 0x23u, 0x00u,
-/* 0A90 */	0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x30u, 0x00u, 0x22u, 0x00u,
-/* 0AA0 */	0x40u, 0x04u, 0x2Eu, 0x00u, 0x22u, 0x00u, 0x3Bu, 0x00u, 0x5Bu, 0x00u, 0x52u, 0x00u, 0x65u, 0x00u, 0x64u, 0x00u,
-/* 0AB0 */	0x5Du, 0x00u, 0x5Cu, 0x00u, 0x2Du, 0x00u, 0x23u, 0x00u, 0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u,
-/* 0AC0 */	0x2Eu, 0x00u, 0x30u, 0x00u, 0x30u, 0x00u, 0x22u, 0x00u, 0x40u, 0x04u, 0x2Eu, 0x00u, 0x22u, 0x00u, 0x1Eu, 0x04u,
-/* 0AD0 */	0x6Bu, 0x00u, 0x2Au, 0x00u, 0x33u, 0x00u, 0x01u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x2Au, 0x00u, 0x20u, 0x00u, 0x23u,
-/* 0AE0 */	0x00u, 0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x22u, 0x00u, 0x40u, 0x04u, 0x2Eu, 0x00u, 0x22u,
-/* 0AF0 */	0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x3Bu, 0x00u, 0x5Cu, 0x00u, 0x2Du, 0x00u, 0x2Au, 0x00u, 0x20u, 0x00u, 0x23u,
-/* 0B00 */	0x00u, 0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x22u, 0x00u, 0x40u, 0x04u, 0x2Eu, 0x00u, 0x22u,
-/* 0B10 */	0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x3Bu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x2Au, 0x00u, 0x20u, 0x00u, 0x22u,
-/* 0B20 */	0x00u, 0x2Du, 0x00u, 0x22u, 0x00u, 0x22u, 0x00u, 0x40u, 0x04u, 0x2Eu, 0x00u, 0x22u, 0x00u, 0x5Fu, 0x00u, 0x2Du,
-/* 0B30 */	0x00u, 0x3Bu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x40u, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x1Eu, 0x04u, 0x6Bu,
-/* 0B40 */	0x00u, 0x29u, 0x00u, 0x33u, 0x00u, 0x01u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x2Au, 0x00u, 0x20u, 0x00u, 0x23u, 0x00u,
-/* 0B50 */	0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x5Fu, 0x00u, 0x40u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u,
-/* 0B60 */	0x5Fu, 0x00u, 0x2Du, 0x00u, 0x3Bu, 0x00u, 0x5Cu, 0x00u, 0x2Du, 0x00u, 0x2Au, 0x00u, 0x20u, 0x00u, 0x23u, 0x00u,
-/* 0B70 */	0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x5Fu, 0x00u, 0x40u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u,
-/* 0B80 */	0x5Fu, 0x00u, 0x2Du, 0x00u, 0x3Bu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x2Au, 0x00u, 0x20u, 0x00u, 0x22u, 0x00u,
-/* 0B90 */	0x2Du, 0x00u, 0x22u, 0x00u, 0x5Fu, 0x00u, 0x40u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u,
-/* 0BA0 */	0x3Bu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x40u, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x1Eu, 0x04u, 0x7Bu, 0x00u,
-/* 0BB0 */	0x2Cu, 0x00u, 0x3Bu, 0x00u, 0x01u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x2Au, 0x00u, 0x20u, 0x00u, 0x23u, 0x00u, 0x2Cu,
-/* 0BC0 */	0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x30u, 0x00u, 0x22u, 0x00u, 0x40u,
-/* 0BD0 */	0x04u, 0x2Eu, 0x00u, 0x22u, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x3Bu, 0x00u, 0x5Cu, 0x00u, 0x2Du, 0x00u, 0x2Au,
-/* 0BE0 */	0x00u, 0x20u, 0x00u, 0x23u, 0x00u, 0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u,
-/* 0BF0 */	0x00u, 0x30u, 0x00u, 0x22u, 0x00u, 0x40u, 0x04u, 0x2Eu, 0x00u, 0x22u, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x3Bu,
-
-			/* 5 sector. Workbook. */
-/* 0C00 */	0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x2Au, 0x00u, 0x20u, 0x00u, 0x22u, 0x00u, 0x2Du, 0x00u, 0x22u, 0x00u, 0x3Fu,
-/* 0C10 */	0x00u, 0x3Fu, 0x00u, 0x22u, 0x00u, 0x40u, 0x04u, 0x2Eu, 0x00u, 0x22u, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x3Bu,
-/* 0C20 */	0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x40u, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x1Eu, 0x04u, 0x7Bu, 0x00u, 0x2Bu,
-/* 0C30 */	0x00u, 0x3Bu, 0x00u, 0x01u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x2Au, 0x00u, 0x20u, 0x00u, 0x23u, 0x00u, 0x2Cu, 0x00u,
-/* 0C40 */	0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x30u, 0x00u, 0x5Fu, 0x00u, 0x40u, 0x04u,
-/* 0C50 */	0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x3Bu, 0x00u, 0x5Cu, 0x00u, 0x2Du, 0x00u, 0x2Au, 0x00u,
-/* 0C60 */	0x20u, 0x00u, 0x23u, 0x00u, 0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u,
-/* 0C70 */	0x30u, 0x00u, 0x5Fu, 0x00u, 0x40u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x3Bu, 0x00u,
-/* 0C80 */	0x5Fu, 0x00u, 0x2Du, 0x00u, 0x2Au, 0x00u, 0x20u, 0x00u, 0x22u, 0x00u, 0x2Du, 0x00u, 0x22u, 0x00u, 0x3Fu, 0x00u,
-/* 0C90 */	0x3Fu, 0x00u, 0x5Fu, 0x00u, 0x40u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x3Bu, 0x00u,
-/* 0CA0 */	0x5Fu, 0x00u, 0x2Du, 0x00u, 0x40u, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x00u, 0x00u,
-/* 0CB0 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 0CC0 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u,
-/* 0CD0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
-/* 0CE0 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 0CF0 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u,
-/* 0D00 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
-/* 0D10 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 0D20 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u,
-/* 0D30 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
-/* 0D40 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 0D50 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u,
-/* 0D60 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
-/* 0D70 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 0D80 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u,
-/* 0D90 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
-/* 0DA0 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 0DB0 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u,
-/* 0DC0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
-/* 0DD0 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 0DE0 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u,
-/* 0DF0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
-
-			/* 6 sector. Workbook. */
-/* 0E00 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 0E10 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x20u, 0x00u, 0x00u, 0x00u,
-/* 0E20 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x02u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
-/* 0E30 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
-/* 0E40 */	0x9Fu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
-/* 0E50 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0xADu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
-/* 0E60 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
-/* 0E70 */	0xAAu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
-/* 0E80 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0xAEu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
-/* 0E90 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
-/* 0EA0 */	0x9Bu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
-/* 0EB0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0xAFu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
-/* 0EC0 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
-/* 0ED0 */	0xACu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
-/* 0EE0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x9Du, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
-/* 0EF0 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
-/* 0F00 */	0x8Bu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
-/* 0F10 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0xAEu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
-/* 0F20 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
-/* 0F30 */	0xACu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
-/* 0F40 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0xB3u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u,
-/* 0F50 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
-/* 0F60 */	0x9Eu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
-/* 0F70 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x9Du, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u,
-/* 0F80 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
-/* 0F90 */	0x8Bu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
-/* 0FA0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0xA4u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u,
-/* 0FB0 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
-/* 0FC0 */	0xB1u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
-/* 0FD0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0xB4u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u,
-/* 0FE0 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
-/* 0FF0 */	0xBEu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
-
-			/* 7 sector. Workbook. */
-/* 1000 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x8Au, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u,
-/* 1010 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
-/* 1020 */	0xB9u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
-/* 1030 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0xA4u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u,
-/* 1040 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
-/* 1050 */	0xB1u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
-/* 1060 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0xB5u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x07u, 0x00u,
-/* 1070 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0x94u, 0x11u, 0x11u, 0x97u, 0x0Bu, 0x97u, 0x0Bu, 0x00u, 0x04u,
-/* 1080 */	0xAFu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x08u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0x94u,
-/* 1090 */	0x11u, 0x11u, 0xBFu, 0x1Fu, 0xBFu, 0x1Fu, 0x00u, 0x04u, 0x96u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x09u, 0x00u,
-/* 10A0 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0x94u, 0x11u, 0x11u, 0x97u, 0x0Bu, 0x97u, 0x0Bu, 0x00u, 0x04u,
-/* 10B0 */	0x96u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x2Cu, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF8u,
-/* 10C0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
-/* 10D0 */	0x2Au, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF8u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 10E0 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x0Au, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xD4u,
-/* 10F0 */	0x00u, 0x50u, 0x00u, 0x00u, 0x00u, 0x1Fu, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x0Bu, 0x00u,
-/* 1100 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xD4u, 0x00u, 0x50u, 0x00u, 0x00u, 0x00u, 0x0Bu, 0x00u, 0x00u,
-/* 1110 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x0Cu, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xD4u,
-/* 1120 */	0x00u, 0x20u, 0x00u, 0x00u, 0x00u, 0x0Fu, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x0Cu, 0x00u,
-/* 1130 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1140 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x0Du, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xD4u,
-/* 1150 */	0x00u, 0x61u, 0x00u, 0x00u, 0x3Eu, 0x1Fu, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x0Eu, 0x00u,
-/* 1160 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0x94u, 0x66u, 0x66u, 0xBFu, 0x1Fu, 0xBFu, 0x1Fu, 0x00u, 0x04u,
-/* 1170 */	0xB7u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x0Fu, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u,
-/* 1180 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x10u, 0x00u,
-/* 1190 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
-/* 11A0 */	0xABu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x11u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
-/* 11B0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0xADu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x12u, 0x00u,
-/* 11C0 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 11D0 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0x9Cu,
-/* 11E0 */	0x11u, 0x11u, 0x16u, 0x0Bu, 0x16u, 0x0Bu, 0x00u, 0x04u, 0x9Au, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
-/* 11F0 */	0x09u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF8u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-
-			/* 8 sector. Workbook. */
-/* 1200 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x13u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xD4u,
-/* 1210 */	0x00u, 0x60u, 0x00u, 0x00u, 0x00u, 0x1Au, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x14u, 0x00u,
-/* 1220 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1230 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x2Bu, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF8u,
-/* 1240 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
-/* 1250 */	0x29u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF8u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1260 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x15u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
-/* 1270 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0xAAu, 0x20u, 0x7Cu, 0x08u, 0x14u, 0x00u, 0x7Cu, 0x08u,
-/* 1280 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x3Eu, 0x00u, 0xE9u, 0x6Fu,
-/* 1290 */	0xD5u, 0xD8u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 12A0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u,
-/* 12B0 */	0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u,
-/* 12C0 */	0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 12D0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u,
-/* 12E0 */	0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu,
-/* 12F0 */	0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1300 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u,
-/* 1310 */	0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du,
-/* 1320 */	0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1330 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u,
-/* 1340 */	0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u,
-/* 1350 */	0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1360 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u,
-/* 1370 */	0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu,
-/* 1380 */	0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u,
-/* 1390 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du,
-/* 13A0 */	0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u,
-/* 13B0 */	0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u,
-/* 13C0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u,
-/* 13D0 */	0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu,
-/* 13E0 */	0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u,
-/* 13F0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0x02u,
-
-			/* 9 sector. Workbook. */
-/* 1400 */	0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u,
-/* 1410 */	0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u,
-/* 1420 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x08u, 0x00u, 0x00u, 0x00u,
-/* 1430 */	0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu,
-/* 1440 */	0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du,
-/* 1450 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x09u, 0x00u, 0x00u,
-/* 1460 */	0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u,
-/* 1470 */	0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u,
-/* 1480 */	0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x0Au, 0x00u,
-/* 1490 */	0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u,
-/* 14A0 */	0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du,
-/* 14B0 */	0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x0Bu,
-/* 14C0 */	0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u,
-/* 14D0 */	0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u,
-/* 14E0 */	0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 14F0 */	0x0Cu, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u,
-/* 1500 */	0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du,
-/* 1510 */	0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1520 */	0x00u, 0x0Du, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u,
-/* 1530 */	0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u,
-/* 1540 */	0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1550 */	0x00u, 0x00u, 0x0Eu, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u,
-/* 1560 */	0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u,
-/* 1570 */	0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1580 */	0x00u, 0x00u, 0x00u, 0x0Fu, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u,
-/* 1590 */	0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u,
-/* 15A0 */	0x00u, 0x02u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 15B0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x10u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u,
-/* 15C0 */	0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u,
-/* 15D0 */	0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x65u, 0x66u, 0x04u, 0x00u, 0x00u, 0x00u, 0x23u,
-/* 15E0 */	0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u,
-/* 15F0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x11u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du,
-
-			/* 10 sector. Workbook. */
-/* 1600 */	0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u,
-/* 1610 */	0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x65u, 0x66u,
-/* 1620 */	0x05u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u,
-/* 1630 */	0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x12u, 0x00u,
-/* 1640 */	0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u,
-/* 1650 */	0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u,
-/* 1660 */	0x00u, 0x03u, 0x00u, 0x65u, 0x66u, 0x06u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u,
-/* 1670 */	0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1680 */	0x00u, 0x00u, 0x00u, 0x13u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u,
-/* 1690 */	0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u,
-/* 16A0 */	0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x65u, 0x66u, 0x07u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u,
-/* 16B0 */	0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 16C0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x14u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u,
-/* 16D0 */	0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu,
-/* 16E0 */	0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x65u, 0x66u, 0x08u,
-/* 16F0 */	0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du,
-/* 1700 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x15u, 0x00u, 0x00u,
-/* 1710 */	0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u,
-/* 1720 */	0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u,
-/* 1730 */	0x03u, 0x00u, 0x65u, 0x66u, 0x09u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u,
-/* 1740 */	0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1750 */	0x00u, 0x00u, 0x16u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u,
-/* 1760 */	0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u,
-/* 1770 */	0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0xCCu, 0x4Cu, 0x04u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u,
-/* 1780 */	0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1790 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x17u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u,
-/* 17A0 */	0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u,
-/* 17B0 */	0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0xCCu, 0x4Cu, 0x05u, 0x00u,
-/* 17C0 */	0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u,
-/* 17D0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x18u, 0x00u, 0x00u, 0x00u,
-/* 17E0 */	0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu,
-/* 17F0 */	0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u,
-
-			/* 11 sector. Workbook. */
-/* 1800 */	0x00u, 0xCCu, 0x4Cu, 0x06u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du,
-/* 1810 */	0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1820 */	0x00u, 0x19u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u,
-/* 1830 */	0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u,
-/* 1840 */	0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0xCCu, 0x4Cu, 0x07u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u,
-/* 1850 */	0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1860 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x1Au, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u,
-/* 1870 */	0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du,
-/* 1880 */	0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0xCCu, 0x4Cu, 0x08u, 0x00u, 0x00u,
-/* 1890 */	0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u,
-/* 18A0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x1Bu, 0x00u, 0x00u, 0x00u, 0x03u,
-/* 18B0 */	0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u,
-/* 18C0 */	0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u,
-/* 18D0 */	0xCCu, 0x4Cu, 0x09u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u,
-/* 18E0 */	0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 18F0 */	0x1Cu, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1900 */	0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u,
-/* 1910 */	0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x32u, 0x33u, 0x04u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu,
-/* 1920 */	0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1930 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x1Du, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u,
-/* 1940 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu,
-/* 1950 */	0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x32u, 0x33u, 0x05u, 0x00u, 0x00u, 0x00u,
-/* 1960 */	0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u,
-/* 1970 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x1Eu, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u,
-/* 1980 */	0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu,
-/* 1990 */	0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x32u,
-/* 19A0 */	0x33u, 0x06u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u,
-/* 19B0 */	0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x1Fu,
-/* 19C0 */	0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 19D0 */	0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u,
-/* 19E0 */	0x14u, 0x00u, 0x03u, 0x00u, 0x32u, 0x33u, 0x07u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u,
-/* 19F0 */	0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-
-			/* 12 sector. Workbook. */
-/* 1A00 */	0x00u, 0x00u, 0x00u, 0x00u, 0x20u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u,
-/* 1A10 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u,
-/* 1A20 */	0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x32u, 0x33u, 0x08u, 0x00u, 0x00u, 0x00u, 0x23u,
-/* 1A30 */	0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u,
-/* 1A40 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x21u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du,
-/* 1A50 */	0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u,
-/* 1A60 */	0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x32u, 0x33u,
-/* 1A70 */	0x09u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u,
-/* 1A80 */	0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x22u, 0x00u,
-/* 1A90 */	0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1AA0 */	0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u,
-/* 1AB0 */	0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x04u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u,
-/* 1AC0 */	0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1AD0 */	0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u,
-/* 1AE0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u,
-/* 1AF0 */	0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u,
-/* 1B00 */	0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1B10 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x24u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u,
-/* 1B20 */	0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu,
-/* 1B30 */	0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x06u,
-/* 1B40 */	0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du,
-/* 1B50 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x25u, 0x00u, 0x00u,
-/* 1B60 */	0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
-/* 1B70 */	0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u,
-/* 1B80 */	0x03u, 0x00u, 0x00u, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u,
-/* 1B90 */	0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1BA0 */	0x00u, 0x00u, 0x26u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u,
-/* 1BB0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u,
-/* 1BC0 */	0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x08u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u,
-/* 1BD0 */	0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1BE0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x27u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u,
-/* 1BF0 */	0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u,
-
-			/* 13 sector. Workbook. */
-/* 1C00 */	0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x09u, 0x00u,
-/* 1C10 */	0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x91u, 0x00u, 0x7Du, 0x08u,
-/* 1C20 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x28u, 0x00u, 0x00u, 0x00u,
-/* 1C30 */	0x07u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x76u, 0xFFu, 0x04u, 0x5Fu,
-/* 1C40 */	0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x02u,
-/* 1C50 */	0x00u, 0x00u, 0x00u, 0xFFu, 0xCCu, 0x99u, 0xFFu, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x07u,
-/* 1C60 */	0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x2Du, 0x00u, 0x3Bu, 0x00u, 0x5Fu,
-/* 1C70 */	0x00u, 0x2Du, 0x00u, 0x08u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x3Fu,
-/* 1C80 */	0x00u, 0x5Fu, 0x00u, 0x40u, 0x04u, 0x5Fu, 0x00u, 0x09u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x7Fu,
-/* 1C90 */	0x7Fu, 0x7Fu, 0xFFu, 0x40u, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x00u, 0x00u, 0x0Au, 0x00u, 0x14u, 0x00u, 0x02u,
-/* 1CA0 */	0x00u, 0x00u, 0x00u, 0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x7Du,
-/* 1CB0 */	0x08u, 0x91u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1CC0 */	0x00u, 0x29u, 0x00u, 0x00u, 0x00u, 0x07u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x3Fu,
-/* 1CD0 */	0x3Fu, 0x3Fu, 0xFFu, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u,
-/* 1CE0 */	0x04u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xF2u, 0xF2u, 0xF2u, 0xFFu, 0x23u, 0x00u, 0x30u, 0x00u,
-/* 1CF0 */	0x2Eu, 0x00u, 0x30u, 0x00u, 0x07u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x3Fu, 0xFFu,
-/* 1D00 */	0x2Du, 0x00u, 0x3Bu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x08u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u,
-/* 1D10 */	0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x3Fu, 0x00u, 0x5Fu, 0x00u, 0x40u, 0x04u, 0x5Fu, 0x00u, 0x09u, 0x00u, 0x14u, 0x00u,
-/* 1D20 */	0x02u, 0x00u, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x40u, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x00u, 0x00u,
-/* 1D30 */	0x0Au, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1D40 */	0x00u, 0x00u, 0x00u, 0x00u, 0x7Du, 0x08u, 0x91u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1D50 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x2Au, 0x00u, 0x00u, 0x00u, 0x07u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u,
-/* 1D60 */	0x02u, 0x00u, 0x00u, 0x00u, 0xFAu, 0x7Du, 0x00u, 0xFFu, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du,
-/* 1D70 */	0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xF2u, 0xF2u, 0xF2u,
-/* 1D80 */	0xFFu, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x07u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u,
-/* 1D90 */	0x00u, 0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x2Du, 0x00u, 0x3Bu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x08u, 0x00u, 0x14u,
-/* 1DA0 */	0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x3Fu, 0x00u, 0x5Fu, 0x00u, 0x40u, 0x04u, 0x5Fu,
-/* 1DB0 */	0x00u, 0x09u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x40u, 0x00u, 0x5Fu,
-/* 1DC0 */	0x00u, 0x2Du, 0x00u, 0x00u, 0x00u, 0x0Au, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x7Fu, 0x7Fu, 0x7Fu,
-/* 1DD0 */	0xFFu, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u,
-/* 1DE0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x2Bu, 0x00u, 0x00u, 0x00u, 0x02u,
-/* 1DF0 */	0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u,
-
-			/* 14 sector. Workbook. */
-/* 1E00 */	0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u,
-/* 1E10 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x2Cu, 0x00u, 0x00u, 0x00u,
-/* 1E20 */	0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu,
-/* 1E30 */	0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du,
-/* 1E40 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x2Du, 0x00u, 0x00u,
-/* 1E50 */	0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x04u,
-/* 1E60 */	0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x08u, 0x00u, 0x14u, 0x00u,
-/* 1E70 */	0x03u, 0x00u, 0x00u, 0x00u, 0x04u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u,
-/* 1E80 */	0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1E90 */	0x00u, 0x00u, 0x2Eu, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u,
-/* 1EA0 */	0x03u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u,
-/* 1EB0 */	0x02u, 0x08u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0xFFu, 0x3Fu, 0x04u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u,
-/* 1EC0 */	0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1ED0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x2Fu, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u,
-/* 1EE0 */	0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u,
-/* 1EF0 */	0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x08u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x32u, 0x33u, 0x04u, 0x00u,
-/* 1F00 */	0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u,
-/* 1F10 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x30u, 0x00u, 0x00u, 0x00u,
-/* 1F20 */	0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu,
-/* 1F30 */	0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x55u, 0x00u, 0x7Du,
-/* 1F40 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x31u, 0x00u, 0x00u,
-/* 1F50 */	0x00u, 0x04u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u,
-/* 1F60 */	0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x07u, 0x00u, 0x14u, 0x00u,
-/* 1F70 */	0x03u, 0x00u, 0x00u, 0x00u, 0x04u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u,
-/* 1F80 */	0x08u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x04u, 0x00u, 0x00u, 0x00u, 0x2Du, 0x00u, 0x3Bu, 0x00u,
-/* 1F90 */	0x5Fu, 0x00u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x91u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 1FA0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x32u, 0x00u, 0x00u, 0x00u, 0x07u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u,
-/* 1FB0 */	0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du,
-/* 1FC0 */	0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xA5u, 0xA5u, 0xA5u,
-/* 1FD0 */	0xFFu, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x07u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u,
-/* 1FE0 */	0x00u, 0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x2Du, 0x00u, 0x3Bu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x08u, 0x00u, 0x14u,
-/* 1FF0 */	0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x3Fu, 0x00u, 0x5Fu, 0x00u, 0x40u, 0x04u, 0x5Fu,
-
-			/* 15 sector. Workbook. */
-/* 2000 */	0x00u, 0x09u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x40u, 0x00u, 0x5Fu,
-/* 2010 */	0x00u, 0x2Du, 0x00u, 0x00u, 0x00u, 0x0Au, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x3Fu,
-/* 2020 */	0xFFu, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u,
-/* 2030 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x33u, 0x00u, 0x00u, 0x00u, 0x02u,
-/* 2040 */	0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u,
-/* 2050 */	0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x01u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u,
-/* 2060 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x34u, 0x00u, 0x00u, 0x00u,
-/* 2070 */	0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x9Cu, 0x65u, 0x00u, 0xFFu, 0x04u, 0x5Fu,
-/* 2080 */	0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x02u,
-/* 2090 */	0x00u, 0x00u, 0x00u, 0xFFu, 0xEBu, 0x9Cu, 0xFFu, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du,
-/* 20A0 */	0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 20B0 */	0x00u, 0x35u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x9Cu,
-/* 20C0 */	0x00u, 0x06u, 0xFFu, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u,
-/* 20D0 */	0x04u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xFFu, 0xC7u, 0xCEu, 0xFFu, 0x23u, 0x00u, 0x30u, 0x00u,
-/* 20E0 */	0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 20F0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x36u, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u,
-/* 2100 */	0x02u, 0x00u, 0x00u, 0x00u, 0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du,
-/* 2110 */	0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x91u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 2120 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x37u, 0x00u, 0x00u, 0x00u, 0x07u, 0x00u, 0x0Du, 0x00u, 0x14u,
-/* 2130 */	0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u,
-/* 2140 */	0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu,
-/* 2150 */	0xCCu, 0xFFu, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x07u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u,
-/* 2160 */	0x00u, 0x00u, 0xB2u, 0xB2u, 0xB2u, 0xFFu, 0x2Du, 0x00u, 0x3Bu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x08u, 0x00u,
-/* 2170 */	0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xB2u, 0xB2u, 0xB2u, 0xFFu, 0x3Fu, 0x00u, 0x5Fu, 0x00u, 0x40u, 0x04u,
-/* 2180 */	0x5Fu, 0x00u, 0x09u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xB2u, 0xB2u, 0xB2u, 0xFFu, 0x40u, 0x00u,
-/* 2190 */	0x5Fu, 0x00u, 0x2Du, 0x00u, 0x00u, 0x00u, 0x0Au, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xB2u, 0xB2u,
-/* 21A0 */	0xB2u, 0xFFu, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u,
-/* 21B0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x38u, 0x00u, 0x00u, 0x00u,
-/* 21C0 */	0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu,
-/* 21D0 */	0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du,
-/* 21E0 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x39u, 0x00u, 0x00u,
-/* 21F0 */	0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xFAu, 0x7Du, 0x00u, 0xFFu, 0x04u,
-
-			/* 16 sector. Workbook. */
-/* 2200 */	0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x08u, 0x00u, 0x14u, 0x00u,
-/* 2210 */	0x02u, 0x00u, 0x00u, 0x00u, 0xFFu, 0x80u, 0x01u, 0xFFu, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u,
-/* 2220 */	0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 2230 */	0x00u, 0x00u, 0x3Au, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u,
-/* 2240 */	0xFFu, 0x00u, 0x00u, 0xFFu, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u,
-/* 2250 */	0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 2260 */	0x00u, 0x00u, 0x00u, 0x3Bu, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u,
-/* 2270 */	0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u,
-/* 2280 */	0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 2290 */	0x00u, 0x00u, 0x00u, 0x00u, 0x3Cu, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u,
-/* 22A0 */	0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u,
-/* 22B0 */	0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 22C0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x3Du, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x02u,
-/* 22D0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x61u, 0x00u, 0xFFu, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu,
-/* 22E0 */	0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xC6u, 0xEFu, 0xCEu, 0xFFu,
-/* 22F0 */	0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x93u, 0x02u, 0x1Fu, 0x00u, 0x10u, 0x00u, 0x0Du, 0x00u,
-/* 2300 */	0x01u, 0x32u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au,
-/* 2310 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x31u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u,
-/* 2320 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x1Eu, 0xFFu, 0x0Du,
-/* 2330 */	0x00u, 0x32u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au,
-/* 2340 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x31u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u,
-/* 2350 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x04u, 0x65u, 0x66u, 0xDBu, 0xE5u, 0xF1u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u,
-/* 2360 */	0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u,
-/* 2370 */	0x11u, 0x00u, 0x0Du, 0x00u, 0x01u, 0x32u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u,
-/* 2380 */	0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x32u, 0x00u, 0x92u,
-/* 2390 */	0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u,
-/* 23A0 */	0x04u, 0x22u, 0xFFu, 0x0Du, 0x00u, 0x32u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u,
-/* 23B0 */	0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x32u, 0x00u, 0x00u,
-/* 23C0 */	0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x05u, 0x65u, 0x66u, 0xF2u, 0xDDu, 0xDCu, 0xFFu, 0x05u,
-/* 23D0 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u,
-/* 23E0 */	0x93u, 0x02u, 0x1Fu, 0x00u, 0x12u, 0x00u, 0x0Du, 0x00u, 0x01u, 0x32u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u,
-/* 23F0 */	0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u,
-
-			/* 17 sector. Workbook. */
-/* 2400 */	0x04u, 0x33u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 2410 */	0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x26u, 0xFFu, 0x0Du, 0x00u, 0x32u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u,
-/* 2420 */	0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u,
-/* 2430 */	0x04u, 0x33u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x06u, 0x65u, 0x66u, 0xEAu,
-/* 2440 */	0xF1u, 0xDDu, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0x25u,
-/* 2450 */	0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u, 0x13u, 0x00u, 0x0Du, 0x00u, 0x01u, 0x32u, 0x00u, 0x30u,
-/* 2460 */	0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
-/* 2470 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x34u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u,
-/* 2480 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x2Au, 0xFFu, 0x0Du, 0x00u, 0x32u, 0x00u, 0x30u,
-/* 2490 */	0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
-/* 24A0 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x34u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u,
-/* 24B0 */	0x07u, 0x65u, 0x66u, 0xE5u, 0xE0u, 0xECu, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x01u, 0x00u, 0x00u, 0x00u,
-/* 24C0 */	0x00u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u, 0x14u, 0x00u, 0x0Du, 0x00u,
-/* 24D0 */	0x01u, 0x32u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au,
-/* 24E0 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x35u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u,
-/* 24F0 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x2Eu, 0xFFu, 0x0Du,
-/* 2500 */	0x00u, 0x32u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au,
-/* 2510 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x35u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u,
-/* 2520 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x08u, 0x65u, 0x66u, 0xDBu, 0xEEu, 0xF3u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u,
-/* 2530 */	0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u,
-/* 2540 */	0x15u, 0x00u, 0x0Du, 0x00u, 0x01u, 0x32u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u,
-/* 2550 */	0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x36u, 0x00u, 0x92u,
-/* 2560 */	0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u,
-/* 2570 */	0x04u, 0x32u, 0xFFu, 0x0Du, 0x00u, 0x32u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u,
-/* 2580 */	0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x36u, 0x00u, 0x00u,
-/* 2590 */	0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x09u, 0x65u, 0x66u, 0xFDu, 0xE9u, 0xD9u, 0xFFu, 0x05u,
-/* 25A0 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u,
-/* 25B0 */	0x93u, 0x02u, 0x1Fu, 0x00u, 0x16u, 0x00u, 0x0Du, 0x00u, 0x01u, 0x34u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u,
-/* 25C0 */	0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u,
-/* 25D0 */	0x04u, 0x31u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 25E0 */	0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x1Fu, 0xFFu, 0x0Du, 0x00u, 0x34u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u,
-/* 25F0 */	0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u,
-
-			/* 18 sector. Workbook. */
-/* 2600 */	0x04u, 0x31u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x04u, 0xCCu, 0x4Cu, 0xB8u,
-/* 2610 */	0xCCu, 0xE4u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0x25u,
-/* 2620 */	0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u, 0x17u, 0x00u, 0x0Du, 0x00u, 0x01u, 0x34u, 0x00u, 0x30u,
-/* 2630 */	0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
-/* 2640 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x32u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u,
-/* 2650 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x23u, 0xFFu, 0x0Du, 0x00u, 0x34u, 0x00u, 0x30u,
-/* 2660 */	0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
-/* 2670 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x32u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u,
-/* 2680 */	0x05u, 0xCCu, 0x4Cu, 0xE6u, 0xB9u, 0xB8u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x01u, 0x00u, 0x00u, 0x00u,
-/* 2690 */	0x00u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u, 0x18u, 0x00u, 0x0Du, 0x00u,
-/* 26A0 */	0x01u, 0x34u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au,
-/* 26B0 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x33u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u,
-/* 26C0 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x27u, 0xFFu, 0x0Du,
-/* 26D0 */	0x00u, 0x34u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au,
-/* 26E0 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x33u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u,
-/* 26F0 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x06u, 0xCCu, 0x4Cu, 0xD7u, 0xE4u, 0xBCu, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u,
-/* 2700 */	0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u,
-/* 2710 */	0x19u, 0x00u, 0x0Du, 0x00u, 0x01u, 0x34u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u,
-/* 2720 */	0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x34u, 0x00u, 0x92u,
-/* 2730 */	0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u,
-/* 2740 */	0x04u, 0x2Bu, 0xFFu, 0x0Du, 0x00u, 0x34u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u,
-/* 2750 */	0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x34u, 0x00u, 0x00u,
-/* 2760 */	0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x07u, 0xCCu, 0x4Cu, 0xCCu, 0xC0u, 0xDAu, 0xFFu, 0x05u,
-/* 2770 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u,
-/* 2780 */	0x93u, 0x02u, 0x1Fu, 0x00u, 0x1Au, 0x00u, 0x0Du, 0x00u, 0x01u, 0x34u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u,
-/* 2790 */	0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u,
-/* 27A0 */	0x04u, 0x35u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 27B0 */	0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x2Fu, 0xFFu, 0x0Du, 0x00u, 0x34u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u,
-/* 27C0 */	0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u,
-/* 27D0 */	0x04u, 0x35u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x08u, 0xCCu, 0x4Cu, 0xB6u,
-/* 27E0 */	0xDDu, 0xE8u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0x25u,
-/* 27F0 */	0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u, 0x1Bu, 0x00u, 0x0Du, 0x00u, 0x01u, 0x34u, 0x00u, 0x30u,
-
-			/* 19 sector. Workbook. */
-/* 2800 */	0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
-/* 2810 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x36u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u,
-/* 2820 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x33u, 0xFFu, 0x0Du, 0x00u, 0x34u, 0x00u, 0x30u,
-/* 2830 */	0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
-/* 2840 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x36u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u,
-/* 2850 */	0x09u, 0xCCu, 0x4Cu, 0xFCu, 0xD5u, 0xB4u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x01u, 0x00u, 0x00u, 0x00u,
-/* 2860 */	0x00u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u, 0x1Cu, 0x00u, 0x0Du, 0x00u,
-/* 2870 */	0x01u, 0x36u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au,
-/* 2880 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x31u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u,
-/* 2890 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x20u, 0xFFu, 0x0Du,
-/* 28A0 */	0x00u, 0x36u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au,
-/* 28B0 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x31u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u,
-/* 28C0 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x04u, 0x32u, 0x33u, 0x95u, 0xB3u, 0xD7u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u,
-/* 28D0 */	0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u,
-/* 28E0 */	0x1Du, 0x00u, 0x0Du, 0x00u, 0x01u, 0x36u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u,
-/* 28F0 */	0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x32u, 0x00u, 0x92u,
-/* 2900 */	0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u,
-/* 2910 */	0x04u, 0x24u, 0xFFu, 0x0Du, 0x00u, 0x36u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u,
-/* 2920 */	0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x32u, 0x00u, 0x00u,
-/* 2930 */	0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x05u, 0x32u, 0x33u, 0xD9u, 0x97u, 0x95u, 0xFFu, 0x05u,
-/* 2940 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u,
-/* 2950 */	0x93u, 0x02u, 0x1Fu, 0x00u, 0x1Eu, 0x00u, 0x0Du, 0x00u, 0x01u, 0x36u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u,
-/* 2960 */	0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u,
-/* 2970 */	0x04u, 0x33u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 2980 */	0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x28u, 0xFFu, 0x0Du, 0x00u, 0x36u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u,
-/* 2990 */	0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u,
-/* 29A0 */	0x04u, 0x33u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x06u, 0x32u, 0x33u, 0xC2u,
-/* 29B0 */	0xD6u, 0x9Au, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x25u,
-/* 29C0 */	0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u, 0x1Fu, 0x00u, 0x0Du, 0x00u, 0x01u, 0x36u, 0x00u, 0x30u,
-/* 29D0 */	0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
-/* 29E0 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x34u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u,
-/* 29F0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x2Cu, 0xFFu, 0x0Du, 0x00u, 0x36u, 0x00u, 0x30u,
-
-			/* 20 sector. Workbook. */
-/* 2A00 */	0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
-/* 2A10 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x34u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u,
-/* 2A20 */	0x07u, 0x32u, 0x33u, 0xB2u, 0xA1u, 0xC7u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0xFFu,
-/* 2A30 */	0xFFu, 0xFFu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u, 0x20u, 0x00u, 0x0Du, 0x00u,
-/* 2A40 */	0x01u, 0x36u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au,
-/* 2A50 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x35u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u,
-/* 2A60 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x30u, 0xFFu, 0x0Du,
-/* 2A70 */	0x00u, 0x36u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au,
-/* 2A80 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x35u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u,
-/* 2A90 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x08u, 0x32u, 0x33u, 0x93u, 0xCDu, 0xDDu, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u,
-/* 2AA0 */	0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u,
-/* 2AB0 */	0x21u, 0x00u, 0x0Du, 0x00u, 0x01u, 0x36u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u,
-/* 2AC0 */	0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x36u, 0x00u, 0x92u,
-/* 2AD0 */	0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u,
-/* 2AE0 */	0x04u, 0x34u, 0xFFu, 0x0Du, 0x00u, 0x36u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u,
-/* 2AF0 */	0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x36u, 0x00u, 0x00u,
-/* 2B00 */	0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x09u, 0x32u, 0x33u, 0xFAu, 0xC0u, 0x90u, 0xFFu, 0x05u,
-/* 2B10 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u,
-/* 2B20 */	0x93u, 0x02u, 0x13u, 0x00u, 0x22u, 0x00u, 0x07u, 0x00u, 0x01u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
-/* 2B30 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x31u, 0x00u, 0x92u, 0x08u, 0x41u, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u,
-/* 2B40 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x1Du, 0xFFu, 0x07u, 0x00u, 0x10u, 0x04u, 0x3Au,
-/* 2B50 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x31u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u,
-/* 2B60 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x04u, 0x00u, 0x00u, 0x4Fu, 0x81u, 0xBDu, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u,
-/* 2B70 */	0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x13u, 0x00u,
-/* 2B80 */	0x23u, 0x00u, 0x07u, 0x00u, 0x01u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u,
-/* 2B90 */	0x04u, 0x32u, 0x00u, 0x92u, 0x08u, 0x41u, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 2BA0 */	0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x21u, 0xFFu, 0x07u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
-/* 2BB0 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x32u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u,
-/* 2BC0 */	0x05u, 0x00u, 0x00u, 0xC0u, 0x50u, 0x4Du, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0xFFu,
-/* 2BD0 */	0xFFu, 0xFFu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x13u, 0x00u, 0x24u, 0x00u, 0x07u, 0x00u,
-/* 2BE0 */	0x01u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x33u, 0x00u, 0x92u,
-/* 2BF0 */	0x08u, 0x41u, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u,
-
-			/* 21 sector. Workbook. */
-/* 2C00 */	0x04u, 0x25u, 0xFFu, 0x07u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u,
-/* 2C10 */	0x04u, 0x33u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x06u, 0x00u, 0x00u, 0x9Bu,
-/* 2C20 */	0xBBu, 0x59u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x25u,
-/* 2C30 */	0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x13u, 0x00u, 0x25u, 0x00u, 0x07u, 0x00u, 0x01u, 0x10u, 0x04u, 0x3Au,
-/* 2C40 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x34u, 0x00u, 0x92u, 0x08u, 0x41u, 0x00u, 0x92u,
-/* 2C50 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x29u, 0xFFu, 0x07u,
-/* 2C60 */	0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x34u, 0x00u, 0x00u,
-/* 2C70 */	0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x07u, 0x00u, 0x00u, 0x80u, 0x64u, 0xA2u, 0xFFu, 0x05u,
-/* 2C80 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u,
-/* 2C90 */	0x93u, 0x02u, 0x13u, 0x00u, 0x26u, 0x00u, 0x07u, 0x00u, 0x01u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
-/* 2CA0 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x35u, 0x00u, 0x92u, 0x08u, 0x41u, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u,
-/* 2CB0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x2Du, 0xFFu, 0x07u, 0x00u, 0x10u, 0x04u, 0x3Au,
-/* 2CC0 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x35u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u,
-/* 2CD0 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x08u, 0x00u, 0x00u, 0x4Bu, 0xACu, 0xC6u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u,
-/* 2CE0 */	0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x13u, 0x00u,
-/* 2CF0 */	0x27u, 0x00u, 0x07u, 0x00u, 0x01u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u,
-/* 2D00 */	0x04u, 0x36u, 0x00u, 0x92u, 0x08u, 0x41u, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 2D10 */	0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x31u, 0xFFu, 0x07u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
-/* 2D20 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x36u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u,
-/* 2D30 */	0x09u, 0x00u, 0x00u, 0xF7u, 0x96u, 0x46u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0xFFu,
-/* 2D40 */	0xFFu, 0xFFu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x0Fu, 0x00u, 0x28u, 0x00u, 0x05u, 0x00u,
-/* 2D50 */	0x01u, 0x12u, 0x04u, 0x32u, 0x04u, 0x3Eu, 0x04u, 0x34u, 0x04u, 0x20u, 0x00u, 0x92u, 0x08u, 0x75u, 0x00u, 0x92u,
-/* 2D60 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x02u, 0x14u, 0xFFu, 0x05u,
-/* 2D70 */	0x00u, 0x12u, 0x04u, 0x32u, 0x04u, 0x3Eu, 0x04u, 0x34u, 0x04u, 0x20u, 0x00u, 0x00u, 0x00u, 0x07u, 0x00u, 0x01u,
-/* 2D80 */	0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0xFFu, 0xCCu, 0x99u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x05u,
-/* 2D90 */	0xFFu, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x76u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x06u, 0x00u, 0x0Eu, 0x00u,
-/* 2DA0 */	0x05u, 0xFFu, 0x00u, 0x00u, 0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x01u, 0x00u, 0x07u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu,
-/* 2DB0 */	0x00u, 0x00u, 0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x01u, 0x00u, 0x08u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u,
-/* 2DC0 */	0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x01u, 0x00u, 0x09u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x7Fu, 0x7Fu,
-/* 2DD0 */	0x7Fu, 0xFFu, 0x01u, 0x00u, 0x93u, 0x02u, 0x0Fu, 0x00u, 0x29u, 0x00u, 0x05u, 0x00u, 0x01u, 0x12u, 0x04u, 0x4Bu,
-/* 2DE0 */	0x04u, 0x32u, 0x04u, 0x3Eu, 0x04u, 0x34u, 0x04u, 0x92u, 0x08u, 0x75u, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u,
-/* 2DF0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x02u, 0x15u, 0xFFu, 0x05u, 0x00u, 0x12u, 0x04u, 0x4Bu,
-
-			/* 22 sector. Workbook. */
-/* 2E00 */	0x04u, 0x32u, 0x04u, 0x3Eu, 0x04u, 0x34u, 0x04u, 0x00u, 0x00u, 0x07u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x05u,
-/* 2E10 */	0xFFu, 0x00u, 0x00u, 0xF2u, 0xF2u, 0xF2u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x3Fu,
-/* 2E20 */	0x3Fu, 0x3Fu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x06u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u,
-/* 2E30 */	0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x01u, 0x00u, 0x07u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x3Fu, 0x3Fu,
-/* 2E40 */	0x3Fu, 0xFFu, 0x01u, 0x00u, 0x08u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x3Fu, 0xFFu,
-/* 2E50 */	0x01u, 0x00u, 0x09u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x01u, 0x00u,
-/* 2E60 */	0x93u, 0x02u, 0x19u, 0x00u, 0x2Au, 0x00u, 0x0Au, 0x00u, 0x01u, 0x12u, 0x04u, 0x4Bu, 0x04u, 0x47u, 0x04u, 0x38u,
-/* 2E70 */	0x04u, 0x41u, 0x04u, 0x3Bu, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x38u, 0x04u, 0x35u, 0x04u, 0x92u, 0x08u, 0x7Fu,
-/* 2E80 */	0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x02u, 0x16u,
-/* 2E90 */	0xFFu, 0x0Au, 0x00u, 0x12u, 0x04u, 0x4Bu, 0x04u, 0x47u, 0x04u, 0x38u, 0x04u, 0x41u, 0x04u, 0x3Bu, 0x04u, 0x35u,
-/* 2EA0 */	0x04u, 0x3Du, 0x04u, 0x38u, 0x04u, 0x35u, 0x04u, 0x00u, 0x00u, 0x07u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x05u,
-/* 2EB0 */	0xFFu, 0x00u, 0x00u, 0xF2u, 0xF2u, 0xF2u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0xFAu,
-/* 2EC0 */	0x7Du, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x06u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u,
-/* 2ED0 */	0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x01u, 0x00u, 0x07u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x7Fu, 0x7Fu,
-/* 2EE0 */	0x7Fu, 0xFFu, 0x01u, 0x00u, 0x08u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x7Fu, 0x7Fu, 0x7Fu, 0xFFu,
-/* 2EF0 */	0x01u, 0x00u, 0x09u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x01u, 0x00u,
-/* 2F00 */	0x93u, 0x02u, 0x04u, 0x00u, 0x2Bu, 0x80u, 0x04u, 0xFFu, 0x92u, 0x08u, 0x26u, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u,
-/* 2F10 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x05u, 0x04u, 0xFFu, 0x08u, 0x00u, 0x14u, 0x04u,
-/* 2F20 */	0x35u, 0x04u, 0x3Du, 0x04u, 0x35u, 0x04u, 0x36u, 0x04u, 0x3Du, 0x04u, 0x4Bu, 0x04u, 0x39u, 0x04u, 0x00u, 0x00u,
-/* 2F30 */	0x00u, 0x00u, 0x93u, 0x02u, 0x04u, 0x00u, 0x2Cu, 0x80u, 0x07u, 0xFFu, 0x92u, 0x08u, 0x2Eu, 0x00u, 0x92u, 0x08u,
-/* 2F40 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x05u, 0x07u, 0xFFu, 0x0Cu, 0x00u,
-/* 2F50 */	0x14u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x35u, 0x04u, 0x36u, 0x04u, 0x3Du, 0x04u, 0x4Bu, 0x04u, 0x39u, 0x04u,
-/* 2F60 */	0x20u, 0x00u, 0x5Bu, 0x00u, 0x30u, 0x00u, 0x5Du, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x93u, 0x02u, 0x1Bu, 0x00u,
-/* 2F70 */	0x2Du, 0x00u, 0x0Bu, 0x00u, 0x01u, 0x17u, 0x04u, 0x30u, 0x04u, 0x33u, 0x04u, 0x3Eu, 0x04u, 0x3Bu, 0x04u, 0x3Eu,
-/* 2F80 */	0x04u, 0x32u, 0x04u, 0x3Eu, 0x04u, 0x3Au, 0x04u, 0x20u, 0x00u, 0x31u, 0x00u, 0x92u, 0x08u, 0x4Bu, 0x00u, 0x92u,
-/* 2F90 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x03u, 0x10u, 0xFFu, 0x0Bu,
-/* 2FA0 */	0x00u, 0x17u, 0x04u, 0x30u, 0x04u, 0x33u, 0x04u, 0x3Eu, 0x04u, 0x3Bu, 0x04u, 0x3Eu, 0x04u, 0x32u, 0x04u, 0x3Eu,
-/* 2FB0 */	0x04u, 0x3Au, 0x04u, 0x20u, 0x00u, 0x31u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u,
-/* 2FC0 */	0x03u, 0x00u, 0x00u, 0x1Fu, 0x49u, 0x7Du, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x07u, 0x00u, 0x0Eu, 0x00u,
-/* 2FD0 */	0x07u, 0x04u, 0x00u, 0x00u, 0x4Fu, 0x81u, 0xBDu, 0xFFu, 0x05u, 0x00u, 0x93u, 0x02u, 0x1Bu, 0x00u, 0x2Eu, 0x00u,
-/* 2FE0 */	0x0Bu, 0x00u, 0x01u, 0x17u, 0x04u, 0x30u, 0x04u, 0x33u, 0x04u, 0x3Eu, 0x04u, 0x3Bu, 0x04u, 0x3Eu, 0x04u, 0x32u,
-/* 2FF0 */	0x04u, 0x3Eu, 0x04u, 0x3Au, 0x04u, 0x20u, 0x00u, 0x32u, 0x00u, 0x92u, 0x08u, 0x4Bu, 0x00u, 0x92u, 0x08u, 0x00u,
-
-			/* 23 sector. Workbook. */
-/* 3000 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x03u, 0x11u, 0xFFu, 0x0Bu, 0x00u, 0x17u,
-/* 3010 */	0x04u, 0x30u, 0x04u, 0x33u, 0x04u, 0x3Eu, 0x04u, 0x3Bu, 0x04u, 0x3Eu, 0x04u, 0x32u, 0x04u, 0x3Eu, 0x04u, 0x3Au,
-/* 3020 */	0x04u, 0x20u, 0x00u, 0x32u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x03u, 0x00u,
-/* 3030 */	0x00u, 0x1Fu, 0x49u, 0x7Du, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x07u, 0x00u, 0x0Eu, 0x00u, 0x07u, 0x04u,
-/* 3040 */	0xFFu, 0x3Fu, 0xA8u, 0xC0u, 0xDEu, 0xFFu, 0x05u, 0x00u, 0x93u, 0x02u, 0x1Bu, 0x00u, 0x2Fu, 0x00u, 0x0Bu, 0x00u,
-/* 3050 */	0x01u, 0x17u, 0x04u, 0x30u, 0x04u, 0x33u, 0x04u, 0x3Eu, 0x04u, 0x3Bu, 0x04u, 0x3Eu, 0x04u, 0x32u, 0x04u, 0x3Eu,
-/* 3060 */	0x04u, 0x3Au, 0x04u, 0x20u, 0x00u, 0x33u, 0x00u, 0x92u, 0x08u, 0x4Bu, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u,
-/* 3070 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x03u, 0x12u, 0xFFu, 0x0Bu, 0x00u, 0x17u, 0x04u, 0x30u,
-/* 3080 */	0x04u, 0x33u, 0x04u, 0x3Eu, 0x04u, 0x3Bu, 0x04u, 0x3Eu, 0x04u, 0x32u, 0x04u, 0x3Eu, 0x04u, 0x3Au, 0x04u, 0x20u,
-/* 3090 */	0x00u, 0x33u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x03u, 0x00u, 0x00u, 0x1Fu,
-/* 30A0 */	0x49u, 0x7Du, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x07u, 0x00u, 0x0Eu, 0x00u, 0x07u, 0x04u, 0x32u, 0x33u,
-/* 30B0 */	0x95u, 0xB3u, 0xD7u, 0xFFu, 0x02u, 0x00u, 0x93u, 0x02u, 0x1Bu, 0x00u, 0x30u, 0x00u, 0x0Bu, 0x00u, 0x01u, 0x17u,
-/* 30C0 */	0x04u, 0x30u, 0x04u, 0x33u, 0x04u, 0x3Eu, 0x04u, 0x3Bu, 0x04u, 0x3Eu, 0x04u, 0x32u, 0x04u, 0x3Eu, 0x04u, 0x3Au,
-/* 30D0 */	0x04u, 0x20u, 0x00u, 0x34u, 0x00u, 0x92u, 0x08u, 0x3Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 30E0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x03u, 0x13u, 0xFFu, 0x0Bu, 0x00u, 0x17u, 0x04u, 0x30u, 0x04u, 0x33u,
-/* 30F0 */	0x04u, 0x3Eu, 0x04u, 0x3Bu, 0x04u, 0x3Eu, 0x04u, 0x32u, 0x04u, 0x3Eu, 0x04u, 0x3Au, 0x04u, 0x20u, 0x00u, 0x34u,
-/* 3100 */	0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x03u, 0x00u, 0x00u, 0x1Fu, 0x49u, 0x7Du,
-/* 3110 */	0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x0Du, 0x00u, 0x31u, 0x00u, 0x04u, 0x00u, 0x01u, 0x18u,
-/* 3120 */	0x04u, 0x42u, 0x04u, 0x3Eu, 0x04u, 0x33u, 0x04u, 0x92u, 0x08u, 0x4Bu, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u,
-/* 3130 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x03u, 0x19u, 0xFFu, 0x04u, 0x00u, 0x18u, 0x04u, 0x42u,
-/* 3140 */	0x04u, 0x3Eu, 0x04u, 0x33u, 0x04u, 0x00u, 0x00u, 0x04u, 0x00u, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x01u, 0x00u,
-/* 3150 */	0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x06u, 0x00u, 0x0Eu, 0x00u, 0x07u, 0x04u,
-/* 3160 */	0x00u, 0x00u, 0x4Fu, 0x81u, 0xBDu, 0xFFu, 0x01u, 0x00u, 0x07u, 0x00u, 0x0Eu, 0x00u, 0x07u, 0x04u, 0x00u, 0x00u,
-/* 3170 */	0x4Fu, 0x81u, 0xBDu, 0xFFu, 0x06u, 0x00u, 0x93u, 0x02u, 0x29u, 0x00u, 0x32u, 0x00u, 0x12u, 0x00u, 0x01u, 0x1Au,
-/* 3180 */	0x04u, 0x3Eu, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x40u, 0x04u, 0x3Eu, 0x04u, 0x3Bu, 0x04u, 0x4Cu, 0x04u, 0x3Du,
-/* 3190 */	0x04u, 0x30u, 0x04u, 0x4Fu, 0x04u, 0x20u, 0x00u, 0x4Fu, 0x04u, 0x47u, 0x04u, 0x35u, 0x04u, 0x39u, 0x04u, 0x3Au,
-/* 31A0 */	0x04u, 0x30u, 0x04u, 0x92u, 0x08u, 0x8Fu, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 31B0 */	0x00u, 0x00u, 0x00u, 0x01u, 0x02u, 0x17u, 0xFFu, 0x12u, 0x00u, 0x1Au, 0x04u, 0x3Eu, 0x04u, 0x3Du, 0x04u, 0x42u,
-/* 31C0 */	0x04u, 0x40u, 0x04u, 0x3Eu, 0x04u, 0x3Bu, 0x04u, 0x4Cu, 0x04u, 0x3Du, 0x04u, 0x30u, 0x04u, 0x4Fu, 0x04u, 0x20u,
-/* 31D0 */	0x00u, 0x4Fu, 0x04u, 0x47u, 0x04u, 0x35u, 0x04u, 0x39u, 0x04u, 0x3Au, 0x04u, 0x30u, 0x04u, 0x00u, 0x00u, 0x07u,
-/* 31E0 */	0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0xA5u, 0xA5u, 0xA5u, 0xFFu, 0x05u, 0x00u, 0x0Cu,
-/* 31F0 */	0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x06u, 0x00u,
-
-			/* 24 sector. Workbook. */
-/* 3200 */	0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x06u, 0x00u, 0x07u, 0x00u, 0x0Eu, 0x00u,
-/* 3210 */	0x05u, 0xFFu, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x06u, 0x00u, 0x08u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu,
-/* 3220 */	0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x06u, 0x00u, 0x09u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u,
-/* 3230 */	0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x06u, 0x00u, 0x93u, 0x02u, 0x15u, 0x00u, 0x33u, 0x00u, 0x08u, 0x00u, 0x01u, 0x1Du,
-/* 3240 */	0x04u, 0x30u, 0x04u, 0x37u, 0x04u, 0x32u, 0x04u, 0x30u, 0x04u, 0x3Du, 0x04u, 0x38u, 0x04u, 0x35u, 0x04u, 0x92u,
-/* 3250 */	0x08u, 0x37u, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u,
-/* 3260 */	0x03u, 0x0Fu, 0xFFu, 0x08u, 0x00u, 0x1Du, 0x04u, 0x30u, 0x04u, 0x37u, 0x04u, 0x32u, 0x04u, 0x30u, 0x04u, 0x3Du,
-/* 3270 */	0x04u, 0x38u, 0x04u, 0x35u, 0x04u, 0x00u, 0x00u, 0x02u, 0x00u, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x03u, 0x00u,
-/* 3280 */	0x00u, 0x1Fu, 0x49u, 0x7Du, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x01u, 0x93u, 0x02u, 0x1Bu, 0x00u, 0x34u, 0x00u,
-/* 3290 */	0x0Bu, 0x00u, 0x01u, 0x1Du, 0x04u, 0x35u, 0x04u, 0x39u, 0x04u, 0x42u, 0x04u, 0x40u, 0x04u, 0x30u, 0x04u, 0x3Bu,
-/* 32A0 */	0x04u, 0x4Cu, 0x04u, 0x3Du, 0x04u, 0x4Bu, 0x04u, 0x39u, 0x04u, 0x92u, 0x08u, 0x49u, 0x00u, 0x92u, 0x08u, 0x00u,
-/* 32B0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x01u, 0x1Cu, 0xFFu, 0x0Bu, 0x00u, 0x1Du,
-/* 32C0 */	0x04u, 0x35u, 0x04u, 0x39u, 0x04u, 0x42u, 0x04u, 0x40u, 0x04u, 0x30u, 0x04u, 0x3Bu, 0x04u, 0x4Cu, 0x04u, 0x3Du,
-/* 32D0 */	0x04u, 0x4Bu, 0x04u, 0x39u, 0x04u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u,
-/* 32E0 */	0x00u, 0xFFu, 0xEBu, 0x9Cu, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x9Cu, 0x65u, 0x00u,
-/* 32F0 */	0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x04u, 0x00u, 0x00u, 0x80u, 0x00u, 0xFFu, 0x92u, 0x08u,
-/* 3300 */	0x35u, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x01u,
-/* 3310 */	0x00u, 0xFFu, 0x07u, 0x00u, 0x1Eu, 0x04u, 0x31u, 0x04u, 0x4Bu, 0x04u, 0x47u, 0x04u, 0x3Du, 0x04u, 0x4Bu, 0x04u,
-/* 3320 */	0x39u, 0x04u, 0x00u, 0x00u, 0x02u, 0x00u, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3330 */	0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x11u, 0x00u, 0x35u, 0x00u, 0x06u, 0x00u, 0x01u,
-/* 3340 */	0x1Fu, 0x04u, 0x3Bu, 0x04u, 0x3Eu, 0x04u, 0x45u, 0x04u, 0x3Eu, 0x04u, 0x39u, 0x04u, 0x92u, 0x08u, 0x3Fu, 0x00u,
-/* 3350 */	0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x01u, 0x1Bu, 0xFFu,
-/* 3360 */	0x06u, 0x00u, 0x1Fu, 0x04u, 0x3Bu, 0x04u, 0x3Eu, 0x04u, 0x45u, 0x04u, 0x3Eu, 0x04u, 0x39u, 0x04u, 0x00u, 0x00u,
-/* 3370 */	0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0xFFu, 0xC7u, 0xCEu, 0xFFu, 0x05u, 0x00u,
-/* 3380 */	0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x9Cu, 0x00u, 0x06u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u,
-/* 3390 */	0x02u, 0x17u, 0x00u, 0x36u, 0x00u, 0x09u, 0x00u, 0x01u, 0x1Fu, 0x04u, 0x3Eu, 0x04u, 0x4Fu, 0x04u, 0x41u, 0x04u,
-/* 33A0 */	0x3Du, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x38u, 0x04u, 0x35u, 0x04u, 0x92u, 0x08u, 0x39u, 0x00u, 0x92u, 0x08u,
-/* 33B0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x02u, 0x35u, 0xFFu, 0x09u, 0x00u,
-/* 33C0 */	0x1Fu, 0x04u, 0x3Eu, 0x04u, 0x4Fu, 0x04u, 0x41u, 0x04u, 0x3Du, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x38u, 0x04u,
-/* 33D0 */	0x35u, 0x04u, 0x00u, 0x00u, 0x02u, 0x00u, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x7Fu, 0x7Fu,
-/* 33E0 */	0x7Fu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x19u, 0x00u, 0x37u, 0x00u, 0x0Au, 0x00u, 0x01u,
-/* 33F0 */	0x1Fu, 0x04u, 0x40u, 0x04u, 0x38u, 0x04u, 0x3Cu, 0x04u, 0x35u, 0x04u, 0x47u, 0x04u, 0x30u, 0x04u, 0x3Du, 0x04u,
-
-			/* 25 sector. Workbook. */
-/* 3400 */	0x38u, 0x04u, 0x35u, 0x04u, 0x92u, 0x08u, 0x6Eu, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3410 */	0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x02u, 0x0Au, 0xFFu, 0x0Au, 0x00u, 0x1Fu, 0x04u, 0x40u, 0x04u, 0x38u, 0x04u,
-/* 3420 */	0x3Cu, 0x04u, 0x35u, 0x04u, 0x47u, 0x04u, 0x30u, 0x04u, 0x3Du, 0x04u, 0x38u, 0x04u, 0x35u, 0x04u, 0x00u, 0x00u,
-/* 3430 */	0x05u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xCCu, 0xFFu, 0x06u, 0x00u,
-/* 3440 */	0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0xB2u, 0xB2u, 0xB2u, 0xFFu, 0x01u, 0x00u, 0x07u, 0x00u, 0x0Eu, 0x00u,
-/* 3450 */	0x05u, 0xFFu, 0x00u, 0x00u, 0xB2u, 0xB2u, 0xB2u, 0xFFu, 0x01u, 0x00u, 0x08u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu,
-/* 3460 */	0x00u, 0x00u, 0xB2u, 0xB2u, 0xB2u, 0xFFu, 0x01u, 0x00u, 0x09u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u,
-/* 3470 */	0xB2u, 0xB2u, 0xB2u, 0xFFu, 0x01u, 0x00u, 0x93u, 0x02u, 0x04u, 0x00u, 0x38u, 0x80u, 0x05u, 0xFFu, 0x92u, 0x08u,
-/* 3480 */	0x2Au, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x05u,
-/* 3490 */	0x05u, 0xFFu, 0x0Au, 0x00u, 0x1Fu, 0x04u, 0x40u, 0x04u, 0x3Eu, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u,
-/* 34A0 */	0x42u, 0x04u, 0x3Du, 0x04u, 0x4Bu, 0x04u, 0x39u, 0x04u, 0x00u, 0x00u, 0x00u, 0x00u, 0x93u, 0x02u, 0x25u, 0x00u,
-/* 34B0 */	0x39u, 0x00u, 0x10u, 0x00u, 0x01u, 0x21u, 0x04u, 0x32u, 0x04u, 0x4Fu, 0x04u, 0x37u, 0x04u, 0x30u, 0x04u, 0x3Du,
-/* 34C0 */	0x04u, 0x3Du, 0x04u, 0x30u, 0x04u, 0x4Fu, 0x04u, 0x20u, 0x00u, 0x4Fu, 0x04u, 0x47u, 0x04u, 0x35u, 0x04u, 0x39u,
-/* 34D0 */	0x04u, 0x3Au, 0x04u, 0x30u, 0x04u, 0x92u, 0x08u, 0x55u, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 34E0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x02u, 0x18u, 0xFFu, 0x10u, 0x00u, 0x21u, 0x04u, 0x32u, 0x04u, 0x4Fu,
-/* 34F0 */	0x04u, 0x37u, 0x04u, 0x30u, 0x04u, 0x3Du, 0x04u, 0x3Du, 0x04u, 0x30u, 0x04u, 0x4Fu, 0x04u, 0x20u, 0x00u, 0x4Fu,
-/* 3500 */	0x04u, 0x47u, 0x04u, 0x35u, 0x04u, 0x39u, 0x04u, 0x3Au, 0x04u, 0x30u, 0x04u, 0x00u, 0x00u, 0x03u, 0x00u, 0x05u,
-/* 3510 */	0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0xFAu, 0x7Du, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u,
-/* 3520 */	0x07u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0xFFu, 0x80u, 0x01u, 0xFFu, 0x06u, 0x00u, 0x93u, 0x02u,
-/* 3530 */	0x2Du, 0x00u, 0x3Au, 0x00u, 0x14u, 0x00u, 0x01u, 0x22u, 0x04u, 0x35u, 0x04u, 0x3Au, 0x04u, 0x41u, 0x04u, 0x42u,
-/* 3540 */	0x04u, 0x20u, 0x00u, 0x3Fu, 0x04u, 0x40u, 0x04u, 0x35u, 0x04u, 0x34u, 0x04u, 0x43u, 0x04u, 0x3Fu, 0x04u, 0x40u,
-/* 3550 */	0x04u, 0x35u, 0x04u, 0x36u, 0x04u, 0x34u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x38u, 0x04u, 0x4Fu, 0x04u, 0x92u,
-/* 3560 */	0x08u, 0x4Fu, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u,
-/* 3570 */	0x02u, 0x0Bu, 0xFFu, 0x14u, 0x00u, 0x22u, 0x04u, 0x35u, 0x04u, 0x3Au, 0x04u, 0x41u, 0x04u, 0x42u, 0x04u, 0x20u,
-/* 3580 */	0x00u, 0x3Fu, 0x04u, 0x40u, 0x04u, 0x35u, 0x04u, 0x34u, 0x04u, 0x43u, 0x04u, 0x3Fu, 0x04u, 0x40u, 0x04u, 0x35u,
-/* 3590 */	0x04u, 0x36u, 0x04u, 0x34u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x38u, 0x04u, 0x4Fu, 0x04u, 0x00u, 0x00u, 0x02u,
-/* 35A0 */	0x00u, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0xFFu, 0x00u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u,
-/* 35B0 */	0x00u, 0x02u, 0x93u, 0x02u, 0x04u, 0x00u, 0x3Bu, 0x80u, 0x03u, 0xFFu, 0x92u, 0x08u, 0x2Au, 0x00u, 0x92u, 0x08u,
-/* 35C0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x05u, 0x03u, 0xFFu, 0x0Au, 0x00u,
-/* 35D0 */	0x24u, 0x04u, 0x38u, 0x04u, 0x3Du, 0x04u, 0x30u, 0x04u, 0x3Du, 0x04u, 0x41u, 0x04u, 0x3Eu, 0x04u, 0x32u, 0x04u,
-/* 35E0 */	0x4Bu, 0x04u, 0x39u, 0x04u, 0x00u, 0x00u, 0x00u, 0x00u, 0x93u, 0x02u, 0x04u, 0x00u, 0x3Cu, 0x80u, 0x06u, 0xFFu,
-/* 35F0 */	0x92u, 0x08u, 0x32u, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-
-			/* 26 sector. Workbook. */
-/* 3600 */	0x01u, 0x05u, 0x06u, 0xFFu, 0x0Eu, 0x00u, 0x24u, 0x04u, 0x38u, 0x04u, 0x3Du, 0x04u, 0x30u, 0x04u, 0x3Du, 0x04u,
-/* 3610 */	0x41u, 0x04u, 0x3Eu, 0x04u, 0x32u, 0x04u, 0x4Bu, 0x04u, 0x39u, 0x04u, 0x20u, 0x00u, 0x5Bu, 0x00u, 0x30u, 0x00u,
-/* 3620 */	0x5Du, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x93u, 0x02u, 0x13u, 0x00u, 0x3Du, 0x00u, 0x07u, 0x00u, 0x01u, 0x25u,
-/* 3630 */	0x04u, 0x3Eu, 0x04u, 0x40u, 0x04u, 0x3Eu, 0x04u, 0x48u, 0x04u, 0x38u, 0x04u, 0x39u, 0x04u, 0x92u, 0x08u, 0x41u,
-/* 3640 */	0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x01u, 0x1Au,
-/* 3650 */	0xFFu, 0x07u, 0x00u, 0x25u, 0x04u, 0x3Eu, 0x04u, 0x40u, 0x04u, 0x3Eu, 0x04u, 0x48u, 0x04u, 0x38u, 0x04u, 0x39u,
-/* 3660 */	0x04u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0xC6u, 0xEFu, 0xCEu,
-/* 3670 */	0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x00u, 0x61u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u,
-/* 3680 */	0x00u, 0x02u, 0x8Eu, 0x08u, 0x58u, 0x00u, 0x8Eu, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3690 */	0x00u, 0x00u, 0x90u, 0x00u, 0x00u, 0x00u, 0x11u, 0x00u, 0x11u, 0x00u, 0x54u, 0x00u, 0x61u, 0x00u, 0x62u, 0x00u,
-/* 36A0 */	0x6Cu, 0x00u, 0x65u, 0x00u, 0x53u, 0x00u, 0x74u, 0x00u, 0x79u, 0x00u, 0x6Cu, 0x00u, 0x65u, 0x00u, 0x4Du, 0x00u,
-/* 36B0 */	0x65u, 0x00u, 0x64u, 0x00u, 0x69u, 0x00u, 0x75u, 0x00u, 0x6Du, 0x00u, 0x39u, 0x00u, 0x50u, 0x00u, 0x69u, 0x00u,
-/* 36C0 */	0x76u, 0x00u, 0x6Fu, 0x00u, 0x74u, 0x00u, 0x53u, 0x00u, 0x74u, 0x00u, 0x79u, 0x00u, 0x6Cu, 0x00u, 0x65u, 0x00u,
-/* 36D0 */	0x4Cu, 0x00u, 0x69u, 0x00u, 0x67u, 0x00u, 0x68u, 0x00u, 0x74u, 0x00u, 0x31u, 0x00u, 0x36u, 0x00u, 0x60u, 0x01u,
-/* 36E0 */	0x02u, 0x00u, 0x00u, 0x00u, 0x85u, 0x00u, 0x0Du, 0x00u, 0xD1u, 0x31u, 0x00u, 0x00u, 0x00u, 0x00u, 0x05u, 0x00u,
-/* 36F0 */	0x53u, 0x68u, 0x65u, 0x65u, 0x74u, 0x9Au, 0x08u, 0x18u, 0x00u, 0x9Au, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3700 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u,
-/* 3710 */	0x00u, 0xA3u, 0x08u, 0x10u, 0x00u, 0xA3u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3720 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x8Cu, 0x00u, 0x04u, 0x00u, 0x07u, 0x00u, 0x07u, 0x00u, 0xC1u, 0x01u, 0x08u,
-/* 3730 */	0x00u, 0xC1u, 0x01u, 0x00u, 0x00u, 0x67u, 0xE6u, 0x01u, 0x00u, 0xFCu, 0x00u, 0x2Cu, 0x00u, 0x03u, 0x00u, 0x00u,
-/* 3740 */	0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x09u, 0x00u, 0x00u, 0x53u, 0x74u, 0x72u, 0x69u, 0x6Eu, 0x67u, 0x20u, 0x23u,
-/* 3750 */	0x31u, 0x09u, 0x00u, 0x00u, 0x53u, 0x74u, 0x72u, 0x69u, 0x6Eu, 0x67u, 0x20u, 0x23u, 0x32u, 0x09u, 0x00u, 0x00u,
-/* 3760 */	0x53u, 0x74u, 0x72u, 0x69u, 0x6Eu, 0x67u, 0x20u, 0x23u, 0x33u, 0xFFu, 0x00u, 0x0Au, 0x00u, 0x08u, 0x00u, 0x45u,
-/* 3770 */	0x31u, 0x00u, 0x00u, 0x0Cu, 0x00u, 0x00u, 0x00u, 0x63u, 0x08u, 0x16u, 0x00u, 0x63u, 0x08u, 0x00u, 0x00u, 0x00u,
-/* 3780 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x16u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x02u,
-/* 3790 */	0x00u, 0x96u, 0x08u, 0x10u, 0x00u, 0x96u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 37A0 */	0x00u, 0x42u, 0xE5u, 0x01u, 0x00u, 0x9Bu, 0x08u, 0x10u, 0x00u, 0x9Bu, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 37B0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x8Cu, 0x08u, 0x10u, 0x00u, 0x8Cu, 0x08u, 0x00u,
-/* 37C0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x0Au, 0x00u, 0x00u,
-/* 37D0 */	0x00u, 0x09u, 0x08u, 0x10u, 0x00u, 0x00u, 0x06u, 0x10u, 0x00u, 0xA9u, 0x1Fu, 0xCDu, 0x07u, 0xC9u, 0x00u, 0x01u,
-/* 37E0 */	0x00u, 0x06u, 0x04u, 0x00u, 0x00u, 0x0Bu, 0x02u, 0x14u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 37F0 */	0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0xE7u, 0x32u, 0x00u, 0x00u, 0x16u, 0x34u, 0x00u, 0x00u, 0x0Du, 0x00u, 0x02u,
-
-			/* 27 sector. Workbook. */
-/* 3800 */	0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x02u, 0x00u, 0x64u, 0x00u, 0x0Fu, 0x00u, 0x02u, 0x00u, 0x01u, 0x00u, 0x11u,
-/* 3810 */	0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x10u, 0x00u, 0x08u, 0x00u, 0xFCu, 0xA9u, 0xF1u, 0xD2u, 0x4Du, 0x62u, 0x50u,
-/* 3820 */	0x3Fu, 0x5Fu, 0x00u, 0x02u, 0x00u, 0x01u, 0x00u, 0x2Au, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x2Bu, 0x00u, 0x02u,
-/* 3830 */	0x00u, 0x00u, 0x00u, 0x82u, 0x00u, 0x02u, 0x00u, 0x01u, 0x00u, 0x80u, 0x00u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3840 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x25u, 0x02u, 0x04u, 0x00u, 0x00u, 0x00u, 0x2Cu, 0x01u, 0x81u, 0x00u, 0x02u,
-/* 3850 */	0x00u, 0xC1u, 0x04u, 0x14u, 0x00u, 0x00u, 0x00u, 0x15u, 0x00u, 0x00u, 0x00u, 0x83u, 0x00u, 0x02u, 0x00u, 0x00u,
-/* 3860 */	0x00u, 0x84u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x26u, 0x00u, 0x08u, 0x00u, 0x66u, 0x66u, 0x66u, 0x66u, 0x66u,
-/* 3870 */	0x66u, 0xE6u, 0x3Fu, 0x27u, 0x00u, 0x08u, 0x00u, 0x66u, 0x66u, 0x66u, 0x66u, 0x66u, 0x66u, 0xE6u, 0x3Fu, 0x28u,
-/* 3880 */	0x00u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xE8u, 0x3Fu, 0x29u, 0x00u, 0x08u, 0x00u, 0x00u,
-/* 3890 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xE8u, 0x3Fu, 0xA1u, 0x00u, 0x22u, 0x00u, 0x00u, 0x00u, 0x2Cu, 0x01u, 0x01u,
-/* 38A0 */	0x00u, 0x01u, 0x00u, 0x01u, 0x00u, 0x04u, 0x00u, 0x42u, 0xE5u, 0x01u, 0x00u, 0x33u, 0x33u, 0x33u, 0x33u, 0x33u,
-/* 38B0 */	0x33u, 0xD3u, 0x3Fu, 0x33u, 0x33u, 0x33u, 0x33u, 0x33u, 0x33u, 0xD3u, 0x3Fu, 0x09u, 0x00u, 0x9Cu, 0x08u, 0x26u,
-/* 38C0 */	0x00u, 0x9Cu, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 38D0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x3Cu, 0x33u, 0x00u,
-/* 38E0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x55u, 0x00u, 0x02u, 0x00u, 0x08u, 0x00u, 0x00u, 0x02u, 0x0Eu,
-/* 38F0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x00u, 0x00u, 0x00u, 0x08u,
-/* 3900 */	0x02u, 0x10u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x00u, 0x2Cu, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3910 */	0x01u, 0x0Fu, 0x00u, 0x08u, 0x02u, 0x10u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x00u, 0x2Cu, 0x01u, 0x00u,
-/* 3920 */	0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x0Fu, 0x00u, 0x08u, 0x02u, 0x10u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x04u,
-/* 3930 */	0x00u, 0x2Cu, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x0Fu, 0x00u, 0xFDu, 0x00u, 0x0Au, 0x00u, 0x00u,
-/* 3940 */	0x00u, 0x00u, 0x00u, 0x0Fu, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xBDu, 0x00u, 0x12u, 0x00u, 0x00u, 0x00u, 0x01u,
-/* 3950 */	0x00u, 0x0Fu, 0x00u, 0x00u, 0x00u, 0xF0u, 0x3Fu, 0x0Fu, 0x00u, 0x01u, 0x00u, 0x24u, 0x40u, 0x02u, 0x00u, 0x06u,
-/* 3960 */	0x00u, 0x21u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Fu, 0x00u, 0x9Au, 0x99u, 0x99u, 0x99u, 0x99u, 0x99u, 0xF1u,
-/* 3970 */	0x3Fu, 0x00u, 0x00u, 0xC0u, 0x00u, 0x00u, 0xFDu, 0x0Bu, 0x00u, 0x44u, 0x00u, 0x00u, 0x01u, 0xC0u, 0x44u, 0x00u,
-/* 3980 */	0x00u, 0x02u, 0xC0u, 0x03u, 0xFDu, 0x00u, 0x0Au, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x0Fu, 0x00u, 0x01u, 0x00u,
-/* 3990 */	0x00u, 0x00u, 0xBDu, 0x00u, 0x12u, 0x00u, 0x01u, 0x00u, 0x01u, 0x00u, 0x0Fu, 0x00u, 0x00u, 0x00u, 0x00u, 0x40u,
-/* 39A0 */	0x0Fu, 0x00u, 0x01u, 0x00u, 0x34u, 0x40u, 0x02u, 0x00u, 0x06u, 0x00u, 0x21u, 0x00u, 0x01u, 0x00u, 0x03u, 0x00u,
-/* 39B0 */	0x0Fu, 0x00u, 0x9Au, 0x99u, 0x99u, 0x99u, 0x99u, 0x99u, 0x01u, 0x40u, 0x08u, 0x00u, 0x02u, 0x00u, 0x03u, 0xFEu,
-/* 39C0 */	0x0Bu, 0x00u, 0x44u, 0x01u, 0x00u, 0x01u, 0xC0u, 0x44u, 0x01u, 0x00u, 0x02u, 0xC0u, 0x03u, 0xFDu, 0x00u, 0x0Au,
-/* 39D0 */	0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x0Fu, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xBDu, 0x00u, 0x12u, 0x00u, 0x02u,
-/* 39E0 */	0x00u, 0x01u, 0x00u, 0x0Fu, 0x00u, 0x00u, 0x00u, 0x08u, 0x40u, 0x0Fu, 0x00u, 0x01u, 0x00u, 0x3Eu, 0x40u, 0x02u,
-/* 39F0 */	0x00u, 0x06u, 0x00u, 0x21u, 0x00u, 0x02u, 0x00u, 0x03u, 0x00u, 0x0Fu, 0x00u, 0x66u, 0x66u, 0x66u, 0x66u, 0x66u,
-
-			/* 28 sector. Workbook. */
-/* 3A00 */	0x66u, 0x0Au, 0x40u, 0x08u, 0x00u, 0x00u, 0x00u, 0x03u, 0xFFu, 0x0Bu, 0x00u, 0x44u, 0x02u, 0x00u, 0x01u, 0xC0u,
-/* 3A10 */	0x44u, 0x02u, 0x00u, 0x02u, 0xC0u, 0x03u, 0xD7u, 0x00u, 0x0Au, 0x00u, 0x17u, 0x01u, 0x00u, 0x00u, 0x28u, 0x00u,
-/* 3A20 */	0x49u, 0x00u, 0x49u, 0x00u, 0x3Eu, 0x02u, 0x12u, 0x00u, 0xB6u, 0x06u, 0x00u, 0x00u, 0x00u, 0x00u, 0x40u, 0x00u,
-/* 3A30 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x66u, 0x66u, 0x00u, 0x00u, 0x8Bu, 0x08u, 0x10u, 0x00u, 0x8Bu, 0x08u,
-/* 3A40 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x62u, 0x66u, 0x1Du, 0x00u,
-/* 3A50 */	0x0Fu, 0x00u, 0x03u, 0x02u, 0x00u, 0x04u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x02u, 0x00u, 0x02u, 0x00u, 0x04u,
-/* 3A60 */	0x04u, 0x67u, 0x08u, 0x17u, 0x00u, 0x67u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3A70 */	0x00u, 0x02u, 0x00u, 0x01u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x03u, 0x44u, 0x00u, 0x00u, 0x0Au, 0x00u, 0x00u, 0x00u,
-/* 3A80 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3A90 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3AA0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3AB0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3AC0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3AD0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3AE0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3AF0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3B00 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3B10 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3B20 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3B30 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3B40 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3B50 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3B60 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3B70 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3B80 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3B90 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3BA0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3BB0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3BC0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3BD0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3BE0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3BF0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-
-			/* 29 sector. SSAT. */
-			/* | 00 | 01 | 02 | 03 | 04 | 05 | 06 | 07 | 08 | 09 | 10 | 11 | 12 | 13 | 14 | 15 | */
-			/* | 01 | 02 | 03 | -2 | 05 | 06 | 07 | -2 | 09 | -2 | -1 | -1 | -1 | -1 | -1 | -1 | */
-/* 3C00 */	0x01u, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0xFEu, 0xFFu, 0xFFu, 0xFFu,
-/* 3C10 */	0x05u, 0x00u, 0x00u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0xFEu, 0xFFu, 0xFFu, 0xFFu,
-/* 3C20 */	0x09u, 0x00u, 0x00u, 0x00u, 0xFEu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3C30 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3C40 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3C50 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3C60 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3C70 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3C80 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3C90 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3CA0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3CB0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3CC0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3CD0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3CE0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3CF0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3D00 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3D10 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3D20 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3D30 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3D40 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3D50 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3D60 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3D70 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3D80 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3D90 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3DA0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3DB0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3DC0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3DD0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3DE0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 3DF0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-
-			/* 30 sector. */
-/* 3E00 */	0xFEu, 0xFFu, 0x00u, 0x00u, 0x05u, 0x01u, 0x02u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3E10 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0xE0u, 0x85u, 0x9Fu, 0xF2u,
-/* 3E20 */	0xF9u, 0x4Fu, 0x68u, 0x10u, 0xABu, 0x91u, 0x08u, 0x00u, 0x2Bu, 0x27u, 0xB3u, 0xD9u, 0x30u, 0x00u, 0x00u, 0x00u,
-/* 3E30 */	0xB0u, 0x00u, 0x00u, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x40u, 0x00u, 0x00u, 0x00u,
-/* 3E40 */	0x04u, 0x00u, 0x00u, 0x00u, 0x48u, 0x00u, 0x00u, 0x00u, 0x08u, 0x00u, 0x00u, 0x00u, 0x60u, 0x00u, 0x00u, 0x00u,
-/* 3E50 */	0x12u, 0x00u, 0x00u, 0x00u, 0x78u, 0x00u, 0x00u, 0x00u, 0x0Cu, 0x00u, 0x00u, 0x00u, 0x90u, 0x00u, 0x00u, 0x00u,
-/* 3E60 */	0x0Du, 0x00u, 0x00u, 0x00u, 0x9Cu, 0x00u, 0x00u, 0x00u, 0x13u, 0x00u, 0x00u, 0x00u, 0xA8u, 0x00u, 0x00u, 0x00u,
-/* 3E70 */	0x02u, 0x00u, 0x00u, 0x00u, 0xE3u, 0x04u, 0x00u, 0x00u, 0x1Eu, 0x00u, 0x00u, 0x00u, 0x10u, 0x00u, 0x00u, 0x00u,
-/* 3E80 */	0x49u, 0x67u, 0x6Fu, 0x72u, 0x20u, 0x4Du, 0x69u, 0x72u, 0x6Fu, 0x6Eu, 0x63u, 0x68u, 0x69u, 0x6Bu, 0x00u, 0x00u,
-/* 3E90 */	0x1Eu, 0x00u, 0x00u, 0x00u, 0x10u, 0x00u, 0x00u, 0x00u, 0x49u, 0x67u, 0x6Fu, 0x72u, 0x20u, 0x4Du, 0x69u, 0x72u,
-/* 3EA0 */	0x6Fu, 0x6Eu, 0x63u, 0x68u, 0x69u, 0x6Bu, 0x00u, 0x00u, 0x1Eu, 0x00u, 0x00u, 0x00u, 0x10u, 0x00u, 0x00u, 0x00u,
-/* 3EB0 */	0x4Du, 0x69u, 0x63u, 0x72u, 0x6Fu, 0x73u, 0x6Fu, 0x66u, 0x74u, 0x20u, 0x45u, 0x78u, 0x63u, 0x65u, 0x6Cu, 0x00u,
-/* 3EC0 */	0x40u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x6Eu, 0xDBu, 0xD4u, 0xCEu, 0xCBu, 0x01u, 0x40u, 0x00u, 0x00u, 0x00u,
-/* 3ED0 */	0x00u, 0xEDu, 0x5Bu, 0x71u, 0xDAu, 0xD4u, 0xCBu, 0x01u, 0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3EE0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3EF0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3F00 */	0xFEu, 0xFFu, 0x00u, 0x00u, 0x05u, 0x01u, 0x02u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3F10 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x02u, 0xD5u, 0xCDu, 0xD5u,
-/* 3F20 */	0x9Cu, 0x2Eu, 0x1Bu, 0x10u, 0x93u, 0x97u, 0x08u, 0x00u, 0x2Bu, 0x2Cu, 0xF9u, 0xAEu, 0x30u, 0x00u, 0x00u, 0x00u,
-/* 3F30 */	0xBCu, 0x00u, 0x00u, 0x00u, 0x09u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x50u, 0x00u, 0x00u, 0x00u,
-/* 3F40 */	0x0Fu, 0x00u, 0x00u, 0x00u, 0x58u, 0x00u, 0x00u, 0x00u, 0x17u, 0x00u, 0x00u, 0x00u, 0x64u, 0x00u, 0x00u, 0x00u,
-/* 3F50 */	0x0Bu, 0x00u, 0x00u, 0x00u, 0x6Cu, 0x00u, 0x00u, 0x00u, 0x10u, 0x00u, 0x00u, 0x00u, 0x74u, 0x00u, 0x00u, 0x00u,
-/* 3F60 */	0x13u, 0x00u, 0x00u, 0x00u, 0x7Cu, 0x00u, 0x00u, 0x00u, 0x16u, 0x00u, 0x00u, 0x00u, 0x84u, 0x00u, 0x00u, 0x00u,
-/* 3F70 */	0x0Du, 0x00u, 0x00u, 0x00u, 0x8Cu, 0x00u, 0x00u, 0x00u, 0x0Cu, 0x00u, 0x00u, 0x00u, 0x9Eu, 0x00u, 0x00u, 0x00u,
-/* 3F80 */	0x02u, 0x00u, 0x00u, 0x00u, 0xE3u, 0x04u, 0x00u, 0x00u, 0x1Eu, 0x00u, 0x00u, 0x00u, 0x04u, 0x00u, 0x00u, 0x00u,
-/* 3F90 */	0x00u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x0Cu, 0x00u, 0x0Bu, 0x00u, 0x00u, 0x00u,
-/* 3FA0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x0Bu, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x0Bu, 0x00u, 0x00u, 0x00u,
-/* 3FB0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x0Bu, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x1Eu, 0x10u, 0x00u, 0x00u,
-/* 3FC0 */	0x01u, 0x00u, 0x00u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0x53u, 0x68u, 0x65u, 0x65u, 0x74u, 0x00u, 0x0Cu, 0x10u,
-/* 3FD0 */	0x00u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x1Eu, 0x00u, 0x00u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0xCBu, 0xE8u,
-/* 3FE0 */	0xF1u, 0xF2u, 0xFBu, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 3FF0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-
-			/* 31 sector. */
-/* 4000 */	/* Name of the directory. */
-			0x01u, 0x00u, 0x43u, 0x00u, 0x6Fu, 0x00u, 0x6Du, 0x00u, 0x70u, 0x00u, 0x4Fu, 0x00u, 0x62u, 0x00u, 0x6Au, 0x00u,
-/* 4010 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4020 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4030 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4040 */	/* Size of used area by directory's name: 18. */
-			0x12u, 0x00u,
-			/* Type of the entry: User stream. */
-			0x02u,
-			/* Node color: Red. */
-			0x00u,
-			/* DirID of the left child: 0xFFFFFFFF. */
-			0xFFu, 0xFFu, 0xFFu, 0xFFu,
-			/* DirID of the right child: 0xFFFFFFFF. */
-			0xFFu, 0xFFu, 0xFFu, 0xFFu,
-			/* DirID of the root node entry: 0xFFFFFFFF. */
-			0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 4050 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4060 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4070 */	0x00u, 0x00u, 0x00u, 0x00u,
-			/* SecID of first sector: 8. */
-			0x08u, 0x00u, 0x00u, 0x00u,
-			/* Total stream size: 109. */
-			0x6Du, 0x00u, 0x00u, 0x00u,
-			0x00u, 0x00u, 0x00u, 0x00u,
-/* 4080 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4090 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 40A0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 40B0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 40C0 */	0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 40D0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 40E0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 40F0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4100 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4110 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4120 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4130 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4140 */	0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 4150 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4160 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4170 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4180 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4190 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 41A0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 41B0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 41C0 */	0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
-/* 41D0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 41E0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 41F0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-
-			/* 32 sector. */
-/* 4200 */	0x01u, 0x00u, 0xFEu, 0xFFu, 0x03u, 0x0Au, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x20u, 0x08u, 0x02u, 0x00u,
-/* 4210 */	0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x46u, 0x21u, 0x00u, 0x00u, 0x00u,
-/* 4220 */	0xCBu, 0xE8u, 0xF1u, 0xF2u, 0x20u, 0x4Du, 0x69u, 0x63u, 0x72u, 0x6Fu, 0x73u, 0x6Fu, 0x66u, 0x74u, 0x20u, 0x4Fu,
-/* 4230 */	0x66u, 0x66u, 0x69u, 0x63u, 0x65u, 0x20u, 0x45u, 0x78u, 0x63u, 0x65u, 0x6Cu, 0x20u, 0x32u, 0x30u, 0x30u, 0x33u,
-/* 4240 */	0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0x42u, 0x69u, 0x66u, 0x66u, 0x38u, 0x00u, 0x0Eu, 0x00u, 0x00u, 0x00u, 0x45u,
-/* 4250 */	0x78u, 0x63u, 0x65u, 0x6Cu, 0x2Eu, 0x53u, 0x68u, 0x65u, 0x65u, 0x74u, 0x2Eu, 0x38u, 0x00u, 0xF4u, 0x39u, 0xB2u,
-/* 4260 */	0x71u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4270 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4280 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4290 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 42A0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 42B0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 42C0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 42D0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 42E0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 42F0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4300 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4310 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4320 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4330 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4340 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4350 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4360 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4370 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4380 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 4390 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 43A0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 43B0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 43C0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 43D0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 43E0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
-/* 43F0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u
-);
-
-
-//
-// Document
-//
-
-Document::Document()
-	:	m_stream( std::ios::in | std::ios::out | std::ios::binary )
-{
-	m_stream.write( &data[ 0 ], 0x4400 );
-}
-
-//! \return Document's stream.
-std::stringstream &
-Document::stream()
-{
-	return m_stream;
-}
+
+/*
+	SPDX-FileCopyrightText: 2011-2024 Igor Mironchik <igor.mironchik@gmail.com>
+	SPDX-License-Identifier: MIT
+*/
+
+// Test include.
+#include <test/testdocument/document.hpp>
+#include <test/helper/helper.hpp>
+
+
+const auto data = make_data(
+			/* Header. */
+/* 0000 */	/* Compound document file identifier. */
+			0xD0u, 0xCFu, 0x11u, 0xE0u, 0xA1u, 0xB1u, 0x1Au, 0xE1u,
+			/* Unique identifier. */
+			0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 0010 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+			/* Version number and revision number. */
+			0x3Eu, 0x00u, 0x03u, 0x00u,
+			/* Byte order identifier. */
+			0xFEu, 0xFFu,
+			/* Size of sectors. */
+			0x09u, 0x00u,
+/* 0020 */	/* Size of short-sectors. */
+			0x06u, 0x00u,
+			/* Can be skipped. */
+			0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+			/* Number of sectors used by SAT. */
+			0x01u, 0x00u, 0x00u, 0x00u,
+/* 0030 */	/* SecID of first sector used by directory. */
+			0x01u, 0x00u, 0x00u, 0x00u,
+			/* Can be ignored. */
+			0x00u, 0x00u, 0x00u, 0x00u,
+			/* Minimum size of standard stream. */
+			0x00u, 0x10u, 0x00u, 0x00u,
+			/* SecID of the first sector used by SSAT. */
+			0x1Du, 0x00u, 0x00u, 0x00u,
+/* 0040 */	/* Number of sectors used by SSAT. */
+			0x01u, 0x00u, 0x00u, 0x00u,
+			/* SecID of the first sector used by MSAT. */
+			0xFEu, 0xFFu, 0xFFu, 0xFFu,
+			/* Number of sectors used by MSAT. */
+			0x00u, 0x00u, 0x00u, 0x00u,
+			/* First SecID in the MSAT followed by 432 bytes */
+			0x00u, 0x00u, 0x00u, 0x00u,
+/* 0050 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0060 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0070 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0080 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0090 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 00A0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 00B0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 00C0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 00D0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 00E0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 00F0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0100 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0110 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0120 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0130 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0140 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0150 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0160 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0170 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0180 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0190 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 01A0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 01B0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 01C0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 01D0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 01E0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 01F0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+
+			/* 0 sector. SAT. */
+			/* | 00 | 01 | 02 | 03 | 04 | 05 | 06 | 07 | 08 | 09 | 10 | 11 | 12 | 13 | 14 | 15 | */
+			/* | -3 | 31 | 03 | 04 | 05 | 06 | 07 | 08 | 09 | 10 | 11 | 12 | 13 | 14 | 15 | 16 | */
+			/* | 16 | 17 | 18 | 19 | 20 | 21 | 22 | 23 | 24 | 25 | 26 | 27 | 28 | 29 | 30 | 31 | */
+			/* | 17 | 18 | 19 | 20 | 21 | 22 | 23 | 24 | 25 | 26 | 27 | 28 | -2 | -2 | 32 | -2 | */
+/* 0200 */	0xFDu, 0xFFu, 0xFFu, 0xFFu, 0x1Fu, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x04u, 0x00u, 0x00u, 0x00u,
+/* 0210 */	0x05u, 0x00u, 0x00u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0x08u, 0x00u, 0x00u, 0x00u,
+/* 0220 */	0x09u, 0x00u, 0x00u, 0x00u, 0x0Au, 0x00u, 0x00u, 0x00u, 0x0Bu, 0x00u, 0x00u, 0x00u, 0x0Cu, 0x00u, 0x00u, 0x00u,
+/* 0230 */	0x0Du, 0x00u, 0x00u, 0x00u, 0x0Eu, 0x00u, 0x00u, 0x00u, 0x0Fu, 0x00u, 0x00u, 0x00u, 0x10u, 0x00u, 0x00u, 0x00u,
+/* 0240 */	0x11u, 0x00u, 0x00u, 0x00u, 0x12u, 0x00u, 0x00u, 0x00u, 0x13u, 0x00u, 0x00u, 0x00u, 0x14u, 0x00u, 0x00u, 0x00u,
+/* 0250 */	0x15u, 0x00u, 0x00u, 0x00u, 0x16u, 0x00u, 0x00u, 0x00u, 0x17u, 0x00u, 0x00u, 0x00u, 0x18u, 0x00u, 0x00u, 0x00u,
+/* 0260 */	0x19u, 0x00u, 0x00u, 0x00u, 0x1Au, 0x00u, 0x00u, 0x00u, 0x1Bu, 0x00u, 0x00u, 0x00u, 0x1Cu, 0x00u, 0x00u, 0x00u,
+/* 0270 */	0xFEu, 0xFFu, 0xFFu, 0xFFu, 0xFEu, 0xFFu, 0xFFu, 0xFFu, 0x20u, 0x00u, 0x00u, 0x00u, 0xFEu, 0xFFu, 0xFFu, 0xFFu,
+/* 0280 */	0xFEu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0290 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 02A0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 02B0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 02C0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 02D0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 02E0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 02F0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0300 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0310 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0320 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0330 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0340 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0350 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0360 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0370 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0380 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0390 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 03A0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 03B0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 03C0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 03D0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 03E0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 03F0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+
+			/* 1 sector. Directory. */
+/* 0400 */	/* Name of the directory: Root Entry. */
+			0x52u, 0x00u, 0x6Fu, 0x00u, 0x6Fu, 0x00u, 0x74u, 0x00u, 0x20u, 0x00u, 0x45u, 0x00u, 0x6Eu, 0x00u, 0x74u, 0x00u,
+/* 0410 */	0x72u, 0x00u, 0x79u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 0420 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 0430 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 0440 */	/* Size of used area by directory's name: 22. */
+			0x16u, 0x00u,
+			/* Type of the entry: Root storage. */
+			0x05u,
+			/* Node color: Red. */
+			0x00u,
+			/* DirID of the left child: 0xFFFFFFFF. */
+			0xFFu, 0xFFu, 0xFFu, 0xFFu,
+			/* DirID of the right child: 0xFFFFFFFF. */
+			0xFFu, 0xFFu, 0xFFu, 0xFFu,
+			/* DirID of root node entry: 2. */
+			0x02u, 0x00u, 0x00u, 0x00u,
+/* 0450 */	0x20u, 0x08u, 0x02u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x46u,
+/* 0460 */	0x00u, 0x00u, 0x00u, 0x00u, 0x20u, 0x16u, 0x3Du, 0x5Du, 0xD8u, 0xD4u, 0xCBu, 0x01u, 0x00u, 0xEDu, 0x5Bu, 0x71u,
+/* 0470 */	0xDAu, 0xD4u, 0xCBu, 0x01u,
+			/* SecID of first sector: 0x1E. */
+			0x1Eu, 0x00u, 0x00u, 0x00u,
+			/* Total stream size: 640. */
+			0x80u, 0x02u, 0x00u, 0x00u,
+			0x00u, 0x00u, 0x00u, 0x00u,
+/* 0480 */	/* Name of the directory: Workbook. */
+			0x57u, 0x00u, 0x6Fu, 0x00u, 0x72u, 0x00u, 0x6Bu, 0x00u, 0x62u, 0x00u, 0x6Fu, 0x00u, 0x6Fu, 0x00u, 0x6Bu, 0x00u,
+/* 0490 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 04A0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 04B0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 04C0 */	/* Size of used area by directory's name: 18. */
+			0x12u, 0x00u,
+			/* Type of the entry: User stream. */
+			0x02u,
+			/* Node color: Black. */
+			0x01u,
+			/* DirID of the left child: 4. */
+			0x04u, 0x00u, 0x00u, 0x00u,
+			/* DirID of the right child: 0xFFFFFFFF. */
+			0xFFu, 0xFFu, 0xFFu, 0xFFu,
+			/* DirID of the root node entry: 0xFFFFFFFF. */
+			0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 04D0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 04E0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 04F0 */	0x00u, 0x00u, 0x00u, 0x00u,
+			/* SecID of first sector: 2. */
+			0x02u, 0x00u, 0x00u, 0x00u,
+			/* Total stream size: 13440. */
+			0x80u, 0x34u, 0x00u, 0x00u,
+			0x00u, 0x00u, 0x00u, 0x00u,
+/* 0500 */	/* Name of the directory. */
+			0x05u, 0x00u, 0x53u, 0x00u, 0x75u, 0x00u, 0x6Du, 0x00u, 0x6Du, 0x00u, 0x61u, 0x00u, 0x72u, 0x00u, 0x79u, 0x00u,
+/* 0510 */	0x49u, 0x00u, 0x6Eu, 0x00u, 0x66u, 0x00u, 0x6Fu, 0x00u, 0x72u, 0x00u, 0x6Du, 0x00u, 0x61u, 0x00u, 0x74u, 0x00u,
+/* 0520 */	0x69u, 0x00u, 0x6Fu, 0x00u, 0x6Eu, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 0530 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 0540 */	/* Size of used area by directory's name. */
+			0x28u, 0x00u,
+			/* Type of the entry: User stream. */
+			0x02u,
+			/* Node color: Black. */
+			0x01u,
+			/* DirID of the left child: 1. */
+			0x01u, 0x00u, 0x00u, 0x00u,
+			/* DirID of the right child: 3. */
+			0x03u, 0x00u, 0x00u, 0x00u,
+			/* DirID of the root node entry: 0xFFFFFFFF. */
+			0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 0550 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 0560 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 0570 */	0x00u, 0x00u, 0x00u, 0x00u,
+			/* SecID of first sector: 0. */
+			0x00u, 0x00u, 0x00u, 0x00u,
+			/* Total stream size: 224. */
+			0xE0u, 0x00u, 0x00u, 0x00u,
+			0x00u, 0x00u, 0x00u, 0x00u,
+/* 0580 */	/* Name of the directory. */
+			0x05u, 0x00u, 0x44u, 0x00u, 0x6Fu, 0x00u, 0x63u, 0x00u, 0x75u, 0x00u, 0x6Du, 0x00u, 0x65u, 0x00u, 0x6Eu, 0x00u,
+/* 0590 */	0x74u, 0x00u, 0x53u, 0x00u, 0x75u, 0x00u, 0x6Du, 0x00u, 0x6Du, 0x00u, 0x61u, 0x00u, 0x72u, 0x00u, 0x79u, 0x00u,
+/* 05A0 */	0x49u, 0x00u, 0x6Eu, 0x00u, 0x66u, 0x00u, 0x6Fu, 0x00u, 0x72u, 0x00u, 0x6Du, 0x00u, 0x61u, 0x00u, 0x74u, 0x00u,
+/* 05B0 */	0x69u, 0x00u, 0x6Fu, 0x00u, 0x6Eu, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 05C0 */	/* Size of used area by directory's name. */
+			0x38u, 0x00u,
+			/* Type of the entry: User stream. */
+			0x02u,
+			/* Node color: Black. */
+			0x01u,
+			/* DirID of the left child: 0xFFFFFFFF. */
+			0xFFu, 0xFFu, 0xFFu, 0xFFu,
+			/* DirID of the right hild: 0xFFFFFFFF. */
+			0xFFu, 0xFFu, 0xFFu, 0xFFu,
+			/* DirID of the root node entry: 0xFFFFFFFF. */
+			0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 05D0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 05E0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 05F0 */	0x00u, 0x00u, 0x00u, 0x00u,
+			/* SecID of first sector: 4. */
+			0x04u, 0x00u, 0x00u, 0x00u,
+			/* Total stream size: 236. */
+			0xECu, 0x00u, 0x00u, 0x00u,
+			0x00u, 0x00u, 0x00u, 0x00u,
+
+			/* 2 sector. Workbook. */
+/* 0600 */	0x09u, 0x08u, 0x10u, 0x00u, 0x00u, 0x06u, 0x05u, 0x00u, 0xA9u, 0x1Fu, 0xCDu, 0x07u, 0xC9u, 0x00u, 0x01u, 0x00u,
+/* 0610 */	0x06u, 0x04u, 0x00u, 0x00u, 0xE1u, 0x00u, 0x02u, 0x00u, 0xB0u, 0x04u, 0xC1u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u,
+/* 0620 */	0xE2u, 0x00u, 0x00u, 0x00u, 0x5Cu, 0x00u, 0x70u, 0x00u, 0x0Eu, 0x00u, 0x00u, 0x49u, 0x67u, 0x6Fu, 0x72u, 0x20u,
+/* 0630 */	0x4Du, 0x69u, 0x72u, 0x6Fu, 0x6Eu, 0x63u, 0x68u, 0x69u, 0x6Bu, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u,
+/* 0640 */	0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u,
+/* 0650 */	0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u,
+/* 0660 */	0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u,
+/* 0670 */	0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u,
+/* 0680 */	0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u,
+/* 0690 */	0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x20u, 0x42u, 0x00u, 0x02u, 0x00u, 0xB0u, 0x04u, 0x61u, 0x01u,
+/* 06A0 */	0x02u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x01u, 0x00u, 0x00u, 0x3Du, 0x01u, 0x02u, 0x00u, 0x01u, 0x00u, 0x9Cu, 0x00u,
+/* 06B0 */	0x02u, 0x00u, 0x10u, 0x00u, 0x19u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x12u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u,
+/* 06C0 */	0x13u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xAFu, 0x01u, 0x02u, 0x00u, 0x00u, 0x00u, 0xBCu, 0x01u, 0x02u, 0x00u,
+/* 06D0 */	0x00u, 0x00u, 0x3Du, 0x00u, 0x12u, 0x00u, 0x78u, 0x00u, 0x2Du, 0x00u, 0x1Fu, 0x3Bu, 0xC2u, 0x1Fu, 0x38u, 0x00u,
+/* 06E0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x58u, 0x02u, 0x40u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x8Du, 0x00u,
+/* 06F0 */	0x02u, 0x00u, 0x00u, 0x00u, 0x22u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x0Eu, 0x00u, 0x02u, 0x00u, 0x01u, 0x00u,
+/* 0700 */	0xB7u, 0x01u, 0x02u, 0x00u, 0x00u, 0x00u, 0xDAu, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u,
+/* 0710 */	0xDCu, 0x00u, 0x00u, 0x00u, 0x08u, 0x00u, 0x90u, 0x01u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u,
+/* 0720 */	0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u,
+/* 0730 */	0x1Eu, 0x00u, 0xDCu, 0x00u, 0x00u, 0x00u, 0x08u, 0x00u, 0x90u, 0x01u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u,
+/* 0740 */	0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u,
+/* 0750 */	0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u, 0x00u, 0x00u, 0x08u, 0x00u, 0x90u, 0x01u, 0x00u, 0x00u, 0x00u, 0x02u,
+/* 0760 */	0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u,
+/* 0770 */	0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u, 0x00u, 0x00u, 0x08u, 0x00u, 0x90u, 0x01u, 0x00u, 0x00u,
+/* 0780 */	0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u,
+/* 0790 */	0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u, 0x00u, 0x00u, 0x08u, 0x00u, 0x90u, 0x01u,
+/* 07A0 */	0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u,
+/* 07B0 */	0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u, 0x00u, 0x00u, 0x09u, 0x00u,
+/* 07C0 */	0x90u, 0x01u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u,
+/* 07D0 */	0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u, 0x00u, 0x00u,
+/* 07E0 */	0x3Eu, 0x00u, 0x90u, 0x01u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u,
+/* 07F0 */	0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u,
+
+			/* 3 sector. Workbook. */
+/* 0800 */	0x01u, 0x00u, 0x3Fu, 0x00u, 0xBCu, 0x02u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u,
+/* 0810 */	0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u,
+/* 0820 */	0xDCu, 0x00u, 0x01u, 0x00u, 0x34u, 0x00u, 0xBCu, 0x02u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u,
+/* 0830 */	0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u,
+/* 0840 */	0x1Eu, 0x00u, 0x2Cu, 0x01u, 0x01u, 0x00u, 0x38u, 0x00u, 0xBCu, 0x02u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u,
+/* 0850 */	0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u,
+/* 0860 */	0x31u, 0x00u, 0x1Eu, 0x00u, 0x04u, 0x01u, 0x01u, 0x00u, 0x38u, 0x00u, 0xBCu, 0x02u, 0x00u, 0x00u, 0x00u, 0x02u,
+/* 0870 */	0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u,
+/* 0880 */	0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u, 0x01u, 0x00u, 0x38u, 0x00u, 0xBCu, 0x02u, 0x00u, 0x00u,
+/* 0890 */	0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u,
+/* 08A0 */	0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u, 0x01u, 0x00u, 0x08u, 0x00u, 0xBCu, 0x02u,
+/* 08B0 */	0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u,
+/* 08C0 */	0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u, 0x01u, 0x00u, 0x09u, 0x00u,
+/* 08D0 */	0xBCu, 0x02u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u,
+/* 08E0 */	0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0x68u, 0x01u, 0x01u, 0x00u,
+/* 08F0 */	0x38u, 0x00u, 0xBCu, 0x02u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u,
+/* 0900 */	0x6Du, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x61u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u,
+/* 0910 */	0x00u, 0x00u, 0x3Cu, 0x00u, 0x90u, 0x01u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u,
+/* 0920 */	0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u,
+/* 0930 */	0xDCu, 0x00u, 0x00u, 0x00u, 0x14u, 0x00u, 0x90u, 0x01u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u,
+/* 0940 */	0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u,
+/* 0950 */	0x1Eu, 0x00u, 0xDCu, 0x00u, 0x02u, 0x00u, 0x17u, 0x00u, 0x90u, 0x01u, 0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u,
+/* 0960 */	0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u,
+/* 0970 */	0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u, 0x00u, 0x00u, 0x34u, 0x00u, 0x90u, 0x01u, 0x00u, 0x00u, 0x00u, 0x02u,
+/* 0980 */	0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u, 0x72u, 0x00u,
+/* 0990 */	0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u, 0x00u, 0x00u, 0x0Au, 0x00u, 0x90u, 0x01u, 0x00u, 0x00u,
+/* 09A0 */	0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u, 0x62u, 0x00u,
+/* 09B0 */	0x72u, 0x00u, 0x69u, 0x00u, 0x31u, 0x00u, 0x1Eu, 0x00u, 0xDCu, 0x00u, 0x00u, 0x00u, 0x11u, 0x00u, 0x90u, 0x01u,
+/* 09C0 */	0x00u, 0x00u, 0x00u, 0x02u, 0xCCu, 0xF2u, 0x07u, 0x01u, 0x43u, 0x00u, 0x61u, 0x00u, 0x6Cu, 0x00u, 0x69u, 0x00u,
+/* 09D0 */	0x62u, 0x00u, 0x72u, 0x00u, 0x69u, 0x00u, 0x1Eu, 0x04u, 0x2Fu, 0x00u, 0x05u, 0x00u, 0x15u, 0x00u, 0x01u, 0x23u,
+/* 09E0 */	0x00u, 0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x22u, 0x00u, 0x40u, 0x04u, 0x2Eu, 0x00u, 0x22u,
+/* 09F0 */	0x00u, 0x3Bu, 0x00u, 0x5Cu, 0x00u, 0x2Du, 0x00u, 0x23u, 0x00u, 0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u,
+
+			/* 4 sector. Workbook. */
+/* 0A00 */	0x00u, 0x22u, 0x00u, 0x40u, 0x04u, 0x2Eu, 0x00u, 0x22u, 0x00u, 0x1Eu, 0x04u, 0x39u, 0x00u, 0x06u, 0x00u, 0x1Au,
+/* 0A10 */	0x00u, 0x01u, 0x23u, 0x00u, 0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x22u, 0x00u, 0x40u, 0x04u,
+/* 0A20 */	0x2Eu, 0x00u, 0x22u, 0x00u, 0x3Bu, 0x00u, 0x5Bu, 0x00u, 0x52u, 0x00u, 0x65u, 0x00u, 0x64u, 0x00u, 0x5Du, 0x00u,
+/* 0A30 */	0x5Cu, 0x00u, 0x2Du, 0x00u, 0x23u, 0x00u, 0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x22u, 0x00u,
+/* 0A40 */	0x40u, 0x04u, 0x2Eu, 0x00u, 0x22u, 0x00u, 0x1Eu, 0x04u, 0x3Bu, 0x00u, 0x07u, 0x00u, 0x1Bu, 0x00u, 0x01u, 0x23u,
+/* 0A50 */	0x00u, 0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x30u, 0x00u, 0x22u,
+/* 0A60 */	0x00u, 0x40u, 0x04u, 0x2Eu, 0x00u, 0x22u, 0x00u, 0x3Bu, 0x00u, 0x5Cu, 0x00u, 0x2Du, 0x00u, 0x23u, 0x00u, 0x2Cu,
+/* 0A70 */	0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x30u, 0x00u, 0x22u, 0x00u, 0x40u,
+/* 0A80 */	0x04u, 0x2Eu, 0x00u, 0x22u, 0x00u, 0x1Eu, 0x04u, 0x45u, 0x00u, 0x08u, 0x00u, 0x20u, 0x00u, 0x01u, 0x23u, 0x00u,
+/* 0A90 */	0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x30u, 0x00u, 0x22u, 0x00u,
+/* 0AA0 */	0x40u, 0x04u, 0x2Eu, 0x00u, 0x22u, 0x00u, 0x3Bu, 0x00u, 0x5Bu, 0x00u, 0x52u, 0x00u, 0x65u, 0x00u, 0x64u, 0x00u,
+/* 0AB0 */	0x5Du, 0x00u, 0x5Cu, 0x00u, 0x2Du, 0x00u, 0x23u, 0x00u, 0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u,
+/* 0AC0 */	0x2Eu, 0x00u, 0x30u, 0x00u, 0x30u, 0x00u, 0x22u, 0x00u, 0x40u, 0x04u, 0x2Eu, 0x00u, 0x22u, 0x00u, 0x1Eu, 0x04u,
+/* 0AD0 */	0x6Bu, 0x00u, 0x2Au, 0x00u, 0x33u, 0x00u, 0x01u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x2Au, 0x00u, 0x20u, 0x00u, 0x23u,
+/* 0AE0 */	0x00u, 0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x22u, 0x00u, 0x40u, 0x04u, 0x2Eu, 0x00u, 0x22u,
+/* 0AF0 */	0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x3Bu, 0x00u, 0x5Cu, 0x00u, 0x2Du, 0x00u, 0x2Au, 0x00u, 0x20u, 0x00u, 0x23u,
+/* 0B00 */	0x00u, 0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x22u, 0x00u, 0x40u, 0x04u, 0x2Eu, 0x00u, 0x22u,
+/* 0B10 */	0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x3Bu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x2Au, 0x00u, 0x20u, 0x00u, 0x22u,
+/* 0B20 */	0x00u, 0x2Du, 0x00u, 0x22u, 0x00u, 0x22u, 0x00u, 0x40u, 0x04u, 0x2Eu, 0x00u, 0x22u, 0x00u, 0x5Fu, 0x00u, 0x2Du,
+/* 0B30 */	0x00u, 0x3Bu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x40u, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x1Eu, 0x04u, 0x6Bu,
+/* 0B40 */	0x00u, 0x29u, 0x00u, 0x33u, 0x00u, 0x01u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x2Au, 0x00u, 0x20u, 0x00u, 0x23u, 0x00u,
+/* 0B50 */	0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x5Fu, 0x00u, 0x40u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u,
+/* 0B60 */	0x5Fu, 0x00u, 0x2Du, 0x00u, 0x3Bu, 0x00u, 0x5Cu, 0x00u, 0x2Du, 0x00u, 0x2Au, 0x00u, 0x20u, 0x00u, 0x23u, 0x00u,
+/* 0B70 */	0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x5Fu, 0x00u, 0x40u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u,
+/* 0B80 */	0x5Fu, 0x00u, 0x2Du, 0x00u, 0x3Bu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x2Au, 0x00u, 0x20u, 0x00u, 0x22u, 0x00u,
+/* 0B90 */	0x2Du, 0x00u, 0x22u, 0x00u, 0x5Fu, 0x00u, 0x40u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u,
+/* 0BA0 */	0x3Bu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x40u, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x1Eu, 0x04u, 0x7Bu, 0x00u,
+/* 0BB0 */	0x2Cu, 0x00u, 0x3Bu, 0x00u, 0x01u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x2Au, 0x00u, 0x20u, 0x00u, 0x23u, 0x00u, 0x2Cu,
+/* 0BC0 */	0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x30u, 0x00u, 0x22u, 0x00u, 0x40u,
+/* 0BD0 */	0x04u, 0x2Eu, 0x00u, 0x22u, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x3Bu, 0x00u, 0x5Cu, 0x00u, 0x2Du, 0x00u, 0x2Au,
+/* 0BE0 */	0x00u, 0x20u, 0x00u, 0x23u, 0x00u, 0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u,
+/* 0BF0 */	0x00u, 0x30u, 0x00u, 0x22u, 0x00u, 0x40u, 0x04u, 0x2Eu, 0x00u, 0x22u, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x3Bu,
+
+			/* 5 sector. Workbook. */
+/* 0C00 */	0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x2Au, 0x00u, 0x20u, 0x00u, 0x22u, 0x00u, 0x2Du, 0x00u, 0x22u, 0x00u, 0x3Fu,
+/* 0C10 */	0x00u, 0x3Fu, 0x00u, 0x22u, 0x00u, 0x40u, 0x04u, 0x2Eu, 0x00u, 0x22u, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x3Bu,
+/* 0C20 */	0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x40u, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x1Eu, 0x04u, 0x7Bu, 0x00u, 0x2Bu,
+/* 0C30 */	0x00u, 0x3Bu, 0x00u, 0x01u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x2Au, 0x00u, 0x20u, 0x00u, 0x23u, 0x00u, 0x2Cu, 0x00u,
+/* 0C40 */	0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x30u, 0x00u, 0x5Fu, 0x00u, 0x40u, 0x04u,
+/* 0C50 */	0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x3Bu, 0x00u, 0x5Cu, 0x00u, 0x2Du, 0x00u, 0x2Au, 0x00u,
+/* 0C60 */	0x20u, 0x00u, 0x23u, 0x00u, 0x2Cu, 0x00u, 0x23u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u,
+/* 0C70 */	0x30u, 0x00u, 0x5Fu, 0x00u, 0x40u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x3Bu, 0x00u,
+/* 0C80 */	0x5Fu, 0x00u, 0x2Du, 0x00u, 0x2Au, 0x00u, 0x20u, 0x00u, 0x22u, 0x00u, 0x2Du, 0x00u, 0x22u, 0x00u, 0x3Fu, 0x00u,
+/* 0C90 */	0x3Fu, 0x00u, 0x5Fu, 0x00u, 0x40u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x3Bu, 0x00u,
+/* 0CA0 */	0x5Fu, 0x00u, 0x2Du, 0x00u, 0x40u, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x00u, 0x00u,
+/* 0CB0 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 0CC0 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u,
+/* 0CD0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
+/* 0CE0 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 0CF0 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u,
+/* 0D00 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
+/* 0D10 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 0D20 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u,
+/* 0D30 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
+/* 0D40 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 0D50 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u,
+/* 0D60 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
+/* 0D70 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 0D80 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u,
+/* 0D90 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
+/* 0DA0 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 0DB0 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u,
+/* 0DC0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
+/* 0DD0 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 0DE0 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u,
+/* 0DF0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
+
+			/* 6 sector. Workbook. */
+/* 0E00 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 0E10 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x20u, 0x00u, 0x00u, 0x00u,
+/* 0E20 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x02u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
+/* 0E30 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
+/* 0E40 */	0x9Fu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
+/* 0E50 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0xADu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
+/* 0E60 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
+/* 0E70 */	0xAAu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
+/* 0E80 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0xAEu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
+/* 0E90 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
+/* 0EA0 */	0x9Bu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
+/* 0EB0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0xAFu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
+/* 0EC0 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
+/* 0ED0 */	0xACu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
+/* 0EE0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x9Du, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
+/* 0EF0 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
+/* 0F00 */	0x8Bu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
+/* 0F10 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0xAEu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
+/* 0F20 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
+/* 0F30 */	0xACu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
+/* 0F40 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0xB3u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u,
+/* 0F50 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
+/* 0F60 */	0x9Eu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
+/* 0F70 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x9Du, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u,
+/* 0F80 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
+/* 0F90 */	0x8Bu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
+/* 0FA0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0xA4u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u,
+/* 0FB0 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
+/* 0FC0 */	0xB1u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
+/* 0FD0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0xB4u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u,
+/* 0FE0 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
+/* 0FF0 */	0xBEu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
+
+			/* 7 sector. Workbook. */
+/* 1000 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x8Au, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u,
+/* 1010 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
+/* 1020 */	0xB9u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
+/* 1030 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0xA4u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u,
+/* 1040 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
+/* 1050 */	0xB1u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
+/* 1060 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0xB5u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x07u, 0x00u,
+/* 1070 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0x94u, 0x11u, 0x11u, 0x97u, 0x0Bu, 0x97u, 0x0Bu, 0x00u, 0x04u,
+/* 1080 */	0xAFu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x08u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0x94u,
+/* 1090 */	0x11u, 0x11u, 0xBFu, 0x1Fu, 0xBFu, 0x1Fu, 0x00u, 0x04u, 0x96u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x09u, 0x00u,
+/* 10A0 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0x94u, 0x11u, 0x11u, 0x97u, 0x0Bu, 0x97u, 0x0Bu, 0x00u, 0x04u,
+/* 10B0 */	0x96u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x2Cu, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF8u,
+/* 10C0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
+/* 10D0 */	0x2Au, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF8u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 10E0 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x0Au, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xD4u,
+/* 10F0 */	0x00u, 0x50u, 0x00u, 0x00u, 0x00u, 0x1Fu, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x0Bu, 0x00u,
+/* 1100 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xD4u, 0x00u, 0x50u, 0x00u, 0x00u, 0x00u, 0x0Bu, 0x00u, 0x00u,
+/* 1110 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x0Cu, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xD4u,
+/* 1120 */	0x00u, 0x20u, 0x00u, 0x00u, 0x00u, 0x0Fu, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x0Cu, 0x00u,
+/* 1130 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1140 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x0Du, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xD4u,
+/* 1150 */	0x00u, 0x61u, 0x00u, 0x00u, 0x3Eu, 0x1Fu, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x0Eu, 0x00u,
+/* 1160 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0x94u, 0x66u, 0x66u, 0xBFu, 0x1Fu, 0xBFu, 0x1Fu, 0x00u, 0x04u,
+/* 1170 */	0xB7u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x0Fu, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u,
+/* 1180 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x10u, 0x00u,
+/* 1190 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
+/* 11A0 */	0xABu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x11u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
+/* 11B0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0xADu, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x12u, 0x00u,
+/* 11C0 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 11D0 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0x9Cu,
+/* 11E0 */	0x11u, 0x11u, 0x16u, 0x0Bu, 0x16u, 0x0Bu, 0x00u, 0x04u, 0x9Au, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
+/* 11F0 */	0x09u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF8u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+
+			/* 8 sector. Workbook. */
+/* 1200 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x13u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xD4u,
+/* 1210 */	0x00u, 0x60u, 0x00u, 0x00u, 0x00u, 0x1Au, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x14u, 0x00u,
+/* 1220 */	0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF4u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1230 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u, 0x2Bu, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF8u,
+/* 1240 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x05u, 0x00u,
+/* 1250 */	0x29u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xF8u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1260 */	0xC0u, 0x20u, 0xE0u, 0x00u, 0x14u, 0x00u, 0x15u, 0x00u, 0x00u, 0x00u, 0xF5u, 0xFFu, 0x20u, 0x00u, 0x00u, 0xB4u,
+/* 1270 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0xAAu, 0x20u, 0x7Cu, 0x08u, 0x14u, 0x00u, 0x7Cu, 0x08u,
+/* 1280 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x3Eu, 0x00u, 0xE9u, 0x6Fu,
+/* 1290 */	0xD5u, 0xD8u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 12A0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u,
+/* 12B0 */	0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u,
+/* 12C0 */	0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 12D0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u,
+/* 12E0 */	0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu,
+/* 12F0 */	0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1300 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u,
+/* 1310 */	0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du,
+/* 1320 */	0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1330 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u,
+/* 1340 */	0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u,
+/* 1350 */	0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1360 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u,
+/* 1370 */	0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu,
+/* 1380 */	0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u,
+/* 1390 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du,
+/* 13A0 */	0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u,
+/* 13B0 */	0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u,
+/* 13C0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u,
+/* 13D0 */	0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu,
+/* 13E0 */	0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u,
+/* 13F0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0x02u,
+
+			/* 9 sector. Workbook. */
+/* 1400 */	0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u,
+/* 1410 */	0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u,
+/* 1420 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x08u, 0x00u, 0x00u, 0x00u,
+/* 1430 */	0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu,
+/* 1440 */	0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du,
+/* 1450 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x09u, 0x00u, 0x00u,
+/* 1460 */	0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u,
+/* 1470 */	0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u,
+/* 1480 */	0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x0Au, 0x00u,
+/* 1490 */	0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u,
+/* 14A0 */	0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du,
+/* 14B0 */	0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x0Bu,
+/* 14C0 */	0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u,
+/* 14D0 */	0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u,
+/* 14E0 */	0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 14F0 */	0x0Cu, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u,
+/* 1500 */	0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du,
+/* 1510 */	0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1520 */	0x00u, 0x0Du, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u,
+/* 1530 */	0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u,
+/* 1540 */	0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1550 */	0x00u, 0x00u, 0x0Eu, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u,
+/* 1560 */	0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u,
+/* 1570 */	0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1580 */	0x00u, 0x00u, 0x00u, 0x0Fu, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u,
+/* 1590 */	0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u,
+/* 15A0 */	0x00u, 0x02u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 15B0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x10u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u,
+/* 15C0 */	0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u,
+/* 15D0 */	0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x65u, 0x66u, 0x04u, 0x00u, 0x00u, 0x00u, 0x23u,
+/* 15E0 */	0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u,
+/* 15F0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x11u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du,
+
+			/* 10 sector. Workbook. */
+/* 1600 */	0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u,
+/* 1610 */	0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x65u, 0x66u,
+/* 1620 */	0x05u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u,
+/* 1630 */	0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x12u, 0x00u,
+/* 1640 */	0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u,
+/* 1650 */	0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u,
+/* 1660 */	0x00u, 0x03u, 0x00u, 0x65u, 0x66u, 0x06u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u,
+/* 1670 */	0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1680 */	0x00u, 0x00u, 0x00u, 0x13u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u,
+/* 1690 */	0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u,
+/* 16A0 */	0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x65u, 0x66u, 0x07u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u,
+/* 16B0 */	0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 16C0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x14u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u,
+/* 16D0 */	0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu,
+/* 16E0 */	0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x65u, 0x66u, 0x08u,
+/* 16F0 */	0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du,
+/* 1700 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x15u, 0x00u, 0x00u,
+/* 1710 */	0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u,
+/* 1720 */	0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u,
+/* 1730 */	0x03u, 0x00u, 0x65u, 0x66u, 0x09u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u,
+/* 1740 */	0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1750 */	0x00u, 0x00u, 0x16u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u,
+/* 1760 */	0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u,
+/* 1770 */	0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0xCCu, 0x4Cu, 0x04u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u,
+/* 1780 */	0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1790 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x17u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u,
+/* 17A0 */	0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u,
+/* 17B0 */	0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0xCCu, 0x4Cu, 0x05u, 0x00u,
+/* 17C0 */	0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u,
+/* 17D0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x18u, 0x00u, 0x00u, 0x00u,
+/* 17E0 */	0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu,
+/* 17F0 */	0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u,
+
+			/* 11 sector. Workbook. */
+/* 1800 */	0x00u, 0xCCu, 0x4Cu, 0x06u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du,
+/* 1810 */	0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1820 */	0x00u, 0x19u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u,
+/* 1830 */	0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u,
+/* 1840 */	0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0xCCu, 0x4Cu, 0x07u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u,
+/* 1850 */	0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1860 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x1Au, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u,
+/* 1870 */	0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du,
+/* 1880 */	0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0xCCu, 0x4Cu, 0x08u, 0x00u, 0x00u,
+/* 1890 */	0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u,
+/* 18A0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x1Bu, 0x00u, 0x00u, 0x00u, 0x03u,
+/* 18B0 */	0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u,
+/* 18C0 */	0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u,
+/* 18D0 */	0xCCu, 0x4Cu, 0x09u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u,
+/* 18E0 */	0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 18F0 */	0x1Cu, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1900 */	0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u,
+/* 1910 */	0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x32u, 0x33u, 0x04u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu,
+/* 1920 */	0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1930 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x1Du, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u,
+/* 1940 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu,
+/* 1950 */	0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x32u, 0x33u, 0x05u, 0x00u, 0x00u, 0x00u,
+/* 1960 */	0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u,
+/* 1970 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x1Eu, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u,
+/* 1980 */	0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu,
+/* 1990 */	0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x32u,
+/* 19A0 */	0x33u, 0x06u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u,
+/* 19B0 */	0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x1Fu,
+/* 19C0 */	0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 19D0 */	0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u,
+/* 19E0 */	0x14u, 0x00u, 0x03u, 0x00u, 0x32u, 0x33u, 0x07u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u,
+/* 19F0 */	0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+
+			/* 12 sector. Workbook. */
+/* 1A00 */	0x00u, 0x00u, 0x00u, 0x00u, 0x20u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u,
+/* 1A10 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u,
+/* 1A20 */	0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x32u, 0x33u, 0x08u, 0x00u, 0x00u, 0x00u, 0x23u,
+/* 1A30 */	0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u,
+/* 1A40 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x21u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du,
+/* 1A50 */	0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u,
+/* 1A60 */	0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x32u, 0x33u,
+/* 1A70 */	0x09u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u,
+/* 1A80 */	0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x22u, 0x00u,
+/* 1A90 */	0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1AA0 */	0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u,
+/* 1AB0 */	0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x04u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u,
+/* 1AC0 */	0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1AD0 */	0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u,
+/* 1AE0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u,
+/* 1AF0 */	0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x05u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u,
+/* 1B00 */	0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1B10 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x24u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u,
+/* 1B20 */	0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu,
+/* 1B30 */	0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x06u,
+/* 1B40 */	0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du,
+/* 1B50 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x25u, 0x00u, 0x00u,
+/* 1B60 */	0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u,
+/* 1B70 */	0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u,
+/* 1B80 */	0x03u, 0x00u, 0x00u, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u,
+/* 1B90 */	0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1BA0 */	0x00u, 0x00u, 0x26u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u,
+/* 1BB0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u,
+/* 1BC0 */	0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x08u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u,
+/* 1BD0 */	0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1BE0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x27u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u,
+/* 1BF0 */	0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u,
+
+			/* 13 sector. Workbook. */
+/* 1C00 */	0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x09u, 0x00u,
+/* 1C10 */	0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x91u, 0x00u, 0x7Du, 0x08u,
+/* 1C20 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x28u, 0x00u, 0x00u, 0x00u,
+/* 1C30 */	0x07u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x76u, 0xFFu, 0x04u, 0x5Fu,
+/* 1C40 */	0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x02u,
+/* 1C50 */	0x00u, 0x00u, 0x00u, 0xFFu, 0xCCu, 0x99u, 0xFFu, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x07u,
+/* 1C60 */	0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x2Du, 0x00u, 0x3Bu, 0x00u, 0x5Fu,
+/* 1C70 */	0x00u, 0x2Du, 0x00u, 0x08u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x3Fu,
+/* 1C80 */	0x00u, 0x5Fu, 0x00u, 0x40u, 0x04u, 0x5Fu, 0x00u, 0x09u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x7Fu,
+/* 1C90 */	0x7Fu, 0x7Fu, 0xFFu, 0x40u, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x00u, 0x00u, 0x0Au, 0x00u, 0x14u, 0x00u, 0x02u,
+/* 1CA0 */	0x00u, 0x00u, 0x00u, 0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x7Du,
+/* 1CB0 */	0x08u, 0x91u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1CC0 */	0x00u, 0x29u, 0x00u, 0x00u, 0x00u, 0x07u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x3Fu,
+/* 1CD0 */	0x3Fu, 0x3Fu, 0xFFu, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u,
+/* 1CE0 */	0x04u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xF2u, 0xF2u, 0xF2u, 0xFFu, 0x23u, 0x00u, 0x30u, 0x00u,
+/* 1CF0 */	0x2Eu, 0x00u, 0x30u, 0x00u, 0x07u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x3Fu, 0xFFu,
+/* 1D00 */	0x2Du, 0x00u, 0x3Bu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x08u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u,
+/* 1D10 */	0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x3Fu, 0x00u, 0x5Fu, 0x00u, 0x40u, 0x04u, 0x5Fu, 0x00u, 0x09u, 0x00u, 0x14u, 0x00u,
+/* 1D20 */	0x02u, 0x00u, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x40u, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x00u, 0x00u,
+/* 1D30 */	0x0Au, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1D40 */	0x00u, 0x00u, 0x00u, 0x00u, 0x7Du, 0x08u, 0x91u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1D50 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x2Au, 0x00u, 0x00u, 0x00u, 0x07u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u,
+/* 1D60 */	0x02u, 0x00u, 0x00u, 0x00u, 0xFAu, 0x7Du, 0x00u, 0xFFu, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du,
+/* 1D70 */	0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xF2u, 0xF2u, 0xF2u,
+/* 1D80 */	0xFFu, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x07u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u,
+/* 1D90 */	0x00u, 0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x2Du, 0x00u, 0x3Bu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x08u, 0x00u, 0x14u,
+/* 1DA0 */	0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x3Fu, 0x00u, 0x5Fu, 0x00u, 0x40u, 0x04u, 0x5Fu,
+/* 1DB0 */	0x00u, 0x09u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x40u, 0x00u, 0x5Fu,
+/* 1DC0 */	0x00u, 0x2Du, 0x00u, 0x00u, 0x00u, 0x0Au, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x7Fu, 0x7Fu, 0x7Fu,
+/* 1DD0 */	0xFFu, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u,
+/* 1DE0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x2Bu, 0x00u, 0x00u, 0x00u, 0x02u,
+/* 1DF0 */	0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u,
+
+			/* 14 sector. Workbook. */
+/* 1E00 */	0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u,
+/* 1E10 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x2Cu, 0x00u, 0x00u, 0x00u,
+/* 1E20 */	0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu,
+/* 1E30 */	0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du,
+/* 1E40 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x2Du, 0x00u, 0x00u,
+/* 1E50 */	0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x04u,
+/* 1E60 */	0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x08u, 0x00u, 0x14u, 0x00u,
+/* 1E70 */	0x03u, 0x00u, 0x00u, 0x00u, 0x04u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u,
+/* 1E80 */	0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1E90 */	0x00u, 0x00u, 0x2Eu, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u,
+/* 1EA0 */	0x03u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u,
+/* 1EB0 */	0x02u, 0x08u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0xFFu, 0x3Fu, 0x04u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u,
+/* 1EC0 */	0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1ED0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x2Fu, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u,
+/* 1EE0 */	0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u,
+/* 1EF0 */	0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x08u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x32u, 0x33u, 0x04u, 0x00u,
+/* 1F00 */	0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u,
+/* 1F10 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x30u, 0x00u, 0x00u, 0x00u,
+/* 1F20 */	0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu,
+/* 1F30 */	0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x55u, 0x00u, 0x7Du,
+/* 1F40 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x31u, 0x00u, 0x00u,
+/* 1F50 */	0x00u, 0x04u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u,
+/* 1F60 */	0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x07u, 0x00u, 0x14u, 0x00u,
+/* 1F70 */	0x03u, 0x00u, 0x00u, 0x00u, 0x04u, 0x00u, 0x00u, 0x00u, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u,
+/* 1F80 */	0x08u, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x04u, 0x00u, 0x00u, 0x00u, 0x2Du, 0x00u, 0x3Bu, 0x00u,
+/* 1F90 */	0x5Fu, 0x00u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x91u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 1FA0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x32u, 0x00u, 0x00u, 0x00u, 0x07u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u,
+/* 1FB0 */	0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du,
+/* 1FC0 */	0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xA5u, 0xA5u, 0xA5u,
+/* 1FD0 */	0xFFu, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x07u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u,
+/* 1FE0 */	0x00u, 0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x2Du, 0x00u, 0x3Bu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x08u, 0x00u, 0x14u,
+/* 1FF0 */	0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x3Fu, 0x00u, 0x5Fu, 0x00u, 0x40u, 0x04u, 0x5Fu,
+
+			/* 15 sector. Workbook. */
+/* 2000 */	0x00u, 0x09u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x40u, 0x00u, 0x5Fu,
+/* 2010 */	0x00u, 0x2Du, 0x00u, 0x00u, 0x00u, 0x0Au, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x3Fu,
+/* 2020 */	0xFFu, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u,
+/* 2030 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x33u, 0x00u, 0x00u, 0x00u, 0x02u,
+/* 2040 */	0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u,
+/* 2050 */	0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x01u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u,
+/* 2060 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x34u, 0x00u, 0x00u, 0x00u,
+/* 2070 */	0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x9Cu, 0x65u, 0x00u, 0xFFu, 0x04u, 0x5Fu,
+/* 2080 */	0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x02u,
+/* 2090 */	0x00u, 0x00u, 0x00u, 0xFFu, 0xEBu, 0x9Cu, 0xFFu, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du,
+/* 20A0 */	0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 20B0 */	0x00u, 0x35u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x9Cu,
+/* 20C0 */	0x00u, 0x06u, 0xFFu, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u,
+/* 20D0 */	0x04u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xFFu, 0xC7u, 0xCEu, 0xFFu, 0x23u, 0x00u, 0x30u, 0x00u,
+/* 20E0 */	0x2Eu, 0x00u, 0x30u, 0x00u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 20F0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x36u, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u,
+/* 2100 */	0x02u, 0x00u, 0x00u, 0x00u, 0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du,
+/* 2110 */	0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x91u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 2120 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x37u, 0x00u, 0x00u, 0x00u, 0x07u, 0x00u, 0x0Du, 0x00u, 0x14u,
+/* 2130 */	0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u,
+/* 2140 */	0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu,
+/* 2150 */	0xCCu, 0xFFu, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x07u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u,
+/* 2160 */	0x00u, 0x00u, 0xB2u, 0xB2u, 0xB2u, 0xFFu, 0x2Du, 0x00u, 0x3Bu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x00u, 0x08u, 0x00u,
+/* 2170 */	0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xB2u, 0xB2u, 0xB2u, 0xFFu, 0x3Fu, 0x00u, 0x5Fu, 0x00u, 0x40u, 0x04u,
+/* 2180 */	0x5Fu, 0x00u, 0x09u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xB2u, 0xB2u, 0xB2u, 0xFFu, 0x40u, 0x00u,
+/* 2190 */	0x5Fu, 0x00u, 0x2Du, 0x00u, 0x00u, 0x00u, 0x0Au, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xB2u, 0xB2u,
+/* 21A0 */	0xB2u, 0xFFu, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u,
+/* 21B0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x38u, 0x00u, 0x00u, 0x00u,
+/* 21C0 */	0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu,
+/* 21D0 */	0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du,
+/* 21E0 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x39u, 0x00u, 0x00u,
+/* 21F0 */	0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xFAu, 0x7Du, 0x00u, 0xFFu, 0x04u,
+
+			/* 16 sector. Workbook. */
+/* 2200 */	0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u, 0x02u, 0x08u, 0x00u, 0x14u, 0x00u,
+/* 2210 */	0x02u, 0x00u, 0x00u, 0x00u, 0xFFu, 0x80u, 0x01u, 0xFFu, 0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u,
+/* 2220 */	0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 2230 */	0x00u, 0x00u, 0x3Au, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u,
+/* 2240 */	0xFFu, 0x00u, 0x00u, 0xFFu, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u, 0x00u,
+/* 2250 */	0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 2260 */	0x00u, 0x00u, 0x00u, 0x3Bu, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u, 0x00u,
+/* 2270 */	0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u, 0x05u,
+/* 2280 */	0x00u, 0x02u, 0x7Du, 0x08u, 0x2Du, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 2290 */	0x00u, 0x00u, 0x00u, 0x00u, 0x3Cu, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x03u, 0x00u,
+/* 22A0 */	0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu, 0x00u,
+/* 22B0 */	0x05u, 0x00u, 0x02u, 0x7Du, 0x08u, 0x41u, 0x00u, 0x7Du, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 22C0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x3Du, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Du, 0x00u, 0x14u, 0x00u, 0x02u,
+/* 22D0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x61u, 0x00u, 0xFFu, 0x04u, 0x5Fu, 0x00u, 0x2Eu, 0x00u, 0x5Fu, 0x00u, 0x2Du, 0x0Eu,
+/* 22E0 */	0x00u, 0x05u, 0x00u, 0x02u, 0x04u, 0x00u, 0x14u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xC6u, 0xEFu, 0xCEu, 0xFFu,
+/* 22F0 */	0x23u, 0x00u, 0x30u, 0x00u, 0x2Eu, 0x00u, 0x30u, 0x00u, 0x93u, 0x02u, 0x1Fu, 0x00u, 0x10u, 0x00u, 0x0Du, 0x00u,
+/* 2300 */	0x01u, 0x32u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au,
+/* 2310 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x31u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u,
+/* 2320 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x1Eu, 0xFFu, 0x0Du,
+/* 2330 */	0x00u, 0x32u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au,
+/* 2340 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x31u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u,
+/* 2350 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x04u, 0x65u, 0x66u, 0xDBu, 0xE5u, 0xF1u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u,
+/* 2360 */	0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u,
+/* 2370 */	0x11u, 0x00u, 0x0Du, 0x00u, 0x01u, 0x32u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u,
+/* 2380 */	0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x32u, 0x00u, 0x92u,
+/* 2390 */	0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u,
+/* 23A0 */	0x04u, 0x22u, 0xFFu, 0x0Du, 0x00u, 0x32u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u,
+/* 23B0 */	0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x32u, 0x00u, 0x00u,
+/* 23C0 */	0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x05u, 0x65u, 0x66u, 0xF2u, 0xDDu, 0xDCu, 0xFFu, 0x05u,
+/* 23D0 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u,
+/* 23E0 */	0x93u, 0x02u, 0x1Fu, 0x00u, 0x12u, 0x00u, 0x0Du, 0x00u, 0x01u, 0x32u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u,
+/* 23F0 */	0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u,
+
+			/* 17 sector. Workbook. */
+/* 2400 */	0x04u, 0x33u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 2410 */	0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x26u, 0xFFu, 0x0Du, 0x00u, 0x32u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u,
+/* 2420 */	0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u,
+/* 2430 */	0x04u, 0x33u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x06u, 0x65u, 0x66u, 0xEAu,
+/* 2440 */	0xF1u, 0xDDu, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0x25u,
+/* 2450 */	0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u, 0x13u, 0x00u, 0x0Du, 0x00u, 0x01u, 0x32u, 0x00u, 0x30u,
+/* 2460 */	0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
+/* 2470 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x34u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u,
+/* 2480 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x2Au, 0xFFu, 0x0Du, 0x00u, 0x32u, 0x00u, 0x30u,
+/* 2490 */	0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
+/* 24A0 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x34u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u,
+/* 24B0 */	0x07u, 0x65u, 0x66u, 0xE5u, 0xE0u, 0xECu, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x01u, 0x00u, 0x00u, 0x00u,
+/* 24C0 */	0x00u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u, 0x14u, 0x00u, 0x0Du, 0x00u,
+/* 24D0 */	0x01u, 0x32u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au,
+/* 24E0 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x35u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u,
+/* 24F0 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x2Eu, 0xFFu, 0x0Du,
+/* 2500 */	0x00u, 0x32u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au,
+/* 2510 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x35u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u,
+/* 2520 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x08u, 0x65u, 0x66u, 0xDBu, 0xEEu, 0xF3u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u,
+/* 2530 */	0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u,
+/* 2540 */	0x15u, 0x00u, 0x0Du, 0x00u, 0x01u, 0x32u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u,
+/* 2550 */	0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x36u, 0x00u, 0x92u,
+/* 2560 */	0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u,
+/* 2570 */	0x04u, 0x32u, 0xFFu, 0x0Du, 0x00u, 0x32u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u,
+/* 2580 */	0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x36u, 0x00u, 0x00u,
+/* 2590 */	0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x09u, 0x65u, 0x66u, 0xFDu, 0xE9u, 0xD9u, 0xFFu, 0x05u,
+/* 25A0 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u,
+/* 25B0 */	0x93u, 0x02u, 0x1Fu, 0x00u, 0x16u, 0x00u, 0x0Du, 0x00u, 0x01u, 0x34u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u,
+/* 25C0 */	0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u,
+/* 25D0 */	0x04u, 0x31u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 25E0 */	0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x1Fu, 0xFFu, 0x0Du, 0x00u, 0x34u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u,
+/* 25F0 */	0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u,
+
+			/* 18 sector. Workbook. */
+/* 2600 */	0x04u, 0x31u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x04u, 0xCCu, 0x4Cu, 0xB8u,
+/* 2610 */	0xCCu, 0xE4u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0x25u,
+/* 2620 */	0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u, 0x17u, 0x00u, 0x0Du, 0x00u, 0x01u, 0x34u, 0x00u, 0x30u,
+/* 2630 */	0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
+/* 2640 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x32u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u,
+/* 2650 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x23u, 0xFFu, 0x0Du, 0x00u, 0x34u, 0x00u, 0x30u,
+/* 2660 */	0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
+/* 2670 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x32u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u,
+/* 2680 */	0x05u, 0xCCu, 0x4Cu, 0xE6u, 0xB9u, 0xB8u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x01u, 0x00u, 0x00u, 0x00u,
+/* 2690 */	0x00u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u, 0x18u, 0x00u, 0x0Du, 0x00u,
+/* 26A0 */	0x01u, 0x34u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au,
+/* 26B0 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x33u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u,
+/* 26C0 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x27u, 0xFFu, 0x0Du,
+/* 26D0 */	0x00u, 0x34u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au,
+/* 26E0 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x33u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u,
+/* 26F0 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x06u, 0xCCu, 0x4Cu, 0xD7u, 0xE4u, 0xBCu, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u,
+/* 2700 */	0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u,
+/* 2710 */	0x19u, 0x00u, 0x0Du, 0x00u, 0x01u, 0x34u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u,
+/* 2720 */	0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x34u, 0x00u, 0x92u,
+/* 2730 */	0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u,
+/* 2740 */	0x04u, 0x2Bu, 0xFFu, 0x0Du, 0x00u, 0x34u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u,
+/* 2750 */	0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x34u, 0x00u, 0x00u,
+/* 2760 */	0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x07u, 0xCCu, 0x4Cu, 0xCCu, 0xC0u, 0xDAu, 0xFFu, 0x05u,
+/* 2770 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u,
+/* 2780 */	0x93u, 0x02u, 0x1Fu, 0x00u, 0x1Au, 0x00u, 0x0Du, 0x00u, 0x01u, 0x34u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u,
+/* 2790 */	0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u,
+/* 27A0 */	0x04u, 0x35u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 27B0 */	0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x2Fu, 0xFFu, 0x0Du, 0x00u, 0x34u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u,
+/* 27C0 */	0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u,
+/* 27D0 */	0x04u, 0x35u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x08u, 0xCCu, 0x4Cu, 0xB6u,
+/* 27E0 */	0xDDu, 0xE8u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0x25u,
+/* 27F0 */	0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u, 0x1Bu, 0x00u, 0x0Du, 0x00u, 0x01u, 0x34u, 0x00u, 0x30u,
+
+			/* 19 sector. Workbook. */
+/* 2800 */	0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
+/* 2810 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x36u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u,
+/* 2820 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x33u, 0xFFu, 0x0Du, 0x00u, 0x34u, 0x00u, 0x30u,
+/* 2830 */	0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
+/* 2840 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x36u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u,
+/* 2850 */	0x09u, 0xCCu, 0x4Cu, 0xFCu, 0xD5u, 0xB4u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x01u, 0x00u, 0x00u, 0x00u,
+/* 2860 */	0x00u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u, 0x1Cu, 0x00u, 0x0Du, 0x00u,
+/* 2870 */	0x01u, 0x36u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au,
+/* 2880 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x31u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u,
+/* 2890 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x20u, 0xFFu, 0x0Du,
+/* 28A0 */	0x00u, 0x36u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au,
+/* 28B0 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x31u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u,
+/* 28C0 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x04u, 0x32u, 0x33u, 0x95u, 0xB3u, 0xD7u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u,
+/* 28D0 */	0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u,
+/* 28E0 */	0x1Du, 0x00u, 0x0Du, 0x00u, 0x01u, 0x36u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u,
+/* 28F0 */	0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x32u, 0x00u, 0x92u,
+/* 2900 */	0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u,
+/* 2910 */	0x04u, 0x24u, 0xFFu, 0x0Du, 0x00u, 0x36u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u,
+/* 2920 */	0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x32u, 0x00u, 0x00u,
+/* 2930 */	0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x05u, 0x32u, 0x33u, 0xD9u, 0x97u, 0x95u, 0xFFu, 0x05u,
+/* 2940 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u,
+/* 2950 */	0x93u, 0x02u, 0x1Fu, 0x00u, 0x1Eu, 0x00u, 0x0Du, 0x00u, 0x01u, 0x36u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u,
+/* 2960 */	0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u,
+/* 2970 */	0x04u, 0x33u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 2980 */	0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x28u, 0xFFu, 0x0Du, 0x00u, 0x36u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u,
+/* 2990 */	0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u,
+/* 29A0 */	0x04u, 0x33u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x06u, 0x32u, 0x33u, 0xC2u,
+/* 29B0 */	0xD6u, 0x9Au, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x25u,
+/* 29C0 */	0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u, 0x1Fu, 0x00u, 0x0Du, 0x00u, 0x01u, 0x36u, 0x00u, 0x30u,
+/* 29D0 */	0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
+/* 29E0 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x34u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u,
+/* 29F0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x2Cu, 0xFFu, 0x0Du, 0x00u, 0x36u, 0x00u, 0x30u,
+
+			/* 20 sector. Workbook. */
+/* 2A00 */	0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
+/* 2A10 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x34u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u,
+/* 2A20 */	0x07u, 0x32u, 0x33u, 0xB2u, 0xA1u, 0xC7u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0xFFu,
+/* 2A30 */	0xFFu, 0xFFu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u, 0x20u, 0x00u, 0x0Du, 0x00u,
+/* 2A40 */	0x01u, 0x36u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au,
+/* 2A50 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x35u, 0x00u, 0x92u, 0x08u, 0x4Du, 0x00u, 0x92u,
+/* 2A60 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x30u, 0xFFu, 0x0Du,
+/* 2A70 */	0x00u, 0x36u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u, 0x00u, 0x10u, 0x04u, 0x3Au,
+/* 2A80 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x35u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u,
+/* 2A90 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x08u, 0x32u, 0x33u, 0x93u, 0xCDu, 0xDDu, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u,
+/* 2AA0 */	0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x1Fu, 0x00u,
+/* 2AB0 */	0x21u, 0x00u, 0x0Du, 0x00u, 0x01u, 0x36u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u,
+/* 2AC0 */	0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x36u, 0x00u, 0x92u,
+/* 2AD0 */	0x08u, 0x4Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u,
+/* 2AE0 */	0x04u, 0x34u, 0xFFu, 0x0Du, 0x00u, 0x36u, 0x00u, 0x30u, 0x00u, 0x25u, 0x00u, 0x20u, 0x00u, 0x2Du, 0x00u, 0x20u,
+/* 2AF0 */	0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x36u, 0x00u, 0x00u,
+/* 2B00 */	0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x09u, 0x32u, 0x33u, 0xFAu, 0xC0u, 0x90u, 0xFFu, 0x05u,
+/* 2B10 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u,
+/* 2B20 */	0x93u, 0x02u, 0x13u, 0x00u, 0x22u, 0x00u, 0x07u, 0x00u, 0x01u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
+/* 2B30 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x31u, 0x00u, 0x92u, 0x08u, 0x41u, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u,
+/* 2B40 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x1Du, 0xFFu, 0x07u, 0x00u, 0x10u, 0x04u, 0x3Au,
+/* 2B50 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x31u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u,
+/* 2B60 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x04u, 0x00u, 0x00u, 0x4Fu, 0x81u, 0xBDu, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u,
+/* 2B70 */	0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x13u, 0x00u,
+/* 2B80 */	0x23u, 0x00u, 0x07u, 0x00u, 0x01u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u,
+/* 2B90 */	0x04u, 0x32u, 0x00u, 0x92u, 0x08u, 0x41u, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 2BA0 */	0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x21u, 0xFFu, 0x07u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
+/* 2BB0 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x32u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u,
+/* 2BC0 */	0x05u, 0x00u, 0x00u, 0xC0u, 0x50u, 0x4Du, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0xFFu,
+/* 2BD0 */	0xFFu, 0xFFu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x13u, 0x00u, 0x24u, 0x00u, 0x07u, 0x00u,
+/* 2BE0 */	0x01u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x33u, 0x00u, 0x92u,
+/* 2BF0 */	0x08u, 0x41u, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u,
+
+			/* 21 sector. Workbook. */
+/* 2C00 */	0x04u, 0x25u, 0xFFu, 0x07u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u,
+/* 2C10 */	0x04u, 0x33u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x06u, 0x00u, 0x00u, 0x9Bu,
+/* 2C20 */	0xBBu, 0x59u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x25u,
+/* 2C30 */	0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x13u, 0x00u, 0x25u, 0x00u, 0x07u, 0x00u, 0x01u, 0x10u, 0x04u, 0x3Au,
+/* 2C40 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x34u, 0x00u, 0x92u, 0x08u, 0x41u, 0x00u, 0x92u,
+/* 2C50 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x29u, 0xFFu, 0x07u,
+/* 2C60 */	0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x34u, 0x00u, 0x00u,
+/* 2C70 */	0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x07u, 0x00u, 0x00u, 0x80u, 0x64u, 0xA2u, 0xFFu, 0x05u,
+/* 2C80 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u,
+/* 2C90 */	0x93u, 0x02u, 0x13u, 0x00u, 0x26u, 0x00u, 0x07u, 0x00u, 0x01u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
+/* 2CA0 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x35u, 0x00u, 0x92u, 0x08u, 0x41u, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u,
+/* 2CB0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x2Du, 0xFFu, 0x07u, 0x00u, 0x10u, 0x04u, 0x3Au,
+/* 2CC0 */	0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x35u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u,
+/* 2CD0 */	0x00u, 0x0Cu, 0x00u, 0x07u, 0x08u, 0x00u, 0x00u, 0x4Bu, 0xACu, 0xC6u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u,
+/* 2CE0 */	0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x13u, 0x00u,
+/* 2CF0 */	0x27u, 0x00u, 0x07u, 0x00u, 0x01u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x42u,
+/* 2D00 */	0x04u, 0x36u, 0x00u, 0x92u, 0x08u, 0x41u, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 2D10 */	0x00u, 0x00u, 0x00u, 0x01u, 0x04u, 0x31u, 0xFFu, 0x07u, 0x00u, 0x10u, 0x04u, 0x3Au, 0x04u, 0x46u, 0x04u, 0x35u,
+/* 2D20 */	0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x36u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x07u,
+/* 2D30 */	0x09u, 0x00u, 0x00u, 0xF7u, 0x96u, 0x46u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0xFFu,
+/* 2D40 */	0xFFu, 0xFFu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x0Fu, 0x00u, 0x28u, 0x00u, 0x05u, 0x00u,
+/* 2D50 */	0x01u, 0x12u, 0x04u, 0x32u, 0x04u, 0x3Eu, 0x04u, 0x34u, 0x04u, 0x20u, 0x00u, 0x92u, 0x08u, 0x75u, 0x00u, 0x92u,
+/* 2D60 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x02u, 0x14u, 0xFFu, 0x05u,
+/* 2D70 */	0x00u, 0x12u, 0x04u, 0x32u, 0x04u, 0x3Eu, 0x04u, 0x34u, 0x04u, 0x20u, 0x00u, 0x00u, 0x00u, 0x07u, 0x00u, 0x01u,
+/* 2D80 */	0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0xFFu, 0xCCu, 0x99u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x05u,
+/* 2D90 */	0xFFu, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x76u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x06u, 0x00u, 0x0Eu, 0x00u,
+/* 2DA0 */	0x05u, 0xFFu, 0x00u, 0x00u, 0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x01u, 0x00u, 0x07u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu,
+/* 2DB0 */	0x00u, 0x00u, 0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x01u, 0x00u, 0x08u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u,
+/* 2DC0 */	0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x01u, 0x00u, 0x09u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x7Fu, 0x7Fu,
+/* 2DD0 */	0x7Fu, 0xFFu, 0x01u, 0x00u, 0x93u, 0x02u, 0x0Fu, 0x00u, 0x29u, 0x00u, 0x05u, 0x00u, 0x01u, 0x12u, 0x04u, 0x4Bu,
+/* 2DE0 */	0x04u, 0x32u, 0x04u, 0x3Eu, 0x04u, 0x34u, 0x04u, 0x92u, 0x08u, 0x75u, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u,
+/* 2DF0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x02u, 0x15u, 0xFFu, 0x05u, 0x00u, 0x12u, 0x04u, 0x4Bu,
+
+			/* 22 sector. Workbook. */
+/* 2E00 */	0x04u, 0x32u, 0x04u, 0x3Eu, 0x04u, 0x34u, 0x04u, 0x00u, 0x00u, 0x07u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x05u,
+/* 2E10 */	0xFFu, 0x00u, 0x00u, 0xF2u, 0xF2u, 0xF2u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x3Fu,
+/* 2E20 */	0x3Fu, 0x3Fu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x06u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u,
+/* 2E30 */	0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x01u, 0x00u, 0x07u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x3Fu, 0x3Fu,
+/* 2E40 */	0x3Fu, 0xFFu, 0x01u, 0x00u, 0x08u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x3Fu, 0xFFu,
+/* 2E50 */	0x01u, 0x00u, 0x09u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x01u, 0x00u,
+/* 2E60 */	0x93u, 0x02u, 0x19u, 0x00u, 0x2Au, 0x00u, 0x0Au, 0x00u, 0x01u, 0x12u, 0x04u, 0x4Bu, 0x04u, 0x47u, 0x04u, 0x38u,
+/* 2E70 */	0x04u, 0x41u, 0x04u, 0x3Bu, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x38u, 0x04u, 0x35u, 0x04u, 0x92u, 0x08u, 0x7Fu,
+/* 2E80 */	0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x02u, 0x16u,
+/* 2E90 */	0xFFu, 0x0Au, 0x00u, 0x12u, 0x04u, 0x4Bu, 0x04u, 0x47u, 0x04u, 0x38u, 0x04u, 0x41u, 0x04u, 0x3Bu, 0x04u, 0x35u,
+/* 2EA0 */	0x04u, 0x3Du, 0x04u, 0x38u, 0x04u, 0x35u, 0x04u, 0x00u, 0x00u, 0x07u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x05u,
+/* 2EB0 */	0xFFu, 0x00u, 0x00u, 0xF2u, 0xF2u, 0xF2u, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0xFAu,
+/* 2EC0 */	0x7Du, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x06u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u,
+/* 2ED0 */	0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x01u, 0x00u, 0x07u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x7Fu, 0x7Fu,
+/* 2EE0 */	0x7Fu, 0xFFu, 0x01u, 0x00u, 0x08u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x7Fu, 0x7Fu, 0x7Fu, 0xFFu,
+/* 2EF0 */	0x01u, 0x00u, 0x09u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x7Fu, 0x7Fu, 0x7Fu, 0xFFu, 0x01u, 0x00u,
+/* 2F00 */	0x93u, 0x02u, 0x04u, 0x00u, 0x2Bu, 0x80u, 0x04u, 0xFFu, 0x92u, 0x08u, 0x26u, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u,
+/* 2F10 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x05u, 0x04u, 0xFFu, 0x08u, 0x00u, 0x14u, 0x04u,
+/* 2F20 */	0x35u, 0x04u, 0x3Du, 0x04u, 0x35u, 0x04u, 0x36u, 0x04u, 0x3Du, 0x04u, 0x4Bu, 0x04u, 0x39u, 0x04u, 0x00u, 0x00u,
+/* 2F30 */	0x00u, 0x00u, 0x93u, 0x02u, 0x04u, 0x00u, 0x2Cu, 0x80u, 0x07u, 0xFFu, 0x92u, 0x08u, 0x2Eu, 0x00u, 0x92u, 0x08u,
+/* 2F40 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x05u, 0x07u, 0xFFu, 0x0Cu, 0x00u,
+/* 2F50 */	0x14u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x35u, 0x04u, 0x36u, 0x04u, 0x3Du, 0x04u, 0x4Bu, 0x04u, 0x39u, 0x04u,
+/* 2F60 */	0x20u, 0x00u, 0x5Bu, 0x00u, 0x30u, 0x00u, 0x5Du, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x93u, 0x02u, 0x1Bu, 0x00u,
+/* 2F70 */	0x2Du, 0x00u, 0x0Bu, 0x00u, 0x01u, 0x17u, 0x04u, 0x30u, 0x04u, 0x33u, 0x04u, 0x3Eu, 0x04u, 0x3Bu, 0x04u, 0x3Eu,
+/* 2F80 */	0x04u, 0x32u, 0x04u, 0x3Eu, 0x04u, 0x3Au, 0x04u, 0x20u, 0x00u, 0x31u, 0x00u, 0x92u, 0x08u, 0x4Bu, 0x00u, 0x92u,
+/* 2F90 */	0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x03u, 0x10u, 0xFFu, 0x0Bu,
+/* 2FA0 */	0x00u, 0x17u, 0x04u, 0x30u, 0x04u, 0x33u, 0x04u, 0x3Eu, 0x04u, 0x3Bu, 0x04u, 0x3Eu, 0x04u, 0x32u, 0x04u, 0x3Eu,
+/* 2FB0 */	0x04u, 0x3Au, 0x04u, 0x20u, 0x00u, 0x31u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u,
+/* 2FC0 */	0x03u, 0x00u, 0x00u, 0x1Fu, 0x49u, 0x7Du, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x07u, 0x00u, 0x0Eu, 0x00u,
+/* 2FD0 */	0x07u, 0x04u, 0x00u, 0x00u, 0x4Fu, 0x81u, 0xBDu, 0xFFu, 0x05u, 0x00u, 0x93u, 0x02u, 0x1Bu, 0x00u, 0x2Eu, 0x00u,
+/* 2FE0 */	0x0Bu, 0x00u, 0x01u, 0x17u, 0x04u, 0x30u, 0x04u, 0x33u, 0x04u, 0x3Eu, 0x04u, 0x3Bu, 0x04u, 0x3Eu, 0x04u, 0x32u,
+/* 2FF0 */	0x04u, 0x3Eu, 0x04u, 0x3Au, 0x04u, 0x20u, 0x00u, 0x32u, 0x00u, 0x92u, 0x08u, 0x4Bu, 0x00u, 0x92u, 0x08u, 0x00u,
+
+			/* 23 sector. Workbook. */
+/* 3000 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x03u, 0x11u, 0xFFu, 0x0Bu, 0x00u, 0x17u,
+/* 3010 */	0x04u, 0x30u, 0x04u, 0x33u, 0x04u, 0x3Eu, 0x04u, 0x3Bu, 0x04u, 0x3Eu, 0x04u, 0x32u, 0x04u, 0x3Eu, 0x04u, 0x3Au,
+/* 3020 */	0x04u, 0x20u, 0x00u, 0x32u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x03u, 0x00u,
+/* 3030 */	0x00u, 0x1Fu, 0x49u, 0x7Du, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x07u, 0x00u, 0x0Eu, 0x00u, 0x07u, 0x04u,
+/* 3040 */	0xFFu, 0x3Fu, 0xA8u, 0xC0u, 0xDEu, 0xFFu, 0x05u, 0x00u, 0x93u, 0x02u, 0x1Bu, 0x00u, 0x2Fu, 0x00u, 0x0Bu, 0x00u,
+/* 3050 */	0x01u, 0x17u, 0x04u, 0x30u, 0x04u, 0x33u, 0x04u, 0x3Eu, 0x04u, 0x3Bu, 0x04u, 0x3Eu, 0x04u, 0x32u, 0x04u, 0x3Eu,
+/* 3060 */	0x04u, 0x3Au, 0x04u, 0x20u, 0x00u, 0x33u, 0x00u, 0x92u, 0x08u, 0x4Bu, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u,
+/* 3070 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x03u, 0x12u, 0xFFu, 0x0Bu, 0x00u, 0x17u, 0x04u, 0x30u,
+/* 3080 */	0x04u, 0x33u, 0x04u, 0x3Eu, 0x04u, 0x3Bu, 0x04u, 0x3Eu, 0x04u, 0x32u, 0x04u, 0x3Eu, 0x04u, 0x3Au, 0x04u, 0x20u,
+/* 3090 */	0x00u, 0x33u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x03u, 0x00u, 0x00u, 0x1Fu,
+/* 30A0 */	0x49u, 0x7Du, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x07u, 0x00u, 0x0Eu, 0x00u, 0x07u, 0x04u, 0x32u, 0x33u,
+/* 30B0 */	0x95u, 0xB3u, 0xD7u, 0xFFu, 0x02u, 0x00u, 0x93u, 0x02u, 0x1Bu, 0x00u, 0x30u, 0x00u, 0x0Bu, 0x00u, 0x01u, 0x17u,
+/* 30C0 */	0x04u, 0x30u, 0x04u, 0x33u, 0x04u, 0x3Eu, 0x04u, 0x3Bu, 0x04u, 0x3Eu, 0x04u, 0x32u, 0x04u, 0x3Eu, 0x04u, 0x3Au,
+/* 30D0 */	0x04u, 0x20u, 0x00u, 0x34u, 0x00u, 0x92u, 0x08u, 0x3Du, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 30E0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x03u, 0x13u, 0xFFu, 0x0Bu, 0x00u, 0x17u, 0x04u, 0x30u, 0x04u, 0x33u,
+/* 30F0 */	0x04u, 0x3Eu, 0x04u, 0x3Bu, 0x04u, 0x3Eu, 0x04u, 0x32u, 0x04u, 0x3Eu, 0x04u, 0x3Au, 0x04u, 0x20u, 0x00u, 0x34u,
+/* 3100 */	0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x03u, 0x00u, 0x00u, 0x1Fu, 0x49u, 0x7Du,
+/* 3110 */	0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x0Du, 0x00u, 0x31u, 0x00u, 0x04u, 0x00u, 0x01u, 0x18u,
+/* 3120 */	0x04u, 0x42u, 0x04u, 0x3Eu, 0x04u, 0x33u, 0x04u, 0x92u, 0x08u, 0x4Bu, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u,
+/* 3130 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x03u, 0x19u, 0xFFu, 0x04u, 0x00u, 0x18u, 0x04u, 0x42u,
+/* 3140 */	0x04u, 0x3Eu, 0x04u, 0x33u, 0x04u, 0x00u, 0x00u, 0x04u, 0x00u, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x01u, 0x00u,
+/* 3150 */	0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x06u, 0x00u, 0x0Eu, 0x00u, 0x07u, 0x04u,
+/* 3160 */	0x00u, 0x00u, 0x4Fu, 0x81u, 0xBDu, 0xFFu, 0x01u, 0x00u, 0x07u, 0x00u, 0x0Eu, 0x00u, 0x07u, 0x04u, 0x00u, 0x00u,
+/* 3170 */	0x4Fu, 0x81u, 0xBDu, 0xFFu, 0x06u, 0x00u, 0x93u, 0x02u, 0x29u, 0x00u, 0x32u, 0x00u, 0x12u, 0x00u, 0x01u, 0x1Au,
+/* 3180 */	0x04u, 0x3Eu, 0x04u, 0x3Du, 0x04u, 0x42u, 0x04u, 0x40u, 0x04u, 0x3Eu, 0x04u, 0x3Bu, 0x04u, 0x4Cu, 0x04u, 0x3Du,
+/* 3190 */	0x04u, 0x30u, 0x04u, 0x4Fu, 0x04u, 0x20u, 0x00u, 0x4Fu, 0x04u, 0x47u, 0x04u, 0x35u, 0x04u, 0x39u, 0x04u, 0x3Au,
+/* 31A0 */	0x04u, 0x30u, 0x04u, 0x92u, 0x08u, 0x8Fu, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 31B0 */	0x00u, 0x00u, 0x00u, 0x01u, 0x02u, 0x17u, 0xFFu, 0x12u, 0x00u, 0x1Au, 0x04u, 0x3Eu, 0x04u, 0x3Du, 0x04u, 0x42u,
+/* 31C0 */	0x04u, 0x40u, 0x04u, 0x3Eu, 0x04u, 0x3Bu, 0x04u, 0x4Cu, 0x04u, 0x3Du, 0x04u, 0x30u, 0x04u, 0x4Fu, 0x04u, 0x20u,
+/* 31D0 */	0x00u, 0x4Fu, 0x04u, 0x47u, 0x04u, 0x35u, 0x04u, 0x39u, 0x04u, 0x3Au, 0x04u, 0x30u, 0x04u, 0x00u, 0x00u, 0x07u,
+/* 31E0 */	0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0xA5u, 0xA5u, 0xA5u, 0xFFu, 0x05u, 0x00u, 0x0Cu,
+/* 31F0 */	0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x06u, 0x00u,
+
+			/* 24 sector. Workbook. */
+/* 3200 */	0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x06u, 0x00u, 0x07u, 0x00u, 0x0Eu, 0x00u,
+/* 3210 */	0x05u, 0xFFu, 0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x06u, 0x00u, 0x08u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu,
+/* 3220 */	0x00u, 0x00u, 0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x06u, 0x00u, 0x09u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u,
+/* 3230 */	0x3Fu, 0x3Fu, 0x3Fu, 0xFFu, 0x06u, 0x00u, 0x93u, 0x02u, 0x15u, 0x00u, 0x33u, 0x00u, 0x08u, 0x00u, 0x01u, 0x1Du,
+/* 3240 */	0x04u, 0x30u, 0x04u, 0x37u, 0x04u, 0x32u, 0x04u, 0x30u, 0x04u, 0x3Du, 0x04u, 0x38u, 0x04u, 0x35u, 0x04u, 0x92u,
+/* 3250 */	0x08u, 0x37u, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u,
+/* 3260 */	0x03u, 0x0Fu, 0xFFu, 0x08u, 0x00u, 0x1Du, 0x04u, 0x30u, 0x04u, 0x37u, 0x04u, 0x32u, 0x04u, 0x30u, 0x04u, 0x3Du,
+/* 3270 */	0x04u, 0x38u, 0x04u, 0x35u, 0x04u, 0x00u, 0x00u, 0x02u, 0x00u, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x03u, 0x00u,
+/* 3280 */	0x00u, 0x1Fu, 0x49u, 0x7Du, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x01u, 0x93u, 0x02u, 0x1Bu, 0x00u, 0x34u, 0x00u,
+/* 3290 */	0x0Bu, 0x00u, 0x01u, 0x1Du, 0x04u, 0x35u, 0x04u, 0x39u, 0x04u, 0x42u, 0x04u, 0x40u, 0x04u, 0x30u, 0x04u, 0x3Bu,
+/* 32A0 */	0x04u, 0x4Cu, 0x04u, 0x3Du, 0x04u, 0x4Bu, 0x04u, 0x39u, 0x04u, 0x92u, 0x08u, 0x49u, 0x00u, 0x92u, 0x08u, 0x00u,
+/* 32B0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x01u, 0x1Cu, 0xFFu, 0x0Bu, 0x00u, 0x1Du,
+/* 32C0 */	0x04u, 0x35u, 0x04u, 0x39u, 0x04u, 0x42u, 0x04u, 0x40u, 0x04u, 0x30u, 0x04u, 0x3Bu, 0x04u, 0x4Cu, 0x04u, 0x3Du,
+/* 32D0 */	0x04u, 0x4Bu, 0x04u, 0x39u, 0x04u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u,
+/* 32E0 */	0x00u, 0xFFu, 0xEBu, 0x9Cu, 0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x9Cu, 0x65u, 0x00u,
+/* 32F0 */	0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x04u, 0x00u, 0x00u, 0x80u, 0x00u, 0xFFu, 0x92u, 0x08u,
+/* 3300 */	0x35u, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x01u,
+/* 3310 */	0x00u, 0xFFu, 0x07u, 0x00u, 0x1Eu, 0x04u, 0x31u, 0x04u, 0x4Bu, 0x04u, 0x47u, 0x04u, 0x3Du, 0x04u, 0x4Bu, 0x04u,
+/* 3320 */	0x39u, 0x04u, 0x00u, 0x00u, 0x02u, 0x00u, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x07u, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3330 */	0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x11u, 0x00u, 0x35u, 0x00u, 0x06u, 0x00u, 0x01u,
+/* 3340 */	0x1Fu, 0x04u, 0x3Bu, 0x04u, 0x3Eu, 0x04u, 0x45u, 0x04u, 0x3Eu, 0x04u, 0x39u, 0x04u, 0x92u, 0x08u, 0x3Fu, 0x00u,
+/* 3350 */	0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x01u, 0x1Bu, 0xFFu,
+/* 3360 */	0x06u, 0x00u, 0x1Fu, 0x04u, 0x3Bu, 0x04u, 0x3Eu, 0x04u, 0x45u, 0x04u, 0x3Eu, 0x04u, 0x39u, 0x04u, 0x00u, 0x00u,
+/* 3370 */	0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0xFFu, 0xC7u, 0xCEu, 0xFFu, 0x05u, 0x00u,
+/* 3380 */	0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x9Cu, 0x00u, 0x06u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u,
+/* 3390 */	0x02u, 0x17u, 0x00u, 0x36u, 0x00u, 0x09u, 0x00u, 0x01u, 0x1Fu, 0x04u, 0x3Eu, 0x04u, 0x4Fu, 0x04u, 0x41u, 0x04u,
+/* 33A0 */	0x3Du, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x38u, 0x04u, 0x35u, 0x04u, 0x92u, 0x08u, 0x39u, 0x00u, 0x92u, 0x08u,
+/* 33B0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x02u, 0x35u, 0xFFu, 0x09u, 0x00u,
+/* 33C0 */	0x1Fu, 0x04u, 0x3Eu, 0x04u, 0x4Fu, 0x04u, 0x41u, 0x04u, 0x3Du, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x38u, 0x04u,
+/* 33D0 */	0x35u, 0x04u, 0x00u, 0x00u, 0x02u, 0x00u, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x7Fu, 0x7Fu,
+/* 33E0 */	0x7Fu, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u, 0x93u, 0x02u, 0x19u, 0x00u, 0x37u, 0x00u, 0x0Au, 0x00u, 0x01u,
+/* 33F0 */	0x1Fu, 0x04u, 0x40u, 0x04u, 0x38u, 0x04u, 0x3Cu, 0x04u, 0x35u, 0x04u, 0x47u, 0x04u, 0x30u, 0x04u, 0x3Du, 0x04u,
+
+			/* 25 sector. Workbook. */
+/* 3400 */	0x38u, 0x04u, 0x35u, 0x04u, 0x92u, 0x08u, 0x6Eu, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3410 */	0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x02u, 0x0Au, 0xFFu, 0x0Au, 0x00u, 0x1Fu, 0x04u, 0x40u, 0x04u, 0x38u, 0x04u,
+/* 3420 */	0x3Cu, 0x04u, 0x35u, 0x04u, 0x47u, 0x04u, 0x30u, 0x04u, 0x3Du, 0x04u, 0x38u, 0x04u, 0x35u, 0x04u, 0x00u, 0x00u,
+/* 3430 */	0x05u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xCCu, 0xFFu, 0x06u, 0x00u,
+/* 3440 */	0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0xB2u, 0xB2u, 0xB2u, 0xFFu, 0x01u, 0x00u, 0x07u, 0x00u, 0x0Eu, 0x00u,
+/* 3450 */	0x05u, 0xFFu, 0x00u, 0x00u, 0xB2u, 0xB2u, 0xB2u, 0xFFu, 0x01u, 0x00u, 0x08u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu,
+/* 3460 */	0x00u, 0x00u, 0xB2u, 0xB2u, 0xB2u, 0xFFu, 0x01u, 0x00u, 0x09u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u,
+/* 3470 */	0xB2u, 0xB2u, 0xB2u, 0xFFu, 0x01u, 0x00u, 0x93u, 0x02u, 0x04u, 0x00u, 0x38u, 0x80u, 0x05u, 0xFFu, 0x92u, 0x08u,
+/* 3480 */	0x2Au, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x05u,
+/* 3490 */	0x05u, 0xFFu, 0x0Au, 0x00u, 0x1Fu, 0x04u, 0x40u, 0x04u, 0x3Eu, 0x04u, 0x46u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u,
+/* 34A0 */	0x42u, 0x04u, 0x3Du, 0x04u, 0x4Bu, 0x04u, 0x39u, 0x04u, 0x00u, 0x00u, 0x00u, 0x00u, 0x93u, 0x02u, 0x25u, 0x00u,
+/* 34B0 */	0x39u, 0x00u, 0x10u, 0x00u, 0x01u, 0x21u, 0x04u, 0x32u, 0x04u, 0x4Fu, 0x04u, 0x37u, 0x04u, 0x30u, 0x04u, 0x3Du,
+/* 34C0 */	0x04u, 0x3Du, 0x04u, 0x30u, 0x04u, 0x4Fu, 0x04u, 0x20u, 0x00u, 0x4Fu, 0x04u, 0x47u, 0x04u, 0x35u, 0x04u, 0x39u,
+/* 34D0 */	0x04u, 0x3Au, 0x04u, 0x30u, 0x04u, 0x92u, 0x08u, 0x55u, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 34E0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x02u, 0x18u, 0xFFu, 0x10u, 0x00u, 0x21u, 0x04u, 0x32u, 0x04u, 0x4Fu,
+/* 34F0 */	0x04u, 0x37u, 0x04u, 0x30u, 0x04u, 0x3Du, 0x04u, 0x3Du, 0x04u, 0x30u, 0x04u, 0x4Fu, 0x04u, 0x20u, 0x00u, 0x4Fu,
+/* 3500 */	0x04u, 0x47u, 0x04u, 0x35u, 0x04u, 0x39u, 0x04u, 0x3Au, 0x04u, 0x30u, 0x04u, 0x00u, 0x00u, 0x03u, 0x00u, 0x05u,
+/* 3510 */	0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0xFAu, 0x7Du, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u, 0x00u, 0x02u,
+/* 3520 */	0x07u, 0x00u, 0x0Eu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0xFFu, 0x80u, 0x01u, 0xFFu, 0x06u, 0x00u, 0x93u, 0x02u,
+/* 3530 */	0x2Du, 0x00u, 0x3Au, 0x00u, 0x14u, 0x00u, 0x01u, 0x22u, 0x04u, 0x35u, 0x04u, 0x3Au, 0x04u, 0x41u, 0x04u, 0x42u,
+/* 3540 */	0x04u, 0x20u, 0x00u, 0x3Fu, 0x04u, 0x40u, 0x04u, 0x35u, 0x04u, 0x34u, 0x04u, 0x43u, 0x04u, 0x3Fu, 0x04u, 0x40u,
+/* 3550 */	0x04u, 0x35u, 0x04u, 0x36u, 0x04u, 0x34u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x38u, 0x04u, 0x4Fu, 0x04u, 0x92u,
+/* 3560 */	0x08u, 0x4Fu, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u,
+/* 3570 */	0x02u, 0x0Bu, 0xFFu, 0x14u, 0x00u, 0x22u, 0x04u, 0x35u, 0x04u, 0x3Au, 0x04u, 0x41u, 0x04u, 0x42u, 0x04u, 0x20u,
+/* 3580 */	0x00u, 0x3Fu, 0x04u, 0x40u, 0x04u, 0x35u, 0x04u, 0x34u, 0x04u, 0x43u, 0x04u, 0x3Fu, 0x04u, 0x40u, 0x04u, 0x35u,
+/* 3590 */	0x04u, 0x36u, 0x04u, 0x34u, 0x04u, 0x35u, 0x04u, 0x3Du, 0x04u, 0x38u, 0x04u, 0x4Fu, 0x04u, 0x00u, 0x00u, 0x02u,
+/* 35A0 */	0x00u, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0xFFu, 0x00u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u,
+/* 35B0 */	0x00u, 0x02u, 0x93u, 0x02u, 0x04u, 0x00u, 0x3Bu, 0x80u, 0x03u, 0xFFu, 0x92u, 0x08u, 0x2Au, 0x00u, 0x92u, 0x08u,
+/* 35C0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x05u, 0x03u, 0xFFu, 0x0Au, 0x00u,
+/* 35D0 */	0x24u, 0x04u, 0x38u, 0x04u, 0x3Du, 0x04u, 0x30u, 0x04u, 0x3Du, 0x04u, 0x41u, 0x04u, 0x3Eu, 0x04u, 0x32u, 0x04u,
+/* 35E0 */	0x4Bu, 0x04u, 0x39u, 0x04u, 0x00u, 0x00u, 0x00u, 0x00u, 0x93u, 0x02u, 0x04u, 0x00u, 0x3Cu, 0x80u, 0x06u, 0xFFu,
+/* 35F0 */	0x92u, 0x08u, 0x32u, 0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+
+			/* 26 sector. Workbook. */
+/* 3600 */	0x01u, 0x05u, 0x06u, 0xFFu, 0x0Eu, 0x00u, 0x24u, 0x04u, 0x38u, 0x04u, 0x3Du, 0x04u, 0x30u, 0x04u, 0x3Du, 0x04u,
+/* 3610 */	0x41u, 0x04u, 0x3Eu, 0x04u, 0x32u, 0x04u, 0x4Bu, 0x04u, 0x39u, 0x04u, 0x20u, 0x00u, 0x5Bu, 0x00u, 0x30u, 0x00u,
+/* 3620 */	0x5Du, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x93u, 0x02u, 0x13u, 0x00u, 0x3Du, 0x00u, 0x07u, 0x00u, 0x01u, 0x25u,
+/* 3630 */	0x04u, 0x3Eu, 0x04u, 0x40u, 0x04u, 0x3Eu, 0x04u, 0x48u, 0x04u, 0x38u, 0x04u, 0x39u, 0x04u, 0x92u, 0x08u, 0x41u,
+/* 3640 */	0x00u, 0x92u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x01u, 0x1Au,
+/* 3650 */	0xFFu, 0x07u, 0x00u, 0x25u, 0x04u, 0x3Eu, 0x04u, 0x40u, 0x04u, 0x3Eu, 0x04u, 0x48u, 0x04u, 0x38u, 0x04u, 0x39u,
+/* 3660 */	0x04u, 0x00u, 0x00u, 0x03u, 0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0xC6u, 0xEFu, 0xCEu,
+/* 3670 */	0xFFu, 0x05u, 0x00u, 0x0Cu, 0x00u, 0x05u, 0xFFu, 0x00u, 0x00u, 0x00u, 0x61u, 0x00u, 0xFFu, 0x25u, 0x00u, 0x05u,
+/* 3680 */	0x00u, 0x02u, 0x8Eu, 0x08u, 0x58u, 0x00u, 0x8Eu, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3690 */	0x00u, 0x00u, 0x90u, 0x00u, 0x00u, 0x00u, 0x11u, 0x00u, 0x11u, 0x00u, 0x54u, 0x00u, 0x61u, 0x00u, 0x62u, 0x00u,
+/* 36A0 */	0x6Cu, 0x00u, 0x65u, 0x00u, 0x53u, 0x00u, 0x74u, 0x00u, 0x79u, 0x00u, 0x6Cu, 0x00u, 0x65u, 0x00u, 0x4Du, 0x00u,
+/* 36B0 */	0x65u, 0x00u, 0x64u, 0x00u, 0x69u, 0x00u, 0x75u, 0x00u, 0x6Du, 0x00u, 0x39u, 0x00u, 0x50u, 0x00u, 0x69u, 0x00u,
+/* 36C0 */	0x76u, 0x00u, 0x6Fu, 0x00u, 0x74u, 0x00u, 0x53u, 0x00u, 0x74u, 0x00u, 0x79u, 0x00u, 0x6Cu, 0x00u, 0x65u, 0x00u,
+/* 36D0 */	0x4Cu, 0x00u, 0x69u, 0x00u, 0x67u, 0x00u, 0x68u, 0x00u, 0x74u, 0x00u, 0x31u, 0x00u, 0x36u, 0x00u, 0x60u, 0x01u,
+/* 36E0 */	0x02u, 0x00u, 0x00u, 0x00u, 0x85u, 0x00u, 0x0Du, 0x00u, 0xD1u, 0x31u, 0x00u, 0x00u, 0x00u, 0x00u, 0x05u, 0x00u,
+/* 36F0 */	0x53u, 0x68u, 0x65u, 0x65u, 0x74u, 0x9Au, 0x08u, 0x18u, 0x00u, 0x9Au, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3700 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u,
+/* 3710 */	0x00u, 0xA3u, 0x08u, 0x10u, 0x00u, 0xA3u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3720 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x8Cu, 0x00u, 0x04u, 0x00u, 0x07u, 0x00u, 0x07u, 0x00u, 0xC1u, 0x01u, 0x08u,
+/* 3730 */	0x00u, 0xC1u, 0x01u, 0x00u, 0x00u, 0x67u, 0xE6u, 0x01u, 0x00u, 0xFCu, 0x00u, 0x2Cu, 0x00u, 0x03u, 0x00u, 0x00u,
+/* 3740 */	0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x09u, 0x00u, 0x00u, 0x53u, 0x74u, 0x72u, 0x69u, 0x6Eu, 0x67u, 0x20u, 0x23u,
+/* 3750 */	0x31u, 0x09u, 0x00u, 0x00u, 0x53u, 0x74u, 0x72u, 0x69u, 0x6Eu, 0x67u, 0x20u, 0x23u, 0x32u, 0x09u, 0x00u, 0x00u,
+/* 3760 */	0x53u, 0x74u, 0x72u, 0x69u, 0x6Eu, 0x67u, 0x20u, 0x23u, 0x33u, 0xFFu, 0x00u, 0x0Au, 0x00u, 0x08u, 0x00u, 0x45u,
+/* 3770 */	0x31u, 0x00u, 0x00u, 0x0Cu, 0x00u, 0x00u, 0x00u, 0x63u, 0x08u, 0x16u, 0x00u, 0x63u, 0x08u, 0x00u, 0x00u, 0x00u,
+/* 3780 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x16u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x02u,
+/* 3790 */	0x00u, 0x96u, 0x08u, 0x10u, 0x00u, 0x96u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 37A0 */	0x00u, 0x42u, 0xE5u, 0x01u, 0x00u, 0x9Bu, 0x08u, 0x10u, 0x00u, 0x9Bu, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 37B0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x8Cu, 0x08u, 0x10u, 0x00u, 0x8Cu, 0x08u, 0x00u,
+/* 37C0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x0Au, 0x00u, 0x00u,
+/* 37D0 */	0x00u, 0x09u, 0x08u, 0x10u, 0x00u, 0x00u, 0x06u, 0x10u, 0x00u, 0xA9u, 0x1Fu, 0xCDu, 0x07u, 0xC9u, 0x00u, 0x01u,
+/* 37E0 */	0x00u, 0x06u, 0x04u, 0x00u, 0x00u, 0x0Bu, 0x02u, 0x14u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 37F0 */	0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0xE7u, 0x32u, 0x00u, 0x00u, 0x16u, 0x34u, 0x00u, 0x00u, 0x0Du, 0x00u, 0x02u,
+
+			/* 27 sector. Workbook. */
+/* 3800 */	0x00u, 0x01u, 0x00u, 0x0Cu, 0x00u, 0x02u, 0x00u, 0x64u, 0x00u, 0x0Fu, 0x00u, 0x02u, 0x00u, 0x01u, 0x00u, 0x11u,
+/* 3810 */	0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x10u, 0x00u, 0x08u, 0x00u, 0xFCu, 0xA9u, 0xF1u, 0xD2u, 0x4Du, 0x62u, 0x50u,
+/* 3820 */	0x3Fu, 0x5Fu, 0x00u, 0x02u, 0x00u, 0x01u, 0x00u, 0x2Au, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x2Bu, 0x00u, 0x02u,
+/* 3830 */	0x00u, 0x00u, 0x00u, 0x82u, 0x00u, 0x02u, 0x00u, 0x01u, 0x00u, 0x80u, 0x00u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3840 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x25u, 0x02u, 0x04u, 0x00u, 0x00u, 0x00u, 0x2Cu, 0x01u, 0x81u, 0x00u, 0x02u,
+/* 3850 */	0x00u, 0xC1u, 0x04u, 0x14u, 0x00u, 0x00u, 0x00u, 0x15u, 0x00u, 0x00u, 0x00u, 0x83u, 0x00u, 0x02u, 0x00u, 0x00u,
+/* 3860 */	0x00u, 0x84u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x26u, 0x00u, 0x08u, 0x00u, 0x66u, 0x66u, 0x66u, 0x66u, 0x66u,
+/* 3870 */	0x66u, 0xE6u, 0x3Fu, 0x27u, 0x00u, 0x08u, 0x00u, 0x66u, 0x66u, 0x66u, 0x66u, 0x66u, 0x66u, 0xE6u, 0x3Fu, 0x28u,
+/* 3880 */	0x00u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xE8u, 0x3Fu, 0x29u, 0x00u, 0x08u, 0x00u, 0x00u,
+/* 3890 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xE8u, 0x3Fu, 0xA1u, 0x00u, 0x22u, 0x00u, 0x00u, 0x00u, 0x2Cu, 0x01u, 0x01u,
+/* 38A0 */	0x00u, 0x01u, 0x00u, 0x01u, 0x00u, 0x04u, 0x00u, 0x42u, 0xE5u, 0x01u, 0x00u, 0x33u, 0x33u, 0x33u, 0x33u, 0x33u,
+/* 38B0 */	0x33u, 0xD3u, 0x3Fu, 0x33u, 0x33u, 0x33u, 0x33u, 0x33u, 0x33u, 0xD3u, 0x3Fu, 0x09u, 0x00u, 0x9Cu, 0x08u, 0x26u,
+/* 38C0 */	0x00u, 0x9Cu, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 38D0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x3Cu, 0x33u, 0x00u,
+/* 38E0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x55u, 0x00u, 0x02u, 0x00u, 0x08u, 0x00u, 0x00u, 0x02u, 0x0Eu,
+/* 38F0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x00u, 0x00u, 0x00u, 0x08u,
+/* 3900 */	0x02u, 0x10u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x00u, 0x2Cu, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3910 */	0x01u, 0x0Fu, 0x00u, 0x08u, 0x02u, 0x10u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x04u, 0x00u, 0x2Cu, 0x01u, 0x00u,
+/* 3920 */	0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x0Fu, 0x00u, 0x08u, 0x02u, 0x10u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x04u,
+/* 3930 */	0x00u, 0x2Cu, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x0Fu, 0x00u, 0xFDu, 0x00u, 0x0Au, 0x00u, 0x00u,
+/* 3940 */	0x00u, 0x00u, 0x00u, 0x0Fu, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0xBDu, 0x00u, 0x12u, 0x00u, 0x00u, 0x00u, 0x01u,
+/* 3950 */	0x00u, 0x0Fu, 0x00u, 0x00u, 0x00u, 0xF0u, 0x3Fu, 0x0Fu, 0x00u, 0x01u, 0x00u, 0x24u, 0x40u, 0x02u, 0x00u, 0x06u,
+/* 3960 */	0x00u, 0x21u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x0Fu, 0x00u, 0x9Au, 0x99u, 0x99u, 0x99u, 0x99u, 0x99u, 0xF1u,
+/* 3970 */	0x3Fu, 0x00u, 0x00u, 0xC0u, 0x00u, 0x00u, 0xFDu, 0x0Bu, 0x00u, 0x44u, 0x00u, 0x00u, 0x01u, 0xC0u, 0x44u, 0x00u,
+/* 3980 */	0x00u, 0x02u, 0xC0u, 0x03u, 0xFDu, 0x00u, 0x0Au, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x0Fu, 0x00u, 0x01u, 0x00u,
+/* 3990 */	0x00u, 0x00u, 0xBDu, 0x00u, 0x12u, 0x00u, 0x01u, 0x00u, 0x01u, 0x00u, 0x0Fu, 0x00u, 0x00u, 0x00u, 0x00u, 0x40u,
+/* 39A0 */	0x0Fu, 0x00u, 0x01u, 0x00u, 0x34u, 0x40u, 0x02u, 0x00u, 0x06u, 0x00u, 0x21u, 0x00u, 0x01u, 0x00u, 0x03u, 0x00u,
+/* 39B0 */	0x0Fu, 0x00u, 0x9Au, 0x99u, 0x99u, 0x99u, 0x99u, 0x99u, 0x01u, 0x40u, 0x08u, 0x00u, 0x02u, 0x00u, 0x03u, 0xFEu,
+/* 39C0 */	0x0Bu, 0x00u, 0x44u, 0x01u, 0x00u, 0x01u, 0xC0u, 0x44u, 0x01u, 0x00u, 0x02u, 0xC0u, 0x03u, 0xFDu, 0x00u, 0x0Au,
+/* 39D0 */	0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x0Fu, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0xBDu, 0x00u, 0x12u, 0x00u, 0x02u,
+/* 39E0 */	0x00u, 0x01u, 0x00u, 0x0Fu, 0x00u, 0x00u, 0x00u, 0x08u, 0x40u, 0x0Fu, 0x00u, 0x01u, 0x00u, 0x3Eu, 0x40u, 0x02u,
+/* 39F0 */	0x00u, 0x06u, 0x00u, 0x21u, 0x00u, 0x02u, 0x00u, 0x03u, 0x00u, 0x0Fu, 0x00u, 0x66u, 0x66u, 0x66u, 0x66u, 0x66u,
+
+			/* 28 sector. Workbook. */
+/* 3A00 */	0x66u, 0x0Au, 0x40u, 0x08u, 0x00u, 0x00u, 0x00u, 0x03u, 0xFFu, 0x0Bu, 0x00u, 0x44u, 0x02u, 0x00u, 0x01u, 0xC0u,
+/* 3A10 */	0x44u, 0x02u, 0x00u, 0x02u, 0xC0u, 0x03u, 0xD7u, 0x00u, 0x0Au, 0x00u, 0x17u, 0x01u, 0x00u, 0x00u, 0x28u, 0x00u,
+/* 3A20 */	0x49u, 0x00u, 0x49u, 0x00u, 0x3Eu, 0x02u, 0x12u, 0x00u, 0xB6u, 0x06u, 0x00u, 0x00u, 0x00u, 0x00u, 0x40u, 0x00u,
+/* 3A30 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x66u, 0x66u, 0x00u, 0x00u, 0x8Bu, 0x08u, 0x10u, 0x00u, 0x8Bu, 0x08u,
+/* 3A40 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x62u, 0x66u, 0x1Du, 0x00u,
+/* 3A50 */	0x0Fu, 0x00u, 0x03u, 0x02u, 0x00u, 0x04u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x02u, 0x00u, 0x02u, 0x00u, 0x04u,
+/* 3A60 */	0x04u, 0x67u, 0x08u, 0x17u, 0x00u, 0x67u, 0x08u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3A70 */	0x00u, 0x02u, 0x00u, 0x01u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x03u, 0x44u, 0x00u, 0x00u, 0x0Au, 0x00u, 0x00u, 0x00u,
+/* 3A80 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3A90 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3AA0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3AB0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3AC0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3AD0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3AE0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3AF0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3B00 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3B10 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3B20 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3B30 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3B40 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3B50 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3B60 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3B70 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3B80 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3B90 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3BA0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3BB0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3BC0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3BD0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3BE0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3BF0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+
+			/* 29 sector. SSAT. */
+			/* | 00 | 01 | 02 | 03 | 04 | 05 | 06 | 07 | 08 | 09 | 10 | 11 | 12 | 13 | 14 | 15 | */
+			/* | 01 | 02 | 03 | -2 | 05 | 06 | 07 | -2 | 09 | -2 | -1 | -1 | -1 | -1 | -1 | -1 | */
+/* 3C00 */	0x01u, 0x00u, 0x00u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0xFEu, 0xFFu, 0xFFu, 0xFFu,
+/* 3C10 */	0x05u, 0x00u, 0x00u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0xFEu, 0xFFu, 0xFFu, 0xFFu,
+/* 3C20 */	0x09u, 0x00u, 0x00u, 0x00u, 0xFEu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3C30 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3C40 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3C50 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3C60 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3C70 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3C80 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3C90 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3CA0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3CB0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3CC0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3CD0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3CE0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3CF0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3D00 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3D10 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3D20 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3D30 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3D40 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3D50 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3D60 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3D70 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3D80 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3D90 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3DA0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3DB0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3DC0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3DD0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3DE0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 3DF0 */	0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+
+			/* 30 sector. */
+/* 3E00 */	0xFEu, 0xFFu, 0x00u, 0x00u, 0x05u, 0x01u, 0x02u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3E10 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0xE0u, 0x85u, 0x9Fu, 0xF2u,
+/* 3E20 */	0xF9u, 0x4Fu, 0x68u, 0x10u, 0xABu, 0x91u, 0x08u, 0x00u, 0x2Bu, 0x27u, 0xB3u, 0xD9u, 0x30u, 0x00u, 0x00u, 0x00u,
+/* 3E30 */	0xB0u, 0x00u, 0x00u, 0x00u, 0x07u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x40u, 0x00u, 0x00u, 0x00u,
+/* 3E40 */	0x04u, 0x00u, 0x00u, 0x00u, 0x48u, 0x00u, 0x00u, 0x00u, 0x08u, 0x00u, 0x00u, 0x00u, 0x60u, 0x00u, 0x00u, 0x00u,
+/* 3E50 */	0x12u, 0x00u, 0x00u, 0x00u, 0x78u, 0x00u, 0x00u, 0x00u, 0x0Cu, 0x00u, 0x00u, 0x00u, 0x90u, 0x00u, 0x00u, 0x00u,
+/* 3E60 */	0x0Du, 0x00u, 0x00u, 0x00u, 0x9Cu, 0x00u, 0x00u, 0x00u, 0x13u, 0x00u, 0x00u, 0x00u, 0xA8u, 0x00u, 0x00u, 0x00u,
+/* 3E70 */	0x02u, 0x00u, 0x00u, 0x00u, 0xE3u, 0x04u, 0x00u, 0x00u, 0x1Eu, 0x00u, 0x00u, 0x00u, 0x10u, 0x00u, 0x00u, 0x00u,
+/* 3E80 */	0x49u, 0x67u, 0x6Fu, 0x72u, 0x20u, 0x4Du, 0x69u, 0x72u, 0x6Fu, 0x6Eu, 0x63u, 0x68u, 0x69u, 0x6Bu, 0x00u, 0x00u,
+/* 3E90 */	0x1Eu, 0x00u, 0x00u, 0x00u, 0x10u, 0x00u, 0x00u, 0x00u, 0x49u, 0x67u, 0x6Fu, 0x72u, 0x20u, 0x4Du, 0x69u, 0x72u,
+/* 3EA0 */	0x6Fu, 0x6Eu, 0x63u, 0x68u, 0x69u, 0x6Bu, 0x00u, 0x00u, 0x1Eu, 0x00u, 0x00u, 0x00u, 0x10u, 0x00u, 0x00u, 0x00u,
+/* 3EB0 */	0x4Du, 0x69u, 0x63u, 0x72u, 0x6Fu, 0x73u, 0x6Fu, 0x66u, 0x74u, 0x20u, 0x45u, 0x78u, 0x63u, 0x65u, 0x6Cu, 0x00u,
+/* 3EC0 */	0x40u, 0x00u, 0x00u, 0x00u, 0x00u, 0x04u, 0x6Eu, 0xDBu, 0xD4u, 0xCEu, 0xCBu, 0x01u, 0x40u, 0x00u, 0x00u, 0x00u,
+/* 3ED0 */	0x00u, 0xEDu, 0x5Bu, 0x71u, 0xDAu, 0xD4u, 0xCBu, 0x01u, 0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3EE0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3EF0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3F00 */	0xFEu, 0xFFu, 0x00u, 0x00u, 0x05u, 0x01u, 0x02u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3F10 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x02u, 0xD5u, 0xCDu, 0xD5u,
+/* 3F20 */	0x9Cu, 0x2Eu, 0x1Bu, 0x10u, 0x93u, 0x97u, 0x08u, 0x00u, 0x2Bu, 0x2Cu, 0xF9u, 0xAEu, 0x30u, 0x00u, 0x00u, 0x00u,
+/* 3F30 */	0xBCu, 0x00u, 0x00u, 0x00u, 0x09u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x50u, 0x00u, 0x00u, 0x00u,
+/* 3F40 */	0x0Fu, 0x00u, 0x00u, 0x00u, 0x58u, 0x00u, 0x00u, 0x00u, 0x17u, 0x00u, 0x00u, 0x00u, 0x64u, 0x00u, 0x00u, 0x00u,
+/* 3F50 */	0x0Bu, 0x00u, 0x00u, 0x00u, 0x6Cu, 0x00u, 0x00u, 0x00u, 0x10u, 0x00u, 0x00u, 0x00u, 0x74u, 0x00u, 0x00u, 0x00u,
+/* 3F60 */	0x13u, 0x00u, 0x00u, 0x00u, 0x7Cu, 0x00u, 0x00u, 0x00u, 0x16u, 0x00u, 0x00u, 0x00u, 0x84u, 0x00u, 0x00u, 0x00u,
+/* 3F70 */	0x0Du, 0x00u, 0x00u, 0x00u, 0x8Cu, 0x00u, 0x00u, 0x00u, 0x0Cu, 0x00u, 0x00u, 0x00u, 0x9Eu, 0x00u, 0x00u, 0x00u,
+/* 3F80 */	0x02u, 0x00u, 0x00u, 0x00u, 0xE3u, 0x04u, 0x00u, 0x00u, 0x1Eu, 0x00u, 0x00u, 0x00u, 0x04u, 0x00u, 0x00u, 0x00u,
+/* 3F90 */	0x00u, 0x00u, 0x00u, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x0Cu, 0x00u, 0x0Bu, 0x00u, 0x00u, 0x00u,
+/* 3FA0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x0Bu, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x0Bu, 0x00u, 0x00u, 0x00u,
+/* 3FB0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x0Bu, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x1Eu, 0x10u, 0x00u, 0x00u,
+/* 3FC0 */	0x01u, 0x00u, 0x00u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0x53u, 0x68u, 0x65u, 0x65u, 0x74u, 0x00u, 0x0Cu, 0x10u,
+/* 3FD0 */	0x00u, 0x00u, 0x02u, 0x00u, 0x00u, 0x00u, 0x1Eu, 0x00u, 0x00u, 0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0xCBu, 0xE8u,
+/* 3FE0 */	0xF1u, 0xF2u, 0xFBu, 0x00u, 0x03u, 0x00u, 0x00u, 0x00u, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 3FF0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+
+			/* 31 sector. */
+/* 4000 */	/* Name of the directory. */
+			0x01u, 0x00u, 0x43u, 0x00u, 0x6Fu, 0x00u, 0x6Du, 0x00u, 0x70u, 0x00u, 0x4Fu, 0x00u, 0x62u, 0x00u, 0x6Au, 0x00u,
+/* 4010 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4020 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4030 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4040 */	/* Size of used area by directory's name: 18. */
+			0x12u, 0x00u,
+			/* Type of the entry: User stream. */
+			0x02u,
+			/* Node color: Red. */
+			0x00u,
+			/* DirID of the left child: 0xFFFFFFFF. */
+			0xFFu, 0xFFu, 0xFFu, 0xFFu,
+			/* DirID of the right child: 0xFFFFFFFF. */
+			0xFFu, 0xFFu, 0xFFu, 0xFFu,
+			/* DirID of the root node entry: 0xFFFFFFFF. */
+			0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 4050 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4060 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4070 */	0x00u, 0x00u, 0x00u, 0x00u,
+			/* SecID of first sector: 8. */
+			0x08u, 0x00u, 0x00u, 0x00u,
+			/* Total stream size: 109. */
+			0x6Du, 0x00u, 0x00u, 0x00u,
+			0x00u, 0x00u, 0x00u, 0x00u,
+/* 4080 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4090 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 40A0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 40B0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 40C0 */	0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 40D0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 40E0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 40F0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4100 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4110 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4120 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4130 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4140 */	0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 4150 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4160 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4170 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4180 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4190 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 41A0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 41B0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 41C0 */	0x00u, 0x00u, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0xFFu,
+/* 41D0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 41E0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 41F0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+
+			/* 32 sector. */
+/* 4200 */	0x01u, 0x00u, 0xFEu, 0xFFu, 0x03u, 0x0Au, 0x00u, 0x00u, 0xFFu, 0xFFu, 0xFFu, 0xFFu, 0x20u, 0x08u, 0x02u, 0x00u,
+/* 4210 */	0x00u, 0x00u, 0x00u, 0x00u, 0xC0u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x46u, 0x21u, 0x00u, 0x00u, 0x00u,
+/* 4220 */	0xCBu, 0xE8u, 0xF1u, 0xF2u, 0x20u, 0x4Du, 0x69u, 0x63u, 0x72u, 0x6Fu, 0x73u, 0x6Fu, 0x66u, 0x74u, 0x20u, 0x4Fu,
+/* 4230 */	0x66u, 0x66u, 0x69u, 0x63u, 0x65u, 0x20u, 0x45u, 0x78u, 0x63u, 0x65u, 0x6Cu, 0x20u, 0x32u, 0x30u, 0x30u, 0x33u,
+/* 4240 */	0x00u, 0x06u, 0x00u, 0x00u, 0x00u, 0x42u, 0x69u, 0x66u, 0x66u, 0x38u, 0x00u, 0x0Eu, 0x00u, 0x00u, 0x00u, 0x45u,
+/* 4250 */	0x78u, 0x63u, 0x65u, 0x6Cu, 0x2Eu, 0x53u, 0x68u, 0x65u, 0x65u, 0x74u, 0x2Eu, 0x38u, 0x00u, 0xF4u, 0x39u, 0xB2u,
+/* 4260 */	0x71u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4270 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4280 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4290 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 42A0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 42B0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 42C0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 42D0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 42E0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 42F0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4300 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4310 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4320 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4330 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4340 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4350 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4360 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4370 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4380 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 4390 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 43A0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 43B0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 43C0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 43D0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 43E0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,
+/* 43F0 */	0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u
+);
+
+
+//
+// Document
+//
+
+Document::Document()
+	:	m_stream( std::ios::in | std::ios::out | std::ios::binary )
+{
+	m_stream.write( &data[ 0 ], 0x4400 );
+}
+
+//! \return Document's stream.
+std::stringstream &
+Document::stream()
+{
+	return m_stream;
+}